@@ -0,0 +1,117 @@
+/**
+ * @file BinaryIO.h
+ * @brief Little-endian encoding helpers and CRC-32 for the on-disk formats.
+ *
+ * The journal and snapshot files are written field by field in little-endian
+ * order, so they read back the same on the Pi and on a desktop.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#ifndef BINARYIO_H
+#define BINARYIO_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <type_traits>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Computes the CRC-32 (IEEE 802.3) of a block of bytes.
+ *
+ * @param data Start of the bytes.
+ * @param size Number of bytes.
+ * @param crc CRC of the bytes before this block, to checksum in pieces.
+ * @return The CRC-32 of everything so far.
+ */
+inline std::uint32_t crc32(const void *data, std::size_t size, std::uint32_t crc = 0) {
+    static const std::array<std::uint32_t, 256> table = [] {
+        std::array<std::uint32_t, 256> t{};
+        for (std::uint32_t i = 0; i < 256; ++i) {
+            std::uint32_t c = i;
+            for (int k = 0; k < 8; ++k) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            t[i] = c;
+        }
+        return t;
+    }();
+
+    const auto *bytes = static_cast<const unsigned char *>(data);
+    crc = ~crc;
+    for (std::size_t i = 0; i < size; ++i) {
+        crc = table[(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+/**
+ * @brief Appends an integer to a byte buffer in little-endian order.
+ *
+ * @param out The buffer to append to.
+ * @param value The value to append.
+ */
+template <typename T>
+inline void putLE(std::string &out, T value) {
+    static_assert(std::is_integral<T>::value, "putLE only writes integers");
+    auto bits = static_cast<typename std::make_unsigned<T>::type>(value);
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+        out.push_back(static_cast<char>((bits >> (8 * i)) & 0xFF));
+    }
+}
+
+/**
+ * @brief Overwrites bytes already in a buffer with an integer in little-endian order.
+ *
+ * @param out Start of the bytes; at least sizeof(T) bytes must be writable.
+ * @param value The value to write.
+ */
+template <typename T>
+inline void setLE(char *out, T value) {
+    static_assert(std::is_integral<T>::value, "setLE only writes integers");
+    auto bits = static_cast<typename std::make_unsigned<T>::type>(value);
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+        out[i] = static_cast<char>((bits >> (8 * i)) & 0xFF);
+    }
+}
+
+/**
+ * @brief Reads a little-endian integer from a byte buffer.
+ *
+ * @param in Start of the bytes; at least sizeof(T) bytes must be readable.
+ * @return The decoded value.
+ */
+template <typename T>
+inline T getLE(const char *in) {
+    static_assert(std::is_integral<T>::value, "getLE only reads integers");
+    typename std::make_unsigned<T>::type bits = 0;
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+        bits |= static_cast<typename std::make_unsigned<T>::type>(static_cast<unsigned char>(in[i])) << (8 * i);
+    }
+    return static_cast<T>(bits);
+}
+
+/**
+ * @brief Pushes a file's written data all the way to the storage device.
+ *
+ * The stdio buffer must already have been flushed with fflush().
+ *
+ * @param file The open file.
+ * @return true if the data is on disk.
+ */
+inline bool syncFile(std::FILE *file) {
+#ifdef _WIN32
+    return _commit(_fileno(file)) == 0;
+#else
+    return fsync(fileno(file)) == 0;
+#endif
+}
+
+#endif // BINARYIO_H
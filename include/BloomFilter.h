@@ -0,0 +1,79 @@
+/**
+ * @file BloomFilter.h
+ * @brief Definition of the BloomFilter class.
+ *
+ * This file defines a small Bloom filter over 64-bit keys. It answers "this
+ * key was never added" with certainty and "this key may have been added" with
+ * about a 1% false positive rate at the capacity it was sized for. Stations
+ * use it to turn away IDs that belong to no loaded exam without touching the
+ * full index.
+ *
+ * The filter is not synchronized; its owner guards it.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#ifndef BLOOMFILTER_H
+#define BLOOMFILTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class BloomFilter {
+private:
+    std::vector<std::uint64_t> words;   // The bit array, 64 bits per word
+    std::uint64_t mask;                 // Bit count minus one; the bit count is a power of two
+    std::size_t capacity;               // Keys the filter was sized for
+
+public:
+    static constexpr std::size_t BITS_PER_KEY = 10;
+    static constexpr unsigned HASHES = 7;
+
+    /**
+     * @brief Constructs an empty filter.
+     *
+     * @param expectedKeys Keys the filter should hold at its target false positive rate.
+     */
+    explicit BloomFilter(std::size_t expectedKeys = 0);
+
+    /**
+     * @brief Empties the filter and sizes it for a new number of keys.
+     *
+     * @param expectedKeys Keys the filter should hold at its target false positive rate.
+     */
+    void reset(std::size_t expectedKeys);
+
+    /**
+     * @brief Adds a key.
+     *
+     * @param key The key to add.
+     */
+    void add(std::uint64_t key);
+
+    /**
+     * @brief Checks whether a key may have been added.
+     *
+     * @param key The key to check.
+     * @return false if the key was certainly never added.
+     */
+    bool mightContain(std::uint64_t key) const;
+
+    /**
+     * @brief Retrieves the number of keys the filter was sized for.
+     *
+     * @return The capacity.
+     */
+    std::size_t getCapacity() const;
+
+    /**
+     * @brief Retrieves the size of the bit array.
+     *
+     * @return The number of bits.
+     */
+    std::size_t getBitCount() const;
+};
+
+#endif // BLOOMFILTER_H
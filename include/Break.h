@@ -32,6 +32,15 @@ public:
      */
     Break();
 
+    /**
+     * @brief Constructs a Break object that started at the given time.
+     *
+     * Used when a batch of breaks is recorded with one shared timestamp.
+     *
+     * @param start The time the break started.
+     */
+    explicit Break(std::chrono::system_clock::time_point start);
+
     /**
      * @brief Retrieves the formatted start time of the break.
      *
@@ -49,6 +58,29 @@ public:
      */
     std::string getEndTime() const;
 
+    /**
+     * @brief Retrieves the start time of the break.
+     *
+     * @return The start time as a system_clock::time_point.
+     */
+    std::chrono::system_clock::time_point getStartTimePoint() const;
+
+    /**
+     * @brief Retrieves the end time of the break.
+     *
+     * Only meaningful once hasEnded() is true.
+     *
+     * @return The end time as a system_clock::time_point.
+     */
+    std::chrono::system_clock::time_point getEndTimePoint() const;
+
+    /**
+     * @brief Checks whether the student has returned from the break.
+     *
+     * @return true if the break has ended.
+     */
+    bool hasEnded() const;
+
     /**
      * @brief Ends the break and records the current system time as the end time.
      *
@@ -56,6 +88,13 @@ public:
      */
     void endBreak();
 
+    /**
+     * @brief Ends the break at the given time.
+     *
+     * @param end The time the student returned.
+     */
+    void endBreak(std::chrono::system_clock::time_point end);
+
     /**
      * @brief Calculates and retrieves the duration of the break in HH:MM:SS format.
      *
@@ -0,0 +1,179 @@
+/**
+ * @file BreakLog.h
+ * @brief Definition of the BreakRecord structure and the BreakLog and BreakView classes.
+ *
+ * This file defines BreakLog, the exam-wide, append-only record of washroom
+ * breaks. The breaks of every student sit in one contiguous array of
+ * (student, start, end) records, so a student's first break costs no
+ * allocation of its own and exporting breaks is a linear scan. Each record
+ * links to the same student's next break; a Student keeps the positions of
+ * its first and last break and reads them through a BreakView.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#ifndef BREAKLOG_H
+#define BREAKLOG_H
+
+#include "Break.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief One break of one student, linked to the student's next break.
+ */
+struct BreakRecord {
+    int studentID;        // Student who took the break
+    std::uint32_t next;   // Position of the student's next break, or BreakLog::NONE
+    Break span;           // When the break started and, once over, ended
+};
+
+class BreakLog {
+public:
+    static constexpr std::uint32_t NONE = UINT32_MAX;   // No break at this position
+
+private:
+    mutable std::mutex lock;            // Guards records; an append may move them
+    std::vector<BreakRecord> records;   // Every break, in the order they started
+
+public:
+    BreakLog() = default;
+
+    BreakLog(const BreakLog &) = delete;
+    BreakLog &operator=(const BreakLog &) = delete;
+
+    /**
+     * @brief Appends a break and links it after the student's previous one.
+     *
+     * @param studentID The student leaving.
+     * @param at The time the student left.
+     * @param previous Position of the student's previous break, or NONE for their first.
+     * @return The position of the new break.
+     */
+    std::uint32_t start(int studentID, std::chrono::system_clock::time_point at, std::uint32_t previous);
+
+    /**
+     * @brief Ends the break at a position.
+     *
+     * @param position The position start() returned.
+     * @param at The time the student returned.
+     */
+    void end(std::uint32_t position, std::chrono::system_clock::time_point at);
+
+    /**
+     * @brief Retrieves a copy of the record at a position.
+     *
+     * @param position The position start() returned.
+     * @return The record.
+     */
+    BreakRecord record(std::uint32_t position) const;
+
+    /**
+     * @brief Makes room for breaks so starting them does not allocate.
+     *
+     * @param numBreaks The number of breaks expected.
+     */
+    void reserve(std::size_t numBreaks);
+
+    /**
+     * @brief Removes every break.
+     */
+    void clear();
+
+    /**
+     * @brief Retrieves the number of breaks recorded.
+     *
+     * @return The number of breaks.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Visits every record in the order the breaks started.
+     *
+     * The log is locked for the whole scan, so the visitor must not call back into it.
+     *
+     * @param visit Called with each record.
+     */
+    template <typename Visit>
+    void forEach(Visit visit) const {
+        std::lock_guard<std::mutex> guard(lock);
+        for (const BreakRecord &r : records) visit(r);
+    }
+};
+
+/**
+ * @brief The breaks of one student, read from a BreakLog in the order they were taken.
+ *
+ * A view is a few words and copies nothing; each step reads one record from the log.
+ */
+class BreakView {
+private:
+    const BreakLog *log;
+    std::uint32_t first;
+    std::uint32_t last;
+    std::size_t count;
+
+public:
+    class iterator {
+    private:
+        const BreakLog *log;
+        std::uint32_t position;
+        BreakRecord current;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Break;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Break *;
+        using reference = const Break &;
+
+        iterator(const BreakLog *log, std::uint32_t position)
+            : log(log), position(position), current{0, BreakLog::NONE, Break(std::chrono::system_clock::time_point())} {
+            if (position != BreakLog::NONE) current = log->record(position);
+        }
+
+        reference operator*() const { return current.span; }
+        pointer operator->() const { return &current.span; }
+
+        iterator &operator++() {
+            position = current.next;
+            if (position != BreakLog::NONE) current = log->record(position);
+            return *this;
+        }
+
+        bool operator==(const iterator &other) const { return position == other.position; }
+        bool operator!=(const iterator &other) const { return position != other.position; }
+    };
+
+    BreakView() : log(nullptr), first(BreakLog::NONE), last(BreakLog::NONE), count(0) {}
+
+    BreakView(const BreakLog *log, std::uint32_t first, std::uint32_t last, std::size_t count)
+        : log(log), first(first), last(last), count(count) {}
+
+    iterator begin() const { return iterator(log, count ? first : BreakLog::NONE); }
+    iterator end() const { return iterator(log, BreakLog::NONE); }
+    std::size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    /**
+     * @brief Retrieves the student's first break. The view must not be empty.
+     *
+     * @return A copy of the break.
+     */
+    Break front() const { return log->record(first).span; }
+
+    /**
+     * @brief Retrieves the student's latest break. The view must not be empty.
+     *
+     * @return A copy of the break.
+     */
+    Break back() const { return log->record(last).span; }
+};
+
+#endif // BREAKLOG_H
@@ -0,0 +1,145 @@
+/**
+ * @file BreakMonitor.h
+ * @brief Definition of the BreakAlert structure and the BreakMonitor class.
+ *
+ * This file defines BreakMonitor, which raises an alert when a student has been
+ * out on a washroom break for longer than a set limit. It listens to the event
+ * log of every watched exam: a BreakStarted event arms one timer on a shared
+ * TimerWheel and a BreakEnded event cancels it. No roster is ever scanned, so
+ * the cost is one timer per break in progress across every room.
+ *
+ * Alerts are delivered on the thread that advances the wheel.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#ifndef BREAKMONITOR_H
+#define BREAKMONITOR_H
+
+#include "Exam.h"
+#include "TimerWheel.h"
+#include <chrono>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief A student who has been out on a break for longer than the limit.
+ */
+struct BreakAlert {
+    std::string examKey;
+    int studentID = 0;
+    std::chrono::system_clock::time_point leftAt;   // When the break started
+    std::chrono::minutes limit{0};                  // The limit that was passed
+};
+
+class BreakMonitor {
+public:
+    using AlertHandler = std::function<void(const BreakAlert &)>;
+
+    static constexpr std::chrono::minutes DEFAULT_LIMIT{20};
+
+private:
+    struct Armed {
+        std::chrono::system_clock::time_point leftAt;
+        std::chrono::minutes limit;   // Limit in force when the break started
+        TimerWheel::TimerId timer;
+    };
+
+    struct Watched {
+        Exam *exam = nullptr;
+        std::size_t listener = 0;
+        std::unordered_map<int, Armed> armed;          // Student ID -> break timer
+        std::unordered_map<int, BreakAlert> overdue;   // Student ID -> alert raised and not yet cleared
+    };
+
+    TimerWheel &wheel;
+    std::chrono::minutes limit;
+    std::vector<AlertHandler> handlers;
+    std::map<std::string, Watched> watched;   // Exam key -> its breaks
+    mutable std::mutex lock;                  // Guards limit and watched
+
+    void arm(const std::string &examKey, Watched &exam, int studentID, std::chrono::system_clock::time_point leftAt);
+    void fire(const std::string &examKey, int studentID, std::chrono::system_clock::time_point leftAt);
+
+public:
+    /**
+     * @brief Constructs a monitor that watches no exams yet.
+     *
+     * @param wheel Wheel the break timers are armed on; must outlive the monitor.
+     * @param limit How long a break may last before an alert is raised.
+     */
+    explicit BreakMonitor(TimerWheel &wheel, std::chrono::minutes limit = DEFAULT_LIMIT);
+
+    /**
+     * @brief Stops watching every exam.
+     */
+    ~BreakMonitor();
+
+    BreakMonitor(const BreakMonitor &) = delete;
+    BreakMonitor &operator=(const BreakMonitor &) = delete;
+
+    /**
+     * @brief Registers a callback for alerts.
+     *
+     * Handlers are registered during setup, before any exam is watched.
+     *
+     * @param handler Runs for every alert on the thread that advances the wheel.
+     */
+    void addAlertHandler(AlertHandler handler);
+
+    /**
+     * @brief Starts watching the breaks of an exam.
+     *
+     * Breaks already in progress, such as in an exam rebuilt after a crash, are
+     * armed from their start times. Stations may already be driving the exam;
+     * the listener is added before breaks in progress are read, so no break
+     * is missed in between.
+     *
+     * @param examKey Key the exam is known by.
+     * @param exam The exam; must stay alive until unwatch().
+     */
+    void watch(const std::string &examKey, Exam &exam);
+
+    /**
+     * @brief Stops watching an exam and disarms its timers.
+     *
+     * @param examKey Key the exam was watched under.
+     */
+    void unwatch(const std::string &examKey);
+
+    /**
+     * @brief Changes the break limit for breaks that start from now on.
+     *
+     * @param limit How long a break may last before an alert is raised.
+     */
+    void setLimit(std::chrono::minutes limit);
+
+    /**
+     * @brief Retrieves the break limit.
+     *
+     * @return The current limit.
+     */
+    std::chrono::minutes getLimit() const;
+
+    /**
+     * @brief Lists the students who are past the limit and still out.
+     *
+     * @return One alert per overdue student, longest out first.
+     */
+    std::vector<BreakAlert> getOverdue() const;
+
+    /**
+     * @brief Retrieves the number of breaks with an armed timer.
+     *
+     * @return The number of breaks in progress that are not yet overdue.
+     */
+    std::size_t getArmedCount() const;
+};
+
+#endif // BREAKMONITOR_H
@@ -0,0 +1,135 @@
+/**
+ * @file CommandQueue.h
+ * @brief Definition of the CommandQueue class.
+ *
+ * This file defines the CommandQueue class, a bounded lock-free ring buffer of
+ * ExamCommands. Any number of input threads push into it and a single applier
+ * thread drains it. Each slot carries a sequence number, so producers claim a
+ * slot with one compare-and-swap and never block each other or the consumer.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#ifndef COMMANDQUEUE_H
+#define COMMANDQUEUE_H
+
+#include "ExamCommand.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class CommandQueue {
+private:
+    struct Slot {
+        std::atomic<std::size_t> sequence;  // Ready to write when == position, ready to read when == position + 1
+        ExamCommand command;
+    };
+
+    std::unique_ptr<Slot[]> slots;
+    std::size_t mask;                                   // Capacity - 1; capacity is a power of two
+    alignas(64) std::atomic<std::size_t> writePos;      // Next position a producer will claim
+    alignas(64) std::atomic<std::size_t> readPos;       // Next position the consumer will read
+    alignas(64) std::atomic<std::size_t> highWater;     // Deepest the queue has been
+    std::atomic<std::uint64_t> pushed;                  // Commands accepted
+    std::atomic<std::uint64_t> rejected;                // Commands refused because the queue was full
+
+    // Only used to park the consumer while the queue is empty
+    std::mutex sleepLock;
+    std::condition_variable wakeUp;
+    std::atomic<bool> consumerSleeping;
+    bool wakeRequested;                                 // Guarded by sleepLock
+
+    void noteDepth(std::size_t depth);
+
+public:
+    /**
+     * @brief Constructs an empty queue.
+     *
+     * @param capacity Maximum number of queued commands, rounded up to a power of two.
+     */
+    explicit CommandQueue(std::size_t capacity = 1024);
+
+    CommandQueue(const CommandQueue &) = delete;
+    CommandQueue &operator=(const CommandQueue &) = delete;
+
+    /**
+     * @brief Adds a command to the queue. Safe to call from any thread.
+     *
+     * A command whose receive time was left at its default is stamped with
+     * the current time, so it is never recorded at the epoch.
+     *
+     * @param command The command to queue.
+     * @return true if the command was queued, false if the queue is full.
+     */
+    bool tryPush(ExamCommand command);
+
+    /**
+     * @brief Moves up to maxCount commands into out, oldest first.
+     *
+     * Must only be called from the single consumer thread.
+     *
+     * @param out Receives the commands; existing contents are kept.
+     * @param maxCount Largest number of commands to take.
+     * @return The number of commands taken.
+     */
+    std::size_t popBatch(std::vector<ExamCommand> &out, std::size_t maxCount);
+
+    /**
+     * @brief Blocks the consumer until a command arrives, wake() is called or the timeout passes.
+     *
+     * @param timeout Longest time to wait.
+     * @return true if the queue is not empty.
+     */
+    bool waitForCommands(std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Wakes a consumer blocked in waitForCommands().
+     */
+    void wake();
+
+    /**
+     * @brief Retrieves the number of queued commands.
+     *
+     * The value is exact only when no thread is pushing or popping.
+     *
+     * @return The current queue depth.
+     */
+    std::size_t depth() const;
+
+    /**
+     * @brief Retrieves the maximum number of queued commands.
+     *
+     * @return The capacity of the ring.
+     */
+    std::size_t capacity() const;
+
+    /**
+     * @brief Retrieves the deepest the queue has been since it was created.
+     *
+     * @return The high-water mark.
+     */
+    std::size_t getHighWater() const;
+
+    /**
+     * @brief Retrieves the number of commands accepted since the queue was created.
+     *
+     * @return The accepted count.
+     */
+    std::uint64_t getPushedCount() const;
+
+    /**
+     * @brief Retrieves the number of commands refused because the queue was full.
+     *
+     * @return The rejected count.
+     */
+    std::uint64_t getRejectedCount() const;
+};
+
+#endif // COMMANDQUEUE_H
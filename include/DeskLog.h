@@ -0,0 +1,121 @@
+/**
+ * @file DeskLog.h
+ * @brief Definition of the DeskLog class.
+ *
+ * This file defines the DeskLog class, the human-readable log of everything
+ * that happens at an invigilation desk. Exam events are queued as they are
+ * applied, without formatting or touching the file, and a background thread
+ * formats and writes them, so a slow disk never holds up a station. Event
+ * lines are stamped with the time of the event, other lines with the time
+ * they were queued.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#ifndef DESKLOG_H
+#define DESKLOG_H
+
+#include "ExamEvent.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class DeskLog {
+private:
+    // One queued line: an event to describe, or text that is already formatted
+    struct Entry {
+        std::uint32_t source;                          // Position in sources
+        std::chrono::system_clock::time_point at;      // When the event happened, or when the text was queued
+        bool isEvent;
+        ExamEvent event;
+        std::string text;                              // Incident message, or the whole line
+    };
+
+    std::ofstream file;
+    std::vector<std::string> sources;   // Exam keys lines are tagged with; never shrinks
+    std::vector<Entry> pending;         // Queued lines not yet taken by the writer
+    std::uint64_t queuedCount;          // Lines queued so far
+    std::uint64_t writtenCount;         // Lines written so far
+    bool stopping;
+    std::mutex lock;
+    std::condition_variable wakeWriter;
+    std::condition_variable written;
+    std::thread writer;
+
+    void writerLoop();
+    void queue(std::uint32_t source, std::chrono::system_clock::time_point at, bool isEvent,
+               const ExamEvent &event, const std::string &text);
+
+public:
+    static constexpr std::size_t DEFAULT_CAPACITY = 4096;
+
+    /**
+     * @brief Opens the log for appending and starts the writer thread.
+     *
+     * @param path Location of the log file.
+     * @param capacity Lines that can be queued before the queue has to grow.
+     */
+    explicit DeskLog(const std::string &path, std::size_t capacity = DEFAULT_CAPACITY);
+
+    /**
+     * @brief Writes every queued line, then stops the writer.
+     */
+    ~DeskLog();
+
+    DeskLog(const DeskLog &) = delete;
+    DeskLog &operator=(const DeskLog &) = delete;
+
+    /**
+     * @brief Retrieves the number that tags the lines of an exam.
+     *
+     * @param key The exam key; empty for lines about the desk itself.
+     * @return The source number, the same every time for the same key.
+     */
+    std::uint32_t addSource(const std::string &key);
+
+    /**
+     * @brief Queues the description of an exam event.
+     *
+     * The line is stamped with the time of the event, not the time it is
+     * queued, so an event applied late still shows when it happened.
+     * Called while the exam's locks are held. Nothing is formatted and,
+     * apart from an incident message, nothing is allocated while fewer lines
+     * than the capacity are waiting.
+     *
+     * @param source The number from addSource() for the exam.
+     * @param event The event.
+     * @param message The incident message, empty for other events.
+     */
+    void post(std::uint32_t source, const ExamEvent &event, const std::string &message);
+
+    /**
+     * @brief Queues a line of text, stamped with the current time.
+     *
+     * @param source The number from addSource().
+     * @param text The line, without its time stamp and key.
+     */
+    void write(std::uint32_t source, const std::string &text);
+
+    /**
+     * @brief Blocks until every line queued so far is in the file.
+     */
+    void flush();
+
+    /**
+     * @brief Formats the description of an exam event.
+     *
+     * @param event The event.
+     * @param message The incident message, empty for other events.
+     * @return The description, e.g. "student 5: left for break".
+     */
+    static std::string describe(const ExamEvent &event, const std::string &message);
+};
+
+#endif // DESKLOG_H
@@ -18,19 +18,103 @@
 
 #include "Student.h"
 #include "Proctor.h"
+#include "SeatAllocator.h"
+#include "RosterColumns.h"
+#include "ExamStats.h"
+#include "ExamEventLog.h"
+#include "IncidentStore.h"
 #include <string>
 #include <vector>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <chrono>
+#include <functional>
+#include <unordered_map>
 
+/**
+ * @brief Outcome for one student ID in a batch call.
+ */
+enum class BatchStatus {
+    CheckedIn,           // Seat and version assigned
+    Submitted,           // Exam marked as submitted
+    BreakStarted,        // Student left for a break
+    BreakEnded,          // Student returned from a break
+    NotFound,            // ID is not on the roster
+    AlreadyDone,         // Already checked in or already submitted
+    Ineligible,          // Not checked in, or already submitted, for this action
+    NoSeat,              // The room is full
+    OutsideBreakWindow,  // Breaks are not allowed at the batch timestamp
+    Logged               // Incident recorded
+};
+
+/**
+ * @brief Per-ID result returned by the batch entry points of Exam.
+ */
+struct BatchResult {
+    int studentID;
+    BatchStatus status;
+};
+
+/**
+ * @brief A copy of one student's state, taken under their lock.
+ *
+ * Threads that read while stations are running, such as the UI beside the
+ * command applier, keep this instead of a Student pointer.
+ */
+struct StudentStatus {
+    int studentID = 0;
+    std::string name;
+    std::string DOB;
+    std::string picURL;
+    std::string seatNum;   // Printable seat, as Student::getSeatNum() formats it
+    int seatRow = -1;      // -1 until a seat is assigned
+    int seatCol = -1;
+    int examVersion = 0;
+    bool attended = false;
+    bool submitted = false;
+    bool onBreak = false;
+};
+
+/**
+ * Exam is safe to drive from several check-in stations at once through its
+ * check-in, break, submission, seat and incident entry points. Students are
+ * guarded by a fixed set of sharded locks keyed by roster position, the seat
+ * allocator and the break list each have their own lock, and the counters are
+ * atomic. Lock order is student shard, then seat or break lock.
+ *
+ * Every state change is recorded as an ExamEvent in the exam's event log and
+ * applied through one apply step, so replaying the log into a freshly loaded
+ * Exam rebuilds the same state.
+ *
+ * ExamSnapshot reads and restores the whole state directly, holding every
+ * lock while it captures so the snapshot matches one point in the event log.
+ *
+ * The roster itself (addStudent, addProctor, rebuildIndex, setters and
+ * initializeSeatMap) must be set up before stations start and is not guarded.
+ * Student pointers handed out by the getters are not locked either, so they
+ * should only be read while stations are idle or from a single thread.
+ * Threads that read while stations are running use readStudent() and
+ * readStudentAtSeat(), which copy a student under their lock, and
+ * generateReport() holds every lock while it writes.
+ */
 class Exam {
+    friend class ExamSnapshot;
+
 private:
+    static constexpr std::size_t STUDENT_LOCK_SHARDS = 64;
+
     std::string examData_URL;
     int termNum;
     std::string termName;
     std::string courseNum;
     std::string rmNum;
     int capacity;
-    std::vector<std::vector<bool> > seatMap;
+    SeatAllocator seatMap;
+    std::vector<int> seatOccupant;  // Row-major seat -> position in students (-1 if nobody sits there)
+    std::mutex seatLock;            // Guards seatMap and seatOccupant
+    std::vector<std::uint8_t> seatVersion;   // Row-major seat -> position in versionsCode; fixed once the layout is set
     int maxRow;
     int maxCol;
     int numVersions;
@@ -38,11 +122,57 @@ private:
     std::chrono::system_clock::time_point startTime;
     std::chrono::system_clock::time_point endTime;
     std::string examReport_URL;
+    std::shared_ptr<StringPool> strings;       // Names, dates of birth and photo paths of the roster
+    std::shared_ptr<BreakLog> breakLog;        // Every break of every student on the roster
     std::vector<Student> students;
     std::vector<Proctor> proctors;
-    std::vector<std::string> incidentReport;
-    std::vector<int> studentsInBreak;
-    int totalPresent;
+    std::unordered_map<int, std::size_t> studentIndex;  // Student ID -> position in students
+    std::unordered_map<int, std::size_t> proctorIndex;  // Proctor ID -> position in proctors
+    IncidentStore incidents;
+    mutable std::mutex incidentLock;           // Guards incidents
+    std::vector<std::size_t> studentsInBreak;  // Positions in students of everyone currently out
+    std::vector<int> breakSlot;                // Per student: position in studentsInBreak, or -1
+    mutable std::mutex breakLock;              // Guards studentsInBreak and breakSlot
+    mutable std::array<std::mutex, STUDENT_LOCK_SHARDS> studentLocks;  // Student i is guarded by shard i % STUDENT_LOCK_SHARDS
+    ExamCounters stats;        // Live counters, updated by every state change
+    RosterColumns columns;     // Struct-of-arrays mirror of the roster used for summary scans
+    bool columnarEnabled;
+    ExamEventLog eventLog;     // Every state change since the roster was loaded, in order
+
+    // Counts and events a batch holds back until every student in it has been changed
+    struct PendingBatch {
+        ExamCounters counts;
+        std::vector<ExamEvent> events;
+
+        PendingBatch(std::size_t numVersions, std::size_t numEvents) {
+            counts.resetVersions(numVersions);
+            events.reserve(numEvents);
+        }
+    };
+
+    std::size_t seatSlot(int row, int col) const;
+    std::mutex &studentLock(std::size_t index) const;
+    bool onBreakAt(std::size_t index) const;
+    void readStatusAt(std::size_t index, StudentStatus &out) const;
+    std::vector<std::unique_lock<std::mutex>> lockAll();
+    std::vector<std::unique_lock<std::mutex>> lockShards(const std::vector<std::size_t> &indices);
+    void startBreakAt(std::size_t index, std::chrono::system_clock::time_point at);
+    void endBreakAt(std::size_t index, std::chrono::system_clock::time_point at);
+    BatchStatus toggleBreakAt(std::size_t index, std::chrono::system_clock::time_point at,
+                              PendingBatch *batch = nullptr);
+    BatchStatus trySubmitAt(std::size_t index, std::chrono::system_clock::time_point at,
+                            PendingBatch *batch = nullptr);
+    bool submitAt(std::size_t index, std::chrono::system_clock::time_point at, PendingBatch *batch = nullptr);
+    bool applyEvent(const ExamEvent &event, std::size_t index, const std::string &message = std::string());
+    bool applyOrHold(const ExamEvent &event, std::size_t index, PendingBatch *batch);
+    void applyStudentEvent(const ExamEvent &event, std::size_t index, ExamCounters &counts);
+    void commitBatch(PendingBatch &batch);
+    bool replayEvent(const ExamEvent &event, const std::string &message);
+    int versionFor(int row, int col) const;
+    void planVersions();
+    bool breakWindowOpen(std::chrono::system_clock::time_point at) const;
+    void syncColumns(const Student *s);
+    int versionSlot(int versionCode) const;
 
 public:
     /**
@@ -74,6 +204,25 @@ public:
      */
     void addStudent(const Student &s);
 
+    /**
+     * @brief Reserves room for the expected roster size.
+     *
+     * Called by the loader before rows are parsed so the roster vectors and the
+     * ID index do not reallocate or rehash while a large file is loaded.
+     *
+     * @param numStudents Expected number of students.
+     * @param numProctors Expected number of proctors.
+     */
+    void reserveRoster(std::size_t numStudents, std::size_t numProctors = 0);
+
+    /**
+     * @brief Rebuilds the ID index from the current student and proctor lists.
+     *
+     * Only needed if the vectors returned by getStudents() or getProctors()
+     * were modified directly; addStudent() and addProctor() keep it up to date.
+     */
+    void rebuildIndex();
+
     /**
      * @brief Sets the URL for exam data resources.
      *
@@ -84,10 +233,96 @@ public:
     /**
      * @brief Initializes the seat map for student seating assignments.
      *
-     * This function sets up the seating layout according to the exam configuration.
+     * This function sets up the seating layout according to the exam configuration
+     * and plans the exam version of every seat, so no seat shares a version with
+     * the seats in front, behind, left or right of it. With four or more versions
+     * diagonal neighbours differ too. The rows, columns and version codes must be
+     * set first.
      */
     void initializeSeatMap();
 
+    /**
+     * @brief Frees a seat so the allocator can hand it out again.
+     *
+     * Used for seats that were reserved as a block. Seats held by a student are
+     * freed through undoCheckIn() or moveStudent() instead.
+     *
+     * @param row Zero-based row of the seat.
+     * @param col Zero-based column of the seat.
+     * @return true if the seat was taken by no student and is now free.
+     */
+    bool releaseSeat(int row, int col);
+
+    /**
+     * @brief Reserves a block of adjacent free seats in one row.
+     *
+     * Reserved seats are skipped by check-in until they are released.
+     *
+     * @param length Number of adjacent seats to reserve.
+     * @param row Receives the zero-based row of the block.
+     * @param col Receives the zero-based column of the first seat.
+     * @return true if a block was reserved.
+     */
+    bool reserveSeatBlock(int length, int &row, int &col);
+
+    /**
+     * @brief Retrieves the seat allocator of the exam room.
+     *
+     * @return A const reference to the seat allocator.
+     */
+    const SeatAllocator &getSeatAllocator() const;
+
+    /**
+     * @brief Retrieves the student sitting in a seat.
+     *
+     * @param row Zero-based row of the seat.
+     * @param col Zero-based column of the seat.
+     * @return A pointer to the Student in that seat, or nullptr if it is free or reserved.
+     */
+    Student *getStudentAtSeat(int row, int col);
+
+    /**
+     * @brief Copies the state of the student sitting in a seat.
+     *
+     * Safe to call while stations are running.
+     *
+     * @param row Zero-based row of the seat.
+     * @param col Zero-based column of the seat.
+     * @param out Receives the student's state.
+     * @return false if the seat is outside the room, free or reserved.
+     */
+    bool readStudentAtSeat(int row, int col, StudentStatus &out);
+
+    /**
+     * @brief Retrieves the exam version planned for a seat.
+     *
+     * @param row Zero-based row of the seat.
+     * @param col Zero-based column of the seat.
+     * @return The version code handed out at that seat, or 0 if the seat is outside the room.
+     */
+    int getSeatVersion(int row, int col) const;
+
+    /**
+     * @brief Reverts a mistaken check-in.
+     *
+     * Frees the student's seat and clears their attendance and exam version.
+     * Students who are on a break or have submitted cannot be reverted.
+     *
+     * @param studentID The student to revert.
+     * @return true if the check-in was reverted.
+     */
+    bool undoCheckIn(int studentID);
+
+    /**
+     * @brief Moves a checked-in student to another free seat.
+     *
+     * @param studentID The student to move.
+     * @param row Zero-based row of the new seat.
+     * @param col Zero-based column of the new seat.
+     * @return true if the student was moved.
+     */
+    bool moveStudent(int studentID, int row, int col);
+
     /**
      * @brief Checks if a student with the specified ID exists in the exam session.
      * @author Allen Pan
@@ -131,9 +366,9 @@ public:
     /**
      * @brief Retrieves the term name of the exam
      *
-     * @return The term name as a string.
+     * @return A const reference to the term name.
      */
-    std::string getTermName() const;
+    const std::string &getTermName() const;
 
     /**
      * @brief Sets the term name of the exam.
@@ -145,9 +380,9 @@ public:
     /**
      * @brief Retrieves the course number of the exam
      *
-     * @return The course number as an int.
+     * @return A const reference to the course number.
      */
-    std::string getCourseNum() const;
+    const std::string &getCourseNum() const;
 
     /**
      * @brief Sets the course number of the exam.
@@ -159,9 +394,9 @@ public:
     /**
      * @brief Retrieves the room number of the exam
      *
-     * @return The room number as a string.
+     * @return A const reference to the room number.
      */
-    std::string getRmNum() const;
+    const std::string &getRmNum() const;
 
     /**
      * @brief Sets the room number of the exam.
@@ -229,9 +464,9 @@ public:
     /**
      * @brief Retrieves all the exam version codes
      *
-     * @return All the exam version as a vector of int.
+     * @return A const reference to the exam version codes.
      */
-    std::vector<int> getVersionsCode() const;
+    const std::vector<int> &getVersionsCode() const;
 
     /**
      * @brief Sets the exam version codes
@@ -275,6 +510,24 @@ public:
      */
     std::vector<Student> &getStudents();
 
+    /**
+     * @brief Retrieves the pool that holds the text of every student on the roster.
+     *
+     * Loaders build students in this pool; students added from elsewhere are moved into it.
+     *
+     * @return A const reference to the pool pointer.
+     */
+    const std::shared_ptr<StringPool> &getStringPool() const;
+
+    /**
+     * @brief Retrieves the log that holds the breaks of every student on the roster.
+     *
+     * Students added to the exam record their breaks here, in the order they start.
+     *
+     * @return A const reference to the log pointer.
+     */
+    const std::shared_ptr<BreakLog> &getBreakLog() const;
+
     /**
      * @brief Retrieves all the proctors of the exam.
      *
@@ -282,6 +535,16 @@ public:
      */
     std::vector<Proctor> &getProctors();
 
+    /**
+     * @brief Retrieves a snapshot of the live exam counters.
+     *
+     * The counters are kept up to date by check-in, breaks, submissions and
+     * incidents, so this is O(1) in the roster size.
+     *
+     * @return A copy of the current counters.
+     */
+    ExamStats getStats() const;
+
     /**
      * @brief Retrieves the real number of students showed up.
      *
@@ -297,19 +560,88 @@ public:
     void setTotalPresent(int totalPresent);
 
     /**
-     * @brief Retrieves every incident report during the exam.
+     * @brief Turns the columnar roster mirror on or off.
+     *
+     * When on, every state change is copied into parallel arrays and the count
+     * functions below scan those arrays. When off (the default), there is no
+     * mirror to keep up and the counts walk the Student objects instead. The
+     * desk and the report read the live counters from getStats(), so the mirror
+     * only pays off for callers that scan the whole roster often.
+     *
+     * @param enabled true to keep the columnar mirror.
+     */
+    void setColumnarRoster(bool enabled);
+
+    /**
+     * @brief Checks whether the columnar roster mirror is kept.
+     *
+     * @return true if the mirror is on.
+     */
+    bool isColumnarRoster() const;
+
+    /**
+     * @brief Retrieves the columnar roster mirror.
+     *
+     * Empty when the mirror is turned off.
+     *
+     * @return A const reference to the roster columns.
+     */
+    const RosterColumns &getRosterColumns() const;
+
+    /**
+     * @brief Counts the students who checked in.
      *
-     * @return The incident report as a vector of string.
+     * @return The number of present students.
      */
-    std::vector<std::string> getIncidentReport() const;
+    int countPresent() const;
+
+    /**
+     * @brief Counts the students who submitted.
+     *
+     * @return The number of submitted exams.
+     */
+    int countSubmitted() const;
+
+    /**
+     * @brief Counts the students who submitted before the exam end time.
+     *
+     * @return The number of early submissions.
+     */
+    int countEarlySubmissions() const;
+
+    /**
+     * @brief Counts every washroom break taken during the exam.
+     *
+     * @return The total number of breaks.
+     */
+    int countBreaks() const;
+
+    /**
+     * @brief Retrieves every incident logged during the exam.
+     *
+     * The store is not locked, so read it only while no station is logging
+     * incidents, such as once the exam is over; use copyIncidents() otherwise.
+     *
+     * @return A const reference to the incident store.
+     */
+    const IncidentStore &getIncidents() const;
+
+    /**
+     * @brief Copies every incident logged so far, in the order they were logged.
+     *
+     * Safe to call while stations are logging incidents.
+     *
+     * @return A copy of the incidents.
+     */
+    std::vector<Incident> copyIncidents() const;
 
     /**
      * @brief Gets the URL of the exam report.
      * @author Allen Pan
      *
-     * @return A string containing the URL where the exam report is stored.
+     * @return A const reference to the URL where the exam report is stored.
      */
-    std::string getReportURL() const;
+    const std::string &getReportURL() const;
 
     /**
      * @brief Retrieves a pointer to a student by their ID.
@@ -320,6 +652,25 @@ public:
      */
     Student *getStudentByID(int studentID);
 
+    /**
+     * @brief Copies the state of a student under their lock.
+     *
+     * Safe to call while stations are running.
+     *
+     * @param studentID The ID of the student to read.
+     * @param out Receives the student's state.
+     * @return false if the ID is not on the roster.
+     */
+    bool readStudent(int studentID, StudentStatus &out) const;
+
+    /**
+     * @brief Retrieves a pointer to a proctor by their ID.
+     *
+     * @param proctorID The ID of the proctor to retrieve.
+     * @return A pointer to the Proctor object if found, otherwise nullptr.
+     */
+    Proctor *getProctorByID(int proctorID);
+
 
     /**
      * @brief Checking in Students.
@@ -335,9 +686,113 @@ public:
      */
     std::string washroomBreak(int studentID);
 
+    /**
+     * @brief Starts or ends a washroom break without formatting a message.
+     *
+     * @param studentID The student having a break.
+     * @param at The time recorded for the break.
+     * @return BreakStarted, BreakEnded, OutsideBreakWindow, NotFound or Ineligible.
+     */
+    BatchStatus toggleBreak(int studentID, std::chrono::system_clock::time_point at);
+
+    /**
+     * @brief Formats the desk message for the outcome of a break request.
+     *
+     * @param studentID The student who requested the break.
+     * @param status The outcome returned by toggleBreak().
+     * @param at The time the request was made.
+     * @return The message.
+     */
+    std::string describeBreak(int studentID, BatchStatus status, std::chrono::system_clock::time_point at);
+
+    /**
+     * @brief Checks in a batch of students with one shared timestamp.
+     *
+     * Seats for the whole batch are taken in one pass over the seat bitmap.
+     * Each student is then recorded as an event of their own, so the counters
+     * and the event log listeners are updated once per student, as checkIn() does.
+     *
+     * @param studentIDs The students to check in, in queue order.
+     * @param at The time recorded for the batch.
+     * @return One result per ID, in the same order.
+     */
+    std::vector<BatchResult> checkInBatch(const std::vector<int> &studentIDs,
+                                          std::chrono::system_clock::time_point at);
+
+    /**
+     * @brief Checks in a batch of students, each at their own time.
+     *
+     * Works as the shared-timestamp overload, with each check-in recorded at
+     * the time its station received it.
+     *
+     * @param studentIDs The students to check in, in queue order.
+     * @param times The time recorded for each ID, in the same order.
+     * @return One result per ID, in the same order.
+     */
+    std::vector<BatchResult> checkInBatch(const std::vector<int> &studentIDs,
+                                          const std::vector<std::chrono::system_clock::time_point> &times);
+
+    /**
+     * @brief Toggles washroom breaks for a batch of students with one shared timestamp.
+     *
+     * Students out on a break return and everyone else leaves. IDs and the
+     * break window are checked for the whole batch first; the students left
+     * are then toggled in order while their shard locks are held together, so
+     * an ID that appears twice leaves and comes back. The counters move once
+     * for the batch, and its events are appended to the log in one burst
+     * before the locks are let go, so listeners and snapshots see all of the
+     * batch or none of it.
+     *
+     * @param studentIDs The students to toggle.
+     * @param at The time recorded for every break start or end in the batch.
+     * @return One result per ID, in the same order.
+     */
+    std::vector<BatchResult> toggleBreakBatch(const std::vector<int> &studentIDs,
+                                              std::chrono::system_clock::time_point at);
+
+    /**
+     * @brief Toggles washroom breaks for a batch of students, each at their own time.
+     *
+     * The break window is checked against each ID's own time.
+     *
+     * @param studentIDs The students to toggle.
+     * @param times The time recorded for each ID, in the same order.
+     * @return One result per ID, in the same order.
+     */
+    std::vector<BatchResult> toggleBreakBatch(const std::vector<int> &studentIDs,
+                                              const std::vector<std::chrono::system_clock::time_point> &times);
+
+    /**
+     * @brief Submits a batch of exams with one shared timestamp.
+     *
+     * Batched as toggleBreakBatch() is: IDs are checked first, then each
+     * student goes through the same checks as earlySubmission() with the
+     * batch's shard locks held, and the counters and the event log are
+     * updated once for the batch. A student out on a break has the break
+     * ended first, and an ID that appears twice is AlreadyDone the second time.
+     *
+     * @param studentIDs The students submitting.
+     * @param at The submission time recorded for the batch.
+     * @return One result per ID, in the same order.
+     */
+    std::vector<BatchResult> submitBatch(const std::vector<int> &studentIDs,
+                                         std::chrono::system_clock::time_point at);
+
+    /**
+     * @brief Submits a batch of exams, each at their own time.
+     *
+     * @param studentIDs The students submitting.
+     * @param times The submission time recorded for each ID, in the same order.
+     * @return One result per ID, in the same order.
+     */
+    std::vector<BatchResult> submitBatch(const std::vector<int> &studentIDs,
+                                         const std::vector<std::chrono::system_clock::time_point> &times);
+
     /**
      * @brief Submit a student's exam early
      *
+     * A student still out on a break has the break ended at the same time.
+     *
      * @param studentID The student submitting their exam early.
      * @return True if submission is recorded.
      */
@@ -346,9 +801,41 @@ public:
     /**
      * @brief Submit all remaining students' exam when the time ends.
      *
+     * Students with extra time whose own deadline has not passed keep writing.
+     * A student still on a break has the break ended first.
      */
     void endOfTimeSubmission();
 
+    /**
+     * @brief Retrieves the time a student must hand in by.
+     *
+     * @param studentID The student ID.
+     * @return The exam end time plus the student's extra time; the end time for unknown IDs.
+     */
+    std::chrono::system_clock::time_point getDeadline(int studentID) const;
+
+    /**
+     * @brief Submits every remaining student whose deadline has passed.
+     *
+     * Each submission is stamped with the student's own deadline, so a desk that
+     * catches up after being down records the time the student had to stop.
+     * A student still on a break has the break ended at the same time first.
+     *
+     * @param at The current time.
+     * @return The number of students submitted.
+     */
+    std::size_t submitDue(std::chrono::system_clock::time_point at);
+
+    /**
+     * @brief Submits one student at their deadline.
+     *
+     * A student still on a break has the break ended at the deadline first.
+     *
+     * @param studentID The student whose time is up.
+     * @return true if the student was checked in, had not submitted, and is now submitted.
+     */
+    bool submitAtDeadline(int studentID);
+
     void generateReport(const std::string &fileName);
 
     /**
@@ -357,10 +844,76 @@ public:
      * @param studentID The student that is involved in the incident
      * @param proctorID The proctor that reports the incident
      * @param incidentMsg Report of the incident
+     * @param category Kind of incident
+     */
+    void writeIncident(int studentID, int proctorID, const std::string &incidentMsg,
+                       IncidentCategory category = IncidentCategory::General);
+
+    /**
+     * @brief Log in an incident at the time it was reported rather than now
+     *
+     * @param studentID The student that is involved in the incident
+     * @param proctorID The proctor that reports the incident
+     * @param incidentMsg Report of the incident
+     * @param category Kind of incident
+     * @param at When the incident was reported
+     */
+    void writeIncident(int studentID, int proctorID, const std::string &incidentMsg, IncidentCategory category,
+                       std::chrono::system_clock::time_point at);
+
+    /**
+     * @brief Checks whether a student is currently on a washroom break.
+     *
+     * @param studentID The student to check.
+     * @return true if the student is out on a break.
      */
-    void writeIncident(int studentID, int proctorID, const std::string &incidentMsg);
     bool isOnBreak(int studentID) const;
 
+    /**
+     * @brief Retrieves the students who are currently on a washroom break.
+     *
+     * The list is unordered and holds positions in getStudents(). It is not
+     * locked, so read it only while no station is toggling breaks.
+     *
+     * @return A const reference to the list of positions.
+     */
+    const std::vector<std::size_t> &getStudentsOnBreak() const;
+
+    /**
+     * @brief Visits every student who is out on a washroom break right now.
+     *
+     * Safe to call while stations are toggling breaks. The break lock is held
+     * for the whole visit, so a break that starts or ends at the same time is
+     * either seen by the visit or happens after it. The visitor must not call
+     * back into the exam.
+     *
+     * @param visit Called with each student's ID and the time they left.
+     */
+    void forEachBreakInProgress(
+        const std::function<void(int studentID, std::chrono::system_clock::time_point leftAt)> &visit) const;
+
+    /**
+     * @brief Retrieves the log of every state change applied to this exam.
+     *
+     * Listeners added to the log are told about each event as it happens.
+     *
+     * @return A reference to the event log.
+     */
+    ExamEventLog &getEventLog();
+
+    /**
+     * @brief Rebuilds state by applying the events of another exam's log in order.
+     *
+     * Call on a freshly loaded exam with the same roster, room and versions,
+     * before any station has used it, or on an exam restored from a snapshot
+     * with `from` set to the snapshot's event sequence.
+     *
+     * @param source The log to replay.
+     * @param from Position in source of the first event to apply.
+     * @return true if every event was applied, false if some did not fit and were skipped.
+     */
+    bool replay(const ExamEventLog &source, std::size_t from = 0);
+
 
 };
 
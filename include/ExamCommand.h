@@ -0,0 +1,42 @@
+/**
+ * @file ExamCommand.h
+ * @brief Definition of the ExamCommand structure.
+ *
+ * This file defines ExamCommand, one typed request from an input station
+ * (card reader, camera, network station or the GUI) waiting to be applied to
+ * an Exam by the command applier. Each command names the session it is for,
+ * so what the desk happens to be showing never changes where it goes.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#ifndef EXAMCOMMAND_H
+#define EXAMCOMMAND_H
+
+#include "IncidentStore.h"
+#include <chrono>
+#include <string>
+
+/**
+ * @brief Kind of change an ExamCommand asks for.
+ */
+enum class ExamCommandType {
+    CheckIn,       // Check a student in and assign a seat
+    ToggleBreak,   // Start or end a washroom break
+    Submit,        // Submit a student's exam
+    Incident       // Log an incident against a student
+};
+
+struct ExamCommand {
+    ExamCommandType type = ExamCommandType::CheckIn;
+    std::string examKey;                            // Session the station serves; empty to route by student
+    int studentID = 0;
+    int proctorID = 0;                              // Incident only
+    std::string message;                            // Incident only
+    IncidentCategory category = IncidentCategory::General;   // Incident only
+    std::chrono::system_clock::time_point at;       // When the station received the input; stamped on push if left unset
+};
+
+#endif // EXAMCOMMAND_H
@@ -0,0 +1,100 @@
+/**
+ * @file ExamCommandApplier.h
+ * @brief Definition of the ExamCommandApplier class.
+ *
+ * This file defines the ExamCommandApplier class, the single consumer of a
+ * CommandQueue. It runs on its own thread, drains queued commands in batches,
+ * applies each to the exam it names through the batch entry points and
+ * reports every result back over Qt signals, so input stations never wait on
+ * the GUI.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#ifndef EXAMCOMMANDAPPLIER_H
+#define EXAMCOMMANDAPPLIER_H
+
+#include <QThread>
+#include <QMetaType>
+#include <QString>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+#include "Exam.h"
+#include "CommandQueue.h"
+#include "SessionManager.h"
+
+class ExamCommandApplier : public QThread {
+    Q_OBJECT
+
+public:
+    static constexpr std::size_t MAX_BATCH = 256;   // Most commands applied per drain
+
+    /**
+     * @brief Constructs an applier for the exams of a desk and its command queue.
+     *
+     * @param sessions Resolves the exam each command is for; must outlive the applier.
+     * @param queue The queue to drain; must outlive the applier.
+     * @param parent Optional parent object.
+     */
+    ExamCommandApplier(const SessionManager *sessions, CommandQueue *queue, QObject *parent = nullptr);
+
+    /**
+     * @brief Stops the thread and waits for it to finish.
+     */
+    ~ExamCommandApplier() override;
+
+    /**
+     * @brief Starts (or restarts after stop()) the applier thread.
+     */
+    void startApplying();
+
+    /**
+     * @brief Asks the thread to apply what is left in the queue and exit.
+     */
+    void stop();
+
+signals:
+    /**
+     * @brief Emitted once per applied command.
+     *
+     * @param examKey The session the command was applied to, or the key the
+     *        station sent if no open exam matched.
+     * @param type The kind of command.
+     * @param studentID The student the command was for.
+     * @param status The outcome.
+     */
+    void commandApplied(const QString &examKey, ExamCommandType type, int studentID, BatchStatus status);
+
+    /**
+     * @brief Emitted after every drained batch.
+     *
+     * @param depth Commands still waiting in the queue.
+     * @param highWater Deepest the queue has been.
+     * @param rejected Commands refused so far because the queue was full.
+     */
+    void queueStats(qulonglong depth, qulonglong highWater, qulonglong rejected);
+
+protected:
+    void run() override;
+
+private:
+    const SessionManager *sessions;
+    CommandQueue *queue;
+    std::atomic<bool> stopRequested;
+    std::vector<ExamCommand> batch;   // Reused between drains
+    std::vector<Exam *> targets;      // Exam of each command in batch, nullptr if none matched
+    std::vector<int> ids;             // Students of the current run
+    std::vector<std::chrono::system_clock::time_point> times;   // Receive time of each entry in ids
+
+    bool drainOnce();
+    void applyRun(std::size_t begin, std::size_t end);
+};
+
+Q_DECLARE_METATYPE(ExamCommandType)
+Q_DECLARE_METATYPE(BatchStatus)
+
+#endif // EXAMCOMMANDAPPLIER_H
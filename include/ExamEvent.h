@@ -0,0 +1,75 @@
+/**
+ * @file ExamEvent.h
+ * @brief Definition of the ExamEvent structure.
+ *
+ * This file defines ExamEvent, one timestamped change to an Exam. Every state
+ * change of a running exam is recorded as an event in its ExamEventLog, and
+ * replaying the events in order rebuilds the same state.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#ifndef EXAMEVENT_H
+#define EXAMEVENT_H
+
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @brief Kind of change an ExamEvent records.
+ */
+enum class ExamEventType : std::uint8_t {
+    CheckedIn = 1,    // arg0 = seat row, arg1 = seat column, arg2 = exam version
+    CheckInUndone,    // Seat and version cleared
+    StudentMoved,     // arg0 = new seat row, arg1 = new seat column
+    BreakStarted,
+    BreakEnded,
+    Submitted,
+    IncidentLogged    // arg0 = proctor ID, arg1 = message index in the event log, arg2 = IncidentCategory
+};
+
+struct ExamEvent {
+    std::int64_t atMicros;    // Microseconds since the system_clock epoch
+    std::int32_t studentID;
+    std::int32_t arg0;        // Meaning depends on type
+    std::int32_t arg1;
+    std::int32_t arg2;
+    ExamEventType type;
+
+    /**
+     * @brief Retrieves the time the event happened.
+     *
+     * @return The event time as a system_clock::time_point.
+     */
+    std::chrono::system_clock::time_point at() const {
+        return std::chrono::system_clock::time_point(
+            std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::microseconds(atMicros)));
+    }
+
+    /**
+     * @brief Builds an event with the given type, time and arguments.
+     *
+     * @param type The kind of change.
+     * @param at When it happened.
+     * @param studentID The student it applies to.
+     * @param arg0 First type-specific argument.
+     * @param arg1 Second type-specific argument.
+     * @param arg2 Third type-specific argument.
+     * @return The event.
+     */
+    static ExamEvent make(ExamEventType type, std::chrono::system_clock::time_point at, int studentID,
+                          int arg0 = 0, int arg1 = 0, int arg2 = 0) {
+        ExamEvent e;
+        e.atMicros = std::chrono::duration_cast<std::chrono::microseconds>(at.time_since_epoch()).count();
+        e.studentID = studentID;
+        e.arg0 = arg0;
+        e.arg1 = arg1;
+        e.arg2 = arg2;
+        e.type = type;
+        return e;
+    }
+};
+
+#endif // EXAMEVENT_H
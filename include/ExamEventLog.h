@@ -0,0 +1,158 @@
+/**
+ * @file ExamEventLog.h
+ * @brief Definition of the ExamEventLog class.
+ *
+ * This file defines the ExamEventLog class, the append-only record of every
+ * ExamEvent of an exam in the order it was applied. Incident messages are kept
+ * in a side table so the events themselves stay fixed-size. Listeners are told
+ * about each event as it is appended.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#ifndef EXAMEVENTLOG_H
+#define EXAMEVENTLOG_H
+
+#include "ExamEvent.h"
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+class ExamEventLog {
+public:
+    /**
+     * @brief Callback run for every appended event.
+     *
+     * The second argument is the incident message, empty for other events.
+     * Listeners run while the log is locked, so they see events in log order
+     * and must not call back into the log or the exam.
+     */
+    using Listener = std::function<void(const ExamEvent &, const std::string &)>;
+
+private:
+    mutable std::mutex lock;
+    std::vector<ExamEvent> events;
+    std::vector<std::string> messages;   // Incident messages, indexed by IncidentLogged arg1
+    std::vector<std::pair<std::size_t, Listener>> listeners;   // Keyed by the ID addListener() returned
+    std::size_t nextListenerID = 1;
+    std::size_t firstSequence = 0;       // Sequence number of events[0]; events before it live in a snapshot
+
+    std::size_t appendLocked(ExamEvent event, const std::string &message);
+
+public:
+    ExamEventLog() = default;
+    ExamEventLog(const ExamEventLog &) = delete;
+    ExamEventLog &operator=(const ExamEventLog &) = delete;
+
+    /**
+     * @brief Appends an event to the end of the log.
+     *
+     * For IncidentLogged events the message is stored in the side table and
+     * arg1 is set to its index.
+     *
+     * @param event The event to append.
+     * @param message The incident message, ignored for other event types.
+     * @return The position of the event in the log.
+     */
+    std::size_t append(ExamEvent event, const std::string &message = std::string());
+
+    /**
+     * @brief Appends a batch of events in one go.
+     *
+     * The log is locked once for the whole batch, so the events sit next to
+     * each other and every listener sees them as one burst, in order. Events
+     * carry no message; incidents go through append().
+     *
+     * @param batch The events to append, in order.
+     * @return The position of the first event in the log.
+     */
+    std::size_t appendBatch(const std::vector<ExamEvent> &batch);
+
+    /**
+     * @brief Registers a listener for events appended from now on.
+     *
+     * @param listener The callback to run.
+     * @return An ID to pass to removeListener().
+     */
+    std::size_t addListener(Listener listener);
+
+    /**
+     * @brief Unregisters a listener.
+     *
+     * Once this returns the listener is not running and will not run again.
+     *
+     * @param listenerID The ID addListener() returned.
+     */
+    void removeListener(std::size_t listenerID);
+
+    /**
+     * @brief Reserves room for the expected number of events.
+     *
+     * @param numEvents Expected number of events.
+     */
+    void reserve(std::size_t numEvents);
+
+    /**
+     * @brief Removes every event and message. Listeners are kept.
+     */
+    void clear();
+
+    /**
+     * @brief Starts the log part-way through an exam's history.
+     *
+     * Used when the exam was restored from a snapshot that already holds the
+     * first `sequence` events. Positions passed to at() and snapshot() are
+     * unchanged; only nextSequence() is offset.
+     *
+     * @param sequence Number of events that came before this log.
+     */
+    void setFirstSequence(std::size_t sequence);
+
+    /**
+     * @brief Retrieves the sequence number the next appended event will get.
+     *
+     * This counts every event of the exam, including those covered by a
+     * snapshot, so it matches the number of records in the exam's journal.
+     *
+     * @return The number of events applied to the exam so far.
+     */
+    std::size_t nextSequence() const;
+
+    /**
+     * @brief Retrieves the number of events in the log.
+     *
+     * @return The event count.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Retrieves one event.
+     *
+     * @param position Position of the event, less than size().
+     * @return A copy of the event.
+     */
+    ExamEvent at(std::size_t position) const;
+
+    /**
+     * @brief Retrieves the message of an IncidentLogged event.
+     *
+     * @param event An event from this log.
+     * @return The incident message, or an empty string for other events.
+     */
+    std::string messageFor(const ExamEvent &event) const;
+
+    /**
+     * @brief Copies a range of events out of the log.
+     *
+     * @param from Position of the first event to copy.
+     * @return The events from `from` to the end of the log.
+     */
+    std::vector<ExamEvent> snapshot(std::size_t from = 0) const;
+};
+
+#endif // EXAMEVENTLOG_H
@@ -0,0 +1,182 @@
+/**
+ * @file ExamJournal.h
+ * @brief Definition of the ExamJournal class.
+ *
+ * This file defines the ExamJournal class, an on-disk write-ahead journal of
+ * every ExamEvent of a running exam. Events are buffered and written by a
+ * background thread with group commit: one write and one fsync cover every
+ * event that arrived during the commit interval. After a crash the journal is
+ * replayed into a freshly loaded Exam to rebuild its state.
+ *
+ * File layout: an 8-byte magic, a format version, the exam data file path and
+ * a CRC, then one record per event as [length][CRC-32][payload]. A record that
+ * is cut short or fails its CRC ends the journal.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#ifndef EXAMJOURNAL_H
+#define EXAMJOURNAL_H
+
+#include "ExamEvent.h"
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+
+class Exam;
+
+/**
+ * @brief What was found in a journal file.
+ */
+struct JournalInfo {
+    bool found = false;             // The file exists and has a valid header
+    bool finished = false;          // The exam was closed normally; nothing to recover
+    std::string examDataPath;       // Data file the exam was loaded from
+    std::size_t events = 0;         // Valid event records
+    std::uint64_t validBytes = 0;   // Length of the file up to the last valid record
+    bool truncated = false;         // A torn or corrupt record was dropped from the end
+};
+
+class ExamJournal {
+private:
+    std::string path;
+    std::FILE *file;
+    std::chrono::milliseconds commitInterval;
+    std::size_t commitBytes;
+
+    std::mutex lock;
+    std::condition_variable wakeWriter;
+    std::condition_variable committed;
+    std::string pending;             // Encoded records not yet handed to the writer
+    std::uint64_t appendedCount;     // Records appended so far
+    std::uint64_t durableCount;      // Records written and fsynced so far
+    std::uint64_t syncCount;         // fsync calls made
+    bool flushRequested;
+    bool stopping;
+    bool failed;
+    std::thread writer;
+
+    Exam *attachedExam;
+    std::size_t listenerID;
+
+    void writerLoop();
+    void appendRecord(const std::string &payload);
+    void stopWriter();
+
+public:
+    static constexpr const char *DEFAULT_PATH = "exam.journal";
+    static constexpr std::uint32_t FORMAT_VERSION = 1;
+
+    /**
+     * @brief Constructs a journal that is not open yet.
+     *
+     * @param path Location of the journal file.
+     * @param commitInterval Longest time an event waits before it is fsynced.
+     * @param commitBytes Buffered bytes that trigger a commit before the interval ends.
+     */
+    explicit ExamJournal(const std::string &path = DEFAULT_PATH,
+                         std::chrono::milliseconds commitInterval = std::chrono::milliseconds(50),
+                         std::size_t commitBytes = 64 * 1024);
+
+    /**
+     * @brief Flushes pending events and closes the file without marking the exam finished.
+     */
+    ~ExamJournal();
+
+    ExamJournal(const ExamJournal &) = delete;
+    ExamJournal &operator=(const ExamJournal &) = delete;
+
+    /**
+     * @brief Opens the journal file and starts the writer thread.
+     *
+     * @param examDataPath Data file the exam was loaded from, stored in the header.
+     * @param resumeAt 0 to start a new journal; otherwise the validBytes of a
+     *                 recovered journal, which is cut back to that length and appended to.
+     * @return true if the file could be opened.
+     */
+    bool open(const std::string &examDataPath, std::uint64_t resumeAt = 0);
+
+    /**
+     * @brief Journals every event the exam applies from now on.
+     *
+     * @param exam The exam to follow; must outlive attach() until detach() or close().
+     */
+    void attach(Exam &exam);
+
+    /**
+     * @brief Stops following the attached exam.
+     */
+    void detach();
+
+    /**
+     * @brief Queues one event for the next group commit.
+     *
+     * @param event The event.
+     * @param message The incident message, empty for other events.
+     */
+    void record(const ExamEvent &event, const std::string &message);
+
+    /**
+     * @brief Blocks until every event recorded so far is on disk.
+     *
+     * @return false if a write or fsync failed.
+     */
+    bool flush();
+
+    /**
+     * @brief Flushes, detaches and closes the file.
+     *
+     * @param finished true to mark the exam as finished so it is not offered for recovery.
+     */
+    void close(bool finished);
+
+    /**
+     * @brief Checks whether the journal file is open for writing.
+     *
+     * @return true between a successful open() and close().
+     */
+    bool isOpen();
+
+    /**
+     * @brief Retrieves the number of fsync calls made so far.
+     *
+     * @return The fsync count.
+     */
+    std::uint64_t getSyncCount();
+
+    /**
+     * @brief Retrieves the number of records queued so far, including the finished marker.
+     *
+     * @return The record count.
+     */
+    std::uint64_t getRecordCount();
+
+    /**
+     * @brief Reads a journal's header and records without changing any exam.
+     *
+     * @param path Location of the journal file.
+     * @return What was found.
+     */
+    static JournalInfo inspect(const std::string &path = DEFAULT_PATH);
+
+    /**
+     * @brief Replays a journal into an exam loaded from the same data file.
+     *
+     * Records the exam already holds, counted by its event log's
+     * nextSequence(), are skipped, so an exam restored from a snapshot only
+     * replays the records written after the snapshot was taken.
+     *
+     * @param path Location of the journal file.
+     * @param exam A freshly loaded exam, or one restored from a snapshot of this journal.
+     * @return What was found; events is the number of records replayed.
+     */
+    static JournalInfo recover(const std::string &path, Exam &exam);
+};
+
+#endif // EXAMJOURNAL_H
@@ -0,0 +1,104 @@
+/**
+ * @file ExamStats.h
+ * @brief Definition of the ExamStats and ExamCounters structures.
+ *
+ * This file defines ExamStats, a snapshot of the live counters an Exam keeps
+ * up to date on every state change, and ExamCounters, the atomic counters the
+ * snapshot is taken from. Reading a snapshot never touches the roster, and a
+ * batch of changes adds its counts in one go.
+ *
+ * @author Allen Pan
+ * @version 1.1
+ * @date 2026-10-16
+ */
+
+#ifndef EXAMSTATS_H
+#define EXAMSTATS_H
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+struct ExamStats {
+    int checkedIn = 0;                  // Students currently checked in
+    int submitted = 0;                  // Exams submitted, early or at the end
+    int earlySubmitted = 0;             // Exams submitted before the end time
+    int onBreak = 0;                    // Students out on a washroom break right now
+    int totalBreaks = 0;                // Breaks started since the exam began
+    int incidents = 0;                  // Incidents logged
+    std::vector<int> breaksPerVersion;  // Breaks started, per entry of Exam::getVersionsCode()
+};
+
+/**
+ * @brief Live counters shared by every check-in station of an Exam.
+ *
+ * Each counter is updated with an atomic add, so stations never wait on
+ * each other to count. A snapshot is not taken atomically across counters.
+ */
+struct ExamCounters {
+    std::atomic<int> checkedIn{0};
+    std::atomic<int> submitted{0};
+    std::atomic<int> earlySubmitted{0};
+    std::atomic<int> onBreak{0};
+    std::atomic<int> totalBreaks{0};
+    std::atomic<int> incidents{0};
+    std::vector<std::atomic<int>> breaksPerVersion;
+
+    /**
+     * @brief Zeroes the per-version break counters and resizes them.
+     *
+     * Must not run while stations are recording breaks.
+     *
+     * @param numVersions Number of exam versions.
+     */
+    void resetVersions(std::size_t numVersions) {
+        breaksPerVersion = std::vector<std::atomic<int>>(numVersions);
+        for (auto &count : breaksPerVersion) count.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Adds counts gathered elsewhere, such as over a batch.
+     *
+     * Each counter moves with one atomic add, and counters the batch left
+     * at zero are not touched.
+     *
+     * @param delta The counts to add, with as many versions as these counters.
+     */
+    void add(const ExamCounters &delta) {
+        auto addTo = [](std::atomic<int> &counter, const std::atomic<int> &change) {
+            int value = change.load(std::memory_order_relaxed);
+            if (value != 0) counter.fetch_add(value, std::memory_order_relaxed);
+        };
+        addTo(checkedIn, delta.checkedIn);
+        addTo(submitted, delta.submitted);
+        addTo(earlySubmitted, delta.earlySubmitted);
+        addTo(onBreak, delta.onBreak);
+        addTo(totalBreaks, delta.totalBreaks);
+        addTo(incidents, delta.incidents);
+        for (std::size_t i = 0; i < breaksPerVersion.size() && i < delta.breaksPerVersion.size(); ++i) {
+            addTo(breaksPerVersion[i], delta.breaksPerVersion[i]);
+        }
+    }
+
+    /**
+     * @brief Copies the current counter values.
+     *
+     * @return A plain ExamStats snapshot.
+     */
+    ExamStats snapshot() const {
+        ExamStats stats;
+        stats.checkedIn = checkedIn.load(std::memory_order_relaxed);
+        stats.submitted = submitted.load(std::memory_order_relaxed);
+        stats.earlySubmitted = earlySubmitted.load(std::memory_order_relaxed);
+        stats.onBreak = onBreak.load(std::memory_order_relaxed);
+        stats.totalBreaks = totalBreaks.load(std::memory_order_relaxed);
+        stats.incidents = incidents.load(std::memory_order_relaxed);
+        stats.breaksPerVersion.reserve(breaksPerVersion.size());
+        for (const auto &count : breaksPerVersion) {
+            stats.breaksPerVersion.push_back(count.load(std::memory_order_relaxed));
+        }
+        return stats;
+    }
+};
+
+#endif // EXAMSTATS_H
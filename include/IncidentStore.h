@@ -0,0 +1,200 @@
+/**
+ * @file IncidentStore.h
+ * @brief Definition of the Incident structure and the IncidentStore and IncidentView classes.
+ *
+ * This file defines the incident records of an exam. Each incident is kept as
+ * a typed record (student, proctor, time, category and message) instead of a
+ * preformatted line, in a store indexed by student and by proctor. Lookups
+ * return views into the store, so the report dialog and the PDF read incidents
+ * in place however many were logged.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#ifndef INCIDENTSTORE_H
+#define INCIDENTSTORE_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Kind of incident, chosen by the proctor who logs it.
+ */
+enum class IncidentCategory : std::uint8_t {
+    General = 0,            // Anything not listed below
+    AcademicMisconduct,     // Copying, talking or other suspected cheating
+    UnauthorizedMaterial,   // Phone, notes or another item that is not allowed
+    Disruption,             // Behaviour that disturbs other students
+    Medical                 // Illness or injury
+};
+
+constexpr int INCIDENT_CATEGORY_COUNT = 5;
+
+/**
+ * @brief Retrieves the display name of a category.
+ *
+ * @param category The category.
+ * @return A name such as "Academic misconduct".
+ */
+const char *incidentCategoryName(IncidentCategory category);
+
+/**
+ * @brief Converts a stored category code, such as the arg2 of an event, to a category.
+ *
+ * @param code The code.
+ * @return The category, or General if the code is unknown.
+ */
+IncidentCategory incidentCategoryFromCode(int code);
+
+/**
+ * @brief One incident logged during an exam.
+ */
+struct Incident {
+    int studentID = 0;
+    int proctorID = 0;                           // Proctor who logged it
+    std::chrono::system_clock::time_point at;    // When it was logged
+    IncidentCategory category = IncidentCategory::General;
+    std::string message;
+
+    /**
+     * @brief Formats the incident as one line for reports.
+     *
+     * @return A line such as "Student: 7; Proctor: 90; Category: Medical; Message: Fainted".
+     */
+    std::string describe() const;
+};
+
+bool operator==(const Incident &a, const Incident &b);
+bool operator!=(const Incident &a, const Incident &b);
+
+/**
+ * @brief Read-only view of some of the incidents in a store, in the order they were logged.
+ *
+ * A view refers to the store and stays valid until the next incident is added.
+ */
+class IncidentView {
+private:
+    const std::vector<Incident> *records;
+    const std::vector<std::uint32_t> *positions;   // Positions in records
+
+public:
+    class iterator {
+    private:
+        const std::vector<Incident> *records;
+        const std::uint32_t *position;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Incident;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Incident *;
+        using reference = const Incident &;
+
+        iterator(const std::vector<Incident> *records, const std::uint32_t *position)
+            : records(records), position(position) {}
+        reference operator*() const { return (*records)[*position]; }
+        pointer operator->() const { return &(*records)[*position]; }
+        iterator &operator++() {
+            ++position;
+            return *this;
+        }
+        iterator operator++(int) {
+            iterator before = *this;
+            ++position;
+            return before;
+        }
+        bool operator==(const iterator &other) const { return position == other.position; }
+        bool operator!=(const iterator &other) const { return position != other.position; }
+    };
+
+    IncidentView(const std::vector<Incident> *records, const std::vector<std::uint32_t> *positions)
+        : records(records), positions(positions) {}
+
+    iterator begin() const { return iterator(records, positions->data()); }
+    iterator end() const { return iterator(records, positions->data() + positions->size()); }
+    std::size_t size() const { return positions->size(); }
+    bool empty() const { return positions->empty(); }
+    const Incident &operator[](std::size_t i) const { return (*records)[(*positions)[i]]; }
+};
+
+/**
+ * The store is not locked; Exam guards it with its incident lock.
+ */
+class IncidentStore {
+private:
+    std::vector<Incident> records;   // In the order they were logged
+    std::unordered_map<int, std::vector<std::uint32_t>> byStudent;   // Student ID -> positions in records
+    std::unordered_map<int, std::vector<std::uint32_t>> byProctor;   // Proctor ID -> positions in records
+    std::array<std::size_t, INCIDENT_CATEGORY_COUNT> categoryCounts{};
+
+    static IncidentView find(const std::vector<Incident> &records,
+                             const std::unordered_map<int, std::vector<std::uint32_t>> &index, int id);
+
+public:
+    /**
+     * @brief Adds an incident and indexes it.
+     *
+     * @param incident The incident.
+     */
+    void add(Incident incident);
+
+    /**
+     * @brief Removes every incident.
+     */
+    void clear();
+
+    /**
+     * @brief Retrieves the number of incidents.
+     *
+     * @return The number of incidents logged.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Checks whether no incident was logged.
+     *
+     * @return true if the store is empty.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Retrieves every incident.
+     *
+     * @return A const reference to the incidents, in the order they were logged.
+     */
+    const std::vector<Incident> &all() const;
+
+    /**
+     * @brief Retrieves the incidents involving a student.
+     *
+     * @param studentID The student.
+     * @return A view of the student's incidents; empty if there are none.
+     */
+    IncidentView forStudent(int studentID) const;
+
+    /**
+     * @brief Retrieves the incidents logged by a proctor.
+     *
+     * @param proctorID The proctor.
+     * @return A view of the proctor's incidents; empty if there are none.
+     */
+    IncidentView forProctor(int proctorID) const;
+
+    /**
+     * @brief Counts the incidents of one category.
+     *
+     * @param category The category.
+     * @return The number of incidents in it.
+     */
+    std::size_t countOf(IncidentCategory category) const;
+};
+
+#endif // INCIDENTSTORE_H
@@ -0,0 +1,71 @@
+/**
+ * @file MappedFile.h
+ * @brief Definition of the MappedFile class.
+ *
+ * This file defines the MappedFile class, a read-only view of a whole file.
+ * On POSIX systems the file is memory-mapped, so opening it costs the same no
+ * matter how large it is and pages are only read as they are touched. On
+ * Windows the file is read into memory instead.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+
+class MappedFile {
+private:
+    const char *bytes;
+    std::size_t length;
+#ifdef _WIN32
+    std::string buffer;   // Whole file contents; there is no mapping on Windows
+#endif
+
+public:
+    /**
+     * @brief Constructs a MappedFile with nothing open.
+     */
+    MappedFile();
+
+    /**
+     * @brief Unmaps the file if one is open.
+     */
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    /**
+     * @brief Maps a file for reading, closing any file mapped before.
+     *
+     * @param path Location of the file.
+     * @return true if the file exists and could be mapped.
+     */
+    bool open(const std::string &path);
+
+    /**
+     * @brief Unmaps the file.
+     */
+    void close();
+
+    /**
+     * @brief Retrieves the start of the file contents.
+     *
+     * @return A pointer to the first byte, or nullptr if nothing is open or the file is empty.
+     */
+    const char *data() const;
+
+    /**
+     * @brief Retrieves the length of the file.
+     *
+     * @return The number of bytes mapped.
+     */
+    std::size_t size() const;
+};
+
+#endif // MAPPEDFILE_H
@@ -12,7 +12,10 @@
 #include <string>
 #include <vector>
 #include "Student.h"
+#include "BreakLog.h"
 #include "Proctor.h"
+#include "ExamStats.h"
+#include "IncidentStore.h"
 
 /**
  * @class PDFReportGenerator
@@ -39,8 +42,10 @@ public:
      * @param startTimeStr The start time of the exam in string format (e.g., "13:30").
      * @param endTimeStr The end time of the exam in string format (e.g., "16:30").
      * @param students A list of Student objects participating in the exam.
+     * @param breaks The log holding the breaks of every student.
      * @param proctors A list of Proctor objects managing the exam session.
-     * @param incidentReport A list of incident descriptions recorded during the exam.
+     * @param incidents The incidents recorded during the exam, in the order they were logged.
+     * @param stats Snapshot of the exam counters used for the summary section.
      */
     static void generate(const std::string &fileName,
                          const std::string &courseNum,
@@ -51,7 +56,9 @@ public:
                          const std::string &startTimeStr,
                          const std::string &endTimeStr,
                          const std::vector<Student> &students,
-                         const std::vector<Proctor> &proctors, const std::vector<std::string> &incidentReport);
+                         const BreakLog &breaks,
+                         const std::vector<Proctor> &proctors, const std::vector<Incident> &incidents,
+                         const ExamStats &stats);
 };
 
 #endif
@@ -0,0 +1,100 @@
+/**
+ * @file PhotoCache.h
+ * @brief Definition of the PhotoCache class.
+ *
+ * This file defines the PhotoCache class, a size-bounded, least-recently-used
+ * cache of student photo files shared by every exam the desk has open. Photos
+ * are kept as raw file bytes, so the cache does not depend on Qt; the check-in
+ * dialog decodes them when a student is looked up.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#ifndef PHOTOCACHE_H
+#define PHOTOCACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+class ThreadPool;
+
+class PhotoCache {
+private:
+    struct Entry {
+        std::shared_ptr<const std::string> bytes;
+        std::list<std::string>::iterator recent;   // Position in recentOrder
+    };
+
+    std::size_t maxBytes;
+    std::size_t usedBytes;
+    std::unordered_map<std::string, Entry> entries;   // Photo path -> file contents
+    std::list<std::string> recentOrder;               // Most recently used first
+    std::uint64_t hits;
+    std::uint64_t misses;
+    mutable std::mutex lock;
+
+    void evictTo(std::size_t limit);
+
+public:
+    /**
+     * @brief Constructs an empty cache.
+     *
+     * @param maxBytes Most photo bytes kept at once.
+     */
+    explicit PhotoCache(std::size_t maxBytes);
+
+    /**
+     * @brief Retrieves a photo, reading the file on a miss.
+     *
+     * The file is read without holding the cache lock, so a slow disk only
+     * delays the caller that missed.
+     *
+     * @param path Location of the photo file.
+     * @return The file contents, or nullptr if the file could not be read.
+     */
+    std::shared_ptr<const std::string> get(const std::string &path);
+
+    /**
+     * @brief Reads photos into the cache on a thread pool.
+     *
+     * @param paths Locations of the photo files.
+     * @param pool Pool to run the reads on; the cache must outlive the queued tasks.
+     */
+    void prefetch(const std::vector<std::string> &paths, ThreadPool &pool);
+
+    /**
+     * @brief Drops every cached photo.
+     */
+    void clear();
+
+    /**
+     * @brief Retrieves the number of photo bytes currently cached.
+     *
+     * @return The cached byte count.
+     */
+    std::size_t getBytesUsed() const;
+
+    /**
+     * @brief Retrieves the number of lookups served from the cache.
+     *
+     * @return The hit count.
+     */
+    std::uint64_t getHitCount() const;
+
+    /**
+     * @brief Retrieves the number of lookups that had to read the file.
+     *
+     * @return The miss count.
+     */
+    std::uint64_t getMissCount() const;
+};
+
+#endif // PHOTOCACHE_H
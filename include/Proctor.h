@@ -19,7 +19,7 @@ class Proctor : public User {
 private:
     // Role of the proctor
     // Pick from ONLY: "TA", "Course_Instructor" for now
-    std::string role;
+    std::string_view role;   // Held in the user's string pool
 
 public:
     /**
@@ -33,22 +33,24 @@ public:
      * @param DOB The date of birth of the proctor.
      * @param pic_URL The URL of the proctor's profile picture.
      * @param role The role assigned to the proctor.
+     * @param pool Pool that holds the text, usually the exam's; a standalone proctor gets its own.
      */
-    Proctor(int ID, const std::string &name, const std::string &DOB, const std::string &pic_URL, const std::string &role);
+    Proctor(int ID, std::string_view name, std::string_view DOB, std::string_view pic_URL, std::string_view role,
+            std::shared_ptr<StringPool> pool = nullptr);
 
     /**
      * @brief Retrieves the role of the proctor.
      *
-     * @return A string representing the role of the proctor.
+     * @return A view of the role of the proctor, valid while the proctor is.
      */
-    std::string getRole() const;
+    std::string_view getRole() const;
 
     /**
      * @brief Sets the role of the proctor.
      *
      * @param role The new role to be assigned to the proctor.
      */
-    void setRole(const std::string &role);
+    void setRole(std::string_view role);
 };
 
 #endif // PROCTOR_H
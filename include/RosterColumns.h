@@ -0,0 +1,150 @@
+/**
+ * @file RosterColumns.h
+ * @brief Definition of the RosterColumns class.
+ *
+ * This file defines the RosterColumns class, a struct-of-arrays copy of the
+ * per-student exam state. Each field lives in its own contiguous array so that
+ * passes over the whole roster only touch the bytes they need instead of
+ * walking full Student objects. An Exam keeps one only when asked to; the
+ * report dialog and PDF read the live counters instead.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-16
+ */
+
+#ifndef ROSTERCOLUMNS_H
+#define ROSTERCOLUMNS_H
+
+#include "Student.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class RosterColumns {
+private:
+    std::vector<int> ids;                 // Student IDs
+    std::vector<uint8_t> attended;        // 1 if checked in
+    std::vector<int64_t> submittedAt;     // Submission time in microseconds since epoch, 0 if not submitted
+    std::vector<int> versions;            // Exam version code, 0 if none
+    std::vector<int32_t> seats;           // (row << 16) | col, -1 if no seat
+    std::vector<uint16_t> breakCounts;    // Number of breaks taken
+
+public:
+    /**
+     * @brief Replaces the contents with a copy of the given roster.
+     *
+     * @param students The students to copy, in roster order.
+     */
+    void assign(const std::vector<Student> &students);
+
+    /**
+     * @brief Appends a row for a newly added student.
+     *
+     * @param s The student to append.
+     */
+    void append(const Student &s);
+
+    /**
+     * @brief Refreshes one row after the student's state changed.
+     *
+     * @param index Position of the student in the roster.
+     * @param s The student to copy from.
+     */
+    void update(std::size_t index, const Student &s);
+
+    /**
+     * @brief Reserves room for the expected roster size.
+     *
+     * @param count Expected number of students.
+     */
+    void reserve(std::size_t count);
+
+    /**
+     * @brief Removes every row.
+     */
+    void clear();
+
+    /**
+     * @brief Retrieves the number of rows.
+     *
+     * @return The number of students stored.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Counts the students who checked in.
+     *
+     * @return The number of present students.
+     */
+    int countAttended() const;
+
+    /**
+     * @brief Counts the students who submitted.
+     *
+     * @return The number of submitted exams.
+     */
+    int countSubmitted() const;
+
+    /**
+     * @brief Counts the students who submitted before a given time.
+     *
+     * Times are compared to the microsecond, as ExamStats::earlySubmitted does.
+     *
+     * @param deadline Submissions strictly before this time are counted.
+     * @return The number of early submissions.
+     */
+    int countSubmittedBefore(std::chrono::system_clock::time_point deadline) const;
+
+    /**
+     * @brief Sums the breaks taken by every student.
+     *
+     * @return The total number of breaks.
+     */
+    int countBreaks() const;
+
+    /**
+     * @brief Retrieves the ID column.
+     *
+     * @return A const reference to the student IDs in roster order.
+     */
+    const std::vector<int> &getIDs() const;
+
+    /**
+     * @brief Retrieves the attendance column.
+     *
+     * @return A const reference to the attendance flags in roster order.
+     */
+    const std::vector<uint8_t> &getAttendance() const;
+
+    /**
+     * @brief Retrieves the submission column.
+     *
+     * @return A const reference to the submission times (microseconds since epoch, 0 if none).
+     */
+    const std::vector<int64_t> &getSubmissionTimes() const;
+
+    /**
+     * @brief Retrieves the exam version column.
+     *
+     * @return A const reference to the version codes in roster order.
+     */
+    const std::vector<int> &getVersions() const;
+
+    /**
+     * @brief Retrieves the seat column.
+     *
+     * @return A const reference to the packed seats, (row << 16) | col or -1.
+     */
+    const std::vector<int32_t> &getSeats() const;
+
+    /**
+     * @brief Retrieves the break count column.
+     *
+     * @return A const reference to the break counts in roster order.
+     */
+    const std::vector<uint16_t> &getBreakCounts() const;
+};
+
+#endif // ROSTERCOLUMNS_H
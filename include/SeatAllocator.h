@@ -0,0 +1,140 @@
+/**
+ * @file SeatAllocator.h
+ * @brief Definition of the SeatAllocator class.
+ *
+ * This file defines the SeatAllocator class, which keeps track of free and taken
+ * seats in an exam room using packed per-row bitmaps. Free seats are found with
+ * find-first-zero scans over 64-bit words, so allocation cost depends on the
+ * number of words, not on how full the room already is.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-16
+ */
+
+#ifndef SEATALLOCATOR_H
+#define SEATALLOCATOR_H
+
+#include <cstdint>
+#include <vector>
+
+class SeatAllocator {
+private:
+    int rows;                         // Number of rows in the room
+    int cols;                         // Number of seats per row
+    int wordsPerRow;                  // 64-bit words used by one row
+    int takenCount;                   // Number of seats currently taken
+    std::vector<uint64_t> seatBits;   // Row-major bitmap, 1 = taken (padding bits are always 1)
+    std::vector<uint64_t> fullRows;   // Bit r set when row r has no free seat
+
+    uint64_t *rowWords(int row);
+    const uint64_t *rowWords(int row) const;
+    void markRowState(int row);
+    int findZeroRun(int row, int length) const;
+
+public:
+    /**
+     * @brief Constructs an empty allocator with no seats.
+     */
+    SeatAllocator();
+
+    /**
+     * @brief Constructs an allocator for a room of the given size with every seat free.
+     *
+     * @param rows Number of rows in the room.
+     * @param cols Number of seats per row.
+     */
+    SeatAllocator(int rows, int cols);
+
+    /**
+     * @brief Resizes the allocator and marks every seat as free.
+     *
+     * @param rows Number of rows in the room.
+     * @param cols Number of seats per row.
+     */
+    void reset(int rows, int cols);
+
+    /**
+     * @brief Takes the first free seat in row-major order.
+     *
+     * @param row Receives the zero-based row of the seat.
+     * @param col Receives the zero-based column of the seat.
+     * @return true if a seat was assigned, false if the room is full.
+     */
+    bool allocate(int &row, int &col);
+
+    /**
+     * @brief Takes up to `count` free seats in row-major order in a single pass.
+     *
+     * The scan continues from where the previous seat was found instead of
+     * starting over, so a batch of check-ins costs one sweep over the bitmap.
+     *
+     * @param count Number of seats wanted.
+     * @param rows Receives the zero-based rows of the seats taken.
+     * @param cols Receives the zero-based columns of the seats taken.
+     * @return The number of seats taken, which is less than count if the room filled up.
+     */
+    int allocateMany(int count, std::vector<int> &rows, std::vector<int> &cols);
+
+    /**
+     * @brief Takes a specific seat.
+     *
+     * @param row Zero-based row of the seat.
+     * @param col Zero-based column of the seat.
+     * @return true if the seat was free and is now taken, false otherwise.
+     */
+    bool reserve(int row, int col);
+
+    /**
+     * @brief Takes the first run of adjacent free seats in a single row.
+     *
+     * @param length Number of adjacent seats needed.
+     * @param row Receives the zero-based row of the block.
+     * @param col Receives the zero-based column of the first seat in the block.
+     * @return true if a block was found and taken, false otherwise.
+     */
+    bool reserveBlock(int length, int &row, int &col);
+
+    /**
+     * @brief Frees a seat so it can be assigned again.
+     *
+     * @param row Zero-based row of the seat.
+     * @param col Zero-based column of the seat.
+     * @return true if the seat was taken and is now free, false otherwise.
+     */
+    bool release(int row, int col);
+
+    /**
+     * @brief Checks whether a seat is taken.
+     *
+     * Out-of-range seats are reported as taken.
+     *
+     * @param row Zero-based row of the seat.
+     * @param col Zero-based column of the seat.
+     * @return true if the seat is taken or does not exist.
+     */
+    bool isTaken(int row, int col) const;
+
+    /**
+     * @brief Retrieves the number of rows.
+     *
+     * @return The number of rows as an int.
+     */
+    int getRows() const;
+
+    /**
+     * @brief Retrieves the number of seats per row.
+     *
+     * @return The number of columns as an int.
+     */
+    int getCols() const;
+
+    /**
+     * @brief Retrieves the number of free seats left.
+     *
+     * @return The number of free seats as an int.
+     */
+    int getFreeCount() const;
+};
+
+#endif // SEATALLOCATOR_H
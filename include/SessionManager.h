@@ -0,0 +1,278 @@
+/**
+ * @file SessionManager.h
+ * @brief Definition of the ExamSession structure and the SessionManager class.
+ *
+ * This file defines SessionManager, which lets one invigilation desk run
+ * several exams (one per course and room) in a single process. Each open exam
+ * is an ExamSession that owns its Exam and its journal. Everything else is
+ * shared by all sessions: one thread pool for snapshots and photo prefetching,
+ * one photo cache, one desk log, one student router that finds the exam of
+ * any swiped ID, and one timer wheel that submits every exam at its end time
+ * and every student with extra time at their own deadline. The same wheel
+ * drives a break monitor that flags students out on a break for too long. An
+ * extra exam therefore costs its roster, its event log and its journal, and no
+ * extra pool threads or caches.
+ *
+ * The session list is changed only from the UI thread. Stations may drive any
+ * open Exam concurrently as described in Exam.h.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#ifndef SESSIONMANAGER_H
+#define SESSIONMANAGER_H
+
+#include "BreakMonitor.h"
+#include "DeskLog.h"
+#include "Exam.h"
+#include "ExamJournal.h"
+#include "PhotoCache.h"
+#include "StudentRouter.h"
+#include "ThreadPool.h"
+#include "TimerWheel.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief One open exam and the files that belong to it.
+ */
+struct ExamSession {
+    std::string key;                       // Course and room, e.g. "CS3307-MC110"; unique among open sessions
+    std::string dataPath;                  // Data file the exam was loaded from
+    std::string journalPath;
+    std::string snapshotPath;
+    std::unique_ptr<Exam> exam;
+    std::unique_ptr<ExamJournal> journal;  // Not open if the journal file could not be created
+    std::size_t logListener = 0;           // Event log listener that queues events for the desk log
+    std::atomic<std::uint64_t> snapshotSequence{std::numeric_limits<std::uint64_t>::max()};   // Last snapshot written
+    std::atomic<bool> snapshotQueued{false};
+    std::vector<TimerWheel::TimerId> deadlineTimers;   // End of the exam and each extra-time deadline
+};
+
+class SessionManager {
+private:
+    std::string directory;   // Where journals, snapshots and the desk log are kept
+    PhotoCache photos;
+    StudentRouter router;    // Every student of every open exam
+    TimerWheel timers;       // Deadlines of every open exam
+    BreakMonitor breakMonitor{timers};   // Break timers of every open exam, on the same wheel
+    DeskLog deskLog;         // Written by its own thread, so logging never waits on the disk
+    ThreadPool pool;         // Declared after what its tasks use, so it is stopped first
+    std::vector<std::unique_ptr<ExamSession>> sessions;
+    mutable std::shared_mutex examsInUse;  // Held shared by station threads while they use exams from findExam()
+    std::size_t activeIndex;
+    std::size_t deadlineSubmissions = 0;   // Submitted by the timers during the current advanceDeadlines()
+
+    ExamSession *addSession(std::unique_ptr<Exam> exam, const std::string &dataPath,
+                            const std::string &journalPath, std::uint64_t resumeAt);
+    std::string pathFor(const std::string &key, const char *extension) const;
+    void scheduleDeadlines(ExamSession &session);
+
+public:
+    static constexpr std::size_t DEFAULT_PHOTO_CACHE_BYTES = 64 * 1024 * 1024;
+
+    /**
+     * @brief Constructs a manager with no open exams.
+     *
+     * @param directory Where journals, snapshots and the desk log are kept.
+     * @param workerThreads Threads in the shared pool.
+     * @param photoCacheBytes Most photo bytes cached across every exam.
+     */
+    explicit SessionManager(const std::string &directory = ".", std::size_t workerThreads = 2,
+                            std::size_t photoCacheBytes = DEFAULT_PHOTO_CACHE_BYTES);
+
+    /**
+     * @brief Closes every session.
+     *
+     * Exams past their end time are marked finished; journals of exams still
+     * running are left open for recovery.
+     */
+    ~SessionManager();
+
+    SessionManager(const SessionManager &) = delete;
+    SessionManager &operator=(const SessionManager &) = delete;
+
+    /**
+     * @brief Loads an exam data file into a new session and starts journaling it.
+     *
+     * The new session becomes the active one. Student photos are read into the
+     * shared cache in the background.
+     *
+     * @param dataPath The exam data file.
+     * @return The session, or nullptr if the file could not be loaded or an
+     *         exam for the same course and room is already open.
+     */
+    ExamSession *openExam(const std::string &dataPath);
+
+    /**
+     * @brief Rebuilds a session from a journal left behind by a crash.
+     *
+     * Uses the session's snapshot plus the journal tail when the snapshot
+     * matches the journal, and otherwise reloads the data file and replays the
+     * whole journal. The journal is appended to afterwards.
+     *
+     * @param journalPath A journal returned by findUnfinishedJournals().
+     * @return The session, or nullptr if the exam could not be rebuilt.
+     */
+    ExamSession *recoverExam(const std::string &journalPath);
+
+    /**
+     * @brief Lists journals in the manager's directory that were never closed.
+     *
+     * @return Paths of the unfinished journals.
+     */
+    std::vector<std::string> findUnfinishedJournals() const;
+
+    /**
+     * @brief Closes a session and releases its exam.
+     *
+     * The exam is first taken out of the router, so stations can no longer
+     * find it, and then the call waits until no station thread holds
+     * holdExams(). Only then is the exam released. Call from the UI thread,
+     * and never while holding holdExams().
+     *
+     * @param index Position of the session.
+     * @param finished true to mark the journal finished so it is not offered for recovery.
+     */
+    void closeSession(std::size_t index, bool finished);
+
+    /**
+     * @brief Retrieves the number of open sessions.
+     *
+     * @return The session count.
+     */
+    std::size_t getSessionCount() const;
+
+    /**
+     * @brief Retrieves one session.
+     *
+     * @param index Position of the session, less than getSessionCount().
+     * @return The session.
+     */
+    ExamSession *getSession(std::size_t index);
+
+    /**
+     * @brief Retrieves the session the desk is working on.
+     *
+     * @return The active session, or nullptr if none is open.
+     */
+    ExamSession *getActiveSession();
+
+    /**
+     * @brief Retrieves the position of the active session.
+     *
+     * @return The active index; meaningless when no session is open.
+     */
+    std::size_t getActiveIndex() const;
+
+    /**
+     * @brief Makes another open session the active one.
+     *
+     * @param index Position of the session.
+     * @return true if the index names an open session.
+     */
+    bool setActiveSession(std::size_t index);
+
+    /**
+     * @brief Finds the exam a station's input is meant for.
+     *
+     * Looks the exam up through the router, so it may be called from any
+     * thread, and never depends on which session the desk is showing.
+     *
+     * @param examKey Session key the station serves; empty to route by student.
+     * @param studentID The student the input is for.
+     * @param at When the station received the input.
+     * @return The exam, or nullptr if no open exam matches. The exam is only
+     *         guaranteed to stay open while holdExams() is held.
+     */
+    Exam *findExam(const std::string &examKey, int studentID, std::chrono::system_clock::time_point at) const;
+
+    /**
+     * @brief Keeps every open exam from being closed while a station thread uses it.
+     *
+     * Take this before findExam() and keep it until the exams found are no
+     * longer used. Holders do not block each other.
+     *
+     * @return A shared lock; closeSession() waits until it is released.
+     */
+    std::shared_lock<std::shared_mutex> holdExams() const;
+
+    /**
+     * @brief Queues a snapshot of every session that changed since its last one.
+     *
+     * Snapshots run on the shared pool; the journal of each exam is flushed
+     * before its snapshot replaces the previous one.
+     */
+    void snapshotAll();
+
+    /**
+     * @brief Submits the exams and students whose deadlines have passed, and flags overdue breaks.
+     *
+     * Called regularly by the desk, for example once a second from a UI timer.
+     *
+     * @param now The current time.
+     * @return The number of students submitted because their deadline passed.
+     */
+    std::size_t advanceDeadlines(std::chrono::system_clock::time_point now);
+
+    /**
+     * @brief Retrieves the monitor that flags overdue breaks in every open exam.
+     *
+     * Its alerts are written to the desk log. They are raised from advanceDeadlines().
+     *
+     * @return A reference to the monitor.
+     */
+    BreakMonitor &getBreakMonitor();
+
+    /**
+     * @brief Queues one line for the desk log.
+     *
+     * The line is stamped now and written by the desk log's own thread.
+     *
+     * @param key The session the line is about, or an empty string for the desk.
+     * @param message The text of the line.
+     */
+    void log(const std::string &key, const std::string &message);
+
+    /**
+     * @brief Retrieves the thread pool shared by every session.
+     *
+     * @return A reference to the pool.
+     */
+    ThreadPool &getThreadPool();
+
+    /**
+     * @brief Retrieves the index of every student in every open exam.
+     *
+     * @return A reference to the router.
+     */
+    StudentRouter &getRouter();
+
+    /**
+     * @brief Retrieves the photo cache shared by every session.
+     *
+     * @return A reference to the cache.
+     */
+    PhotoCache &getPhotoCache();
+
+    /**
+     * @brief Builds the session key of an exam from its course and room.
+     *
+     * Characters other than letters, digits and dashes become underscores, so the key
+     * can be used in file names.
+     *
+     * @param exam A loaded exam.
+     * @return The key.
+     */
+    static std::string sessionKey(const Exam &exam);
+};
+
+#endif // SESSIONMANAGER_H
@@ -0,0 +1,124 @@
+/**
+ * @file StringPool.h
+ * @brief Definition of the PooledPath structure and the StringPool class.
+ *
+ * This file defines StringPool, the per-exam store of roster text. Names,
+ * dates of birth, photo paths and roles are copied into a few large
+ * contiguous blocks instead of one heap allocation per field. Values that
+ * repeat across a roster, such as dates of birth and photo directories, are
+ * stored once and shared. A photo path is kept as its directory, shared by
+ * every student whose photo is in it, plus the file name.
+ *
+ * Users hold string views into the pool and a shared pointer that keeps it
+ * alive, so the text of a copied Student stays valid after its exam is gone.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#ifndef STRINGPOOL_H
+#define STRINGPOOL_H
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @brief A path stored as a shared directory and a file name.
+ */
+struct PooledPath {
+    std::string_view directory;   // Up to and including the last '/' or '\\'; may be empty
+    std::string_view file;
+
+    /**
+     * @brief Joins the directory and the file name.
+     *
+     * @return The full path.
+     */
+    std::string str() const {
+        std::string path;
+        path.reserve(directory.size() + file.size());
+        path.append(directory).append(file);
+        return path;
+    }
+
+    /**
+     * @brief Retrieves the length of the full path.
+     *
+     * @return The number of characters in the path.
+     */
+    std::size_t size() const { return directory.size() + file.size(); }
+};
+
+class StringPool {
+public:
+    static constexpr std::size_t FIRST_BLOCK_SIZE = 256;
+    static constexpr std::size_t MAX_BLOCK_SIZE = 64 * 1024;
+
+private:
+    std::vector<std::unique_ptr<char[]>> blocks;
+    std::size_t blockSize;      // Size of blocks.back()
+    std::size_t blockUsed;      // Bytes used in blocks.back()
+    std::size_t byteCount;      // Bytes used across every block
+    std::unordered_set<std::string_view> shared;   // Values stored once, viewed in the blocks
+    mutable std::mutex lock;    // Guards everything above
+
+    std::string_view copy(std::string_view text);
+
+public:
+    /**
+     * @brief Constructs an empty pool.
+     *
+     * The first block is small, so a pool used by a single standalone User
+     * stays cheap; blocks double up to MAX_BLOCK_SIZE as a roster is loaded.
+     */
+    StringPool();
+
+    StringPool(const StringPool &) = delete;
+    StringPool &operator=(const StringPool &) = delete;
+
+    /**
+     * @brief Copies a value that is unlikely to repeat, such as a name.
+     *
+     * @param text The value.
+     * @return A view of the copy, valid for the life of the pool.
+     */
+    std::string_view store(std::string_view text);
+
+    /**
+     * @brief Stores a value that is likely to repeat, such as a date of birth, once.
+     *
+     * @param text The value.
+     * @return A view of the shared copy, valid for the life of the pool.
+     */
+    std::string_view intern(std::string_view text);
+
+    /**
+     * @brief Stores a path as a shared directory and its own file name.
+     *
+     * @param path The path.
+     * @return Views of both parts, valid for the life of the pool.
+     */
+    PooledPath storePath(std::string_view path);
+
+    /**
+     * @brief Retrieves the number of bytes of text held.
+     *
+     * @return The bytes used in the pool's blocks.
+     */
+    std::size_t getByteCount() const;
+
+    /**
+     * @brief Retrieves the number of distinct shared values.
+     *
+     * @return The number of values stored by intern() and as path directories.
+     */
+    std::size_t getSharedCount() const;
+};
+
+#endif // STRINGPOOL_H
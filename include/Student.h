@@ -15,19 +15,33 @@
 #define STUDENT_H
 
 #include "User.h"
-#include "Break.h"
-#include <vector>
+#include "BreakLog.h"
+#include <chrono>
+#include <cstdint>
+#include <memory>
 
 class Student : public User {
 private:
-    std::string seatNum;          // Assigned seat number
-    int examVersion;              // Exam booklet version
-    bool isAttend;                // Attendance status
-    bool isSubmit;                // Exam submission status
-    std::vector<Break> breaks;    // Record of student's breaks
-    std::chrono::system_clock::time_point submissionTime;  // Student's submission time
+    // Packed so a roster scan touches as few cache lines as possible; the text sits in the exam's pool
+    static constexpr std::uint8_t ATTENDED = 1;    // State flag: checked in
+    static constexpr std::uint8_t SUBMITTED = 2;   // State flag: exam submitted
+
+    int examVersion;              // Exam booklet version; first, so it fits in the padding after User
+    std::chrono::system_clock::rep submittedAt;   // Submission time in clock ticks since the epoch
+    std::shared_ptr<BreakLog> breakLog;   // The exam's breaks, or the student's own until they join one
+    std::uint32_t firstBreak;     // Position of the student's first break in breakLog
+    std::uint32_t lastBreak;      // Position of the student's latest break in breakLog
+    std::int16_t seatRow;         // Assigned seat row, zero-based (-1 if none)
+    std::int16_t seatCol;         // Assigned seat column, zero-based (-1 if none)
+    std::uint16_t extraMinutes;   // Extra writing time granted as an accommodation
+    std::uint16_t breakCount;     // Breaks recorded in breakLog
+    std::uint8_t state;           // Lifecycle flags: ATTENDED, SUBMITTED
 
 public:
+    static constexpr std::size_t RESERVED_BREAKS = 2;   // Breaks per student an exam makes room for up front
+    static constexpr int MAX_SEAT_INDEX = INT16_MAX;     // Largest seat row or column a student can hold
+    static constexpr int MAX_EXTRA_MINUTES = UINT16_MAX; // Longest extra time a student can be granted
+
     /**
      * @brief Constructs a Student object with the specified attributes.
      *
@@ -41,22 +55,88 @@ public:
      * @param isAttend A boolean indicating whether the student is present.
      * @param isSubmit A boolean indicating whether the student has submitted the exam.
      */
-    Student(int ID, const std::string &name, const std::string &DOB, const std::string &pic_URL, bool isAttend = false, bool isSubmit = false);
+    Student(int ID, std::string_view name, std::string_view DOB, std::string_view pic_URL, bool isAttend = false, bool isSubmit = false);
 
     /**
-     * @brief Retrieves the student's seat number.
+     * @brief Constructs a Student whose text is held in a shared pool.
+     *
+     * Used by loaders, so every student of an exam shares the exam's pool.
      *
-     * @return A string representing the seat number of the student.
+     * @param ID The unique identifier of the student.
+     * @param name The name of the student.
+     * @param DOB The date of birth of the student.
+     * @param pic_URL The URL of the student's profile picture.
+     * @param pool The pool that holds the text.
      */
-    std::string getSeatNum() const;
+    Student(int ID, std::string_view name, std::string_view DOB, std::string_view pic_URL,
+            std::shared_ptr<StringPool> pool);
+
+    /**
+     * @brief Moves the student's text into a pool, such as the pool of the exam they join.
+     *
+     * @param pool The pool to use from now on.
+     */
+    void useStringPool(const std::shared_ptr<StringPool> &pool);
+
+    /**
+     * @brief Moves the student's breaks into a log, such as the log of the exam they join.
+     *
+     * Copies of a student share its log, so breaks should be recorded through
+     * the exam's own Student rather than through a copy.
+     *
+     * @param log The log to record breaks in from now on.
+     */
+    void useBreakLog(const std::shared_ptr<BreakLog> &log);
+
+    /**
+     * @brief Checks whether the student has been assigned a seat.
+     *
+     * @return true if a seat is assigned.
+     */
+    bool hasSeat() const;
+
+    /**
+     * @brief Retrieves the row of the student's seat.
+     *
+     * @return The zero-based row, or -1 if no seat is assigned.
+     */
+    int getSeatRow() const;
+
+    /**
+     * @brief Retrieves the column of the student's seat.
+     *
+     * @return The zero-based column, or -1 if no seat is assigned.
+     */
+    int getSeatCol() const;
+
+    /**
+     * @brief Assigns a seat to the student.
+     *
+     * @param row Zero-based row of the seat, at most MAX_SEAT_INDEX.
+     * @param col Zero-based column of the seat, at most MAX_SEAT_INDEX.
+     */
+    void setSeat(int row, int col);
+
+    /**
+     * @brief Removes the student's seat assignment.
+     */
+    void clearSeat();
 
     /**
-     * @brief Sets the seat number for the student.
+     * @brief Retrieves the student's seat formatted for display.
+     *
+     * The label is built on demand from the seat coordinates, e.g. "Row: 3\nColum: 7".
      *
-     * @param seat The seat number to assign to the student.
+     * @return The seat label, or an empty string if no seat is assigned.
      */
-    void setSeatNum(const std::string &seat);
+    std::string getSeatNum() const;
 
+    /**
+     * @brief Retrieves the student's seat in compact form for reports.
+     *
+     * @return The seat code such as "R3C7", or an empty string if no seat is assigned.
+     */
+    std::string getSeatCode() const;
 
     /**
      * @brief Retrieves the student's assigned exam version.
@@ -72,6 +152,21 @@ public:
      */
     void setExamVersion(int version);
 
+    /**
+     * @brief Retrieves the extra writing time granted to the student.
+     *
+     * @return The extra time; zero if the student writes until the exam ends.
+     */
+    std::chrono::minutes getExtraTime() const;
+
+    /**
+     * @brief Grants the student extra writing time past the end of the exam.
+     *
+     * @param extra The extra time; negative values are treated as zero and
+     *              longer ones are capped at MAX_EXTRA_MINUTES.
+     */
+    void setExtraTime(std::chrono::minutes extra);
+
     /**
      * @brief Retrieves the student's attendance status.
      *
@@ -89,11 +184,18 @@ public:
     /**
      * @brief Records the start of a washroom break.
      *
-     * This function creates a new Break object and adds it to the student's break records.
-     * The Break object automatically records the current system time as the start time.
+     * This function appends a break starting at the current system time to the
+     * student's break log. A student outside an exam gets a log of their own.
      */
     void leaveForBreak();
 
+    /**
+     * @brief Records the start of a washroom break at the given time.
+     *
+     * @param at The time the student left.
+     */
+    void leaveForBreak(std::chrono::system_clock::time_point at);
+
     /**
      * @brief Ends the last recorded break.
      *
@@ -102,14 +204,28 @@ public:
      */
     void returnFromBreak();
 
+    /**
+     * @brief Ends the last recorded break at the given time.
+     *
+     * @param at The time the student returned.
+     */
+    void returnFromBreak(std::chrono::system_clock::time_point at);
+
 
     /**
      * @brief Retrieves the list of breaks taken by the student.
      *
-     * @return A pointer to a vector containing the student's break records.
+     * @return A view of the student's breaks in the order they were taken.
      */
-    std::vector<Break>* getBreaksList();
+    BreakView getBreaksList() const;
+
 
+    /**
+     * @brief Retrieves the number of breaks the student has taken.
+     *
+     * @return The number of recorded breaks, including one in progress.
+     */
+    std::size_t getBreakCount() const;
 
     /**
      * @brief Submits the exam for the student.
@@ -118,6 +234,15 @@ public:
      */
     void submitExam();
 
+    /**
+     * @brief Submits the exam for the student at the given time.
+     *
+     * Used when many submissions share one timestamp, such as at the end of the exam.
+     *
+     * @param at The submission time to record.
+     */
+    void submitExam(std::chrono::system_clock::time_point at);
+
     /**
      * @brief Retrieves the student's exam submission status.
      *
@@ -131,6 +256,52 @@ public:
      * @return A string representing the submission time.
      */
     std::string getSubmissionTime() const;
+
+    /**
+     * @brief Retrieves the raw submission time point.
+     *
+     * Only meaningful once getSubmissionStatus() is true.
+     *
+     * @return The time the exam was submitted.
+     */
+    std::chrono::system_clock::time_point getSubmissionTimePoint() const;
 };
 
+// Roster scans read these for every student, so they are defined here to be inlined
+inline bool Student::hasSeat() const {
+    return seatRow >= 0 && seatCol >= 0;
+}
+
+inline int Student::getSeatRow() const {
+    return seatRow;
+}
+
+inline int Student::getSeatCol() const {
+    return seatCol;
+}
+
+inline int Student::getExamVersion() const {
+    return examVersion;
+}
+
+inline std::chrono::minutes Student::getExtraTime() const {
+    return std::chrono::minutes(extraMinutes);
+}
+
+inline bool Student::getAttendance() const {
+    return state & ATTENDED;
+}
+
+inline std::size_t Student::getBreakCount() const {
+    return breakCount;
+}
+
+inline bool Student::getSubmissionStatus() const {
+    return state & SUBMITTED;
+}
+
+inline std::chrono::system_clock::time_point Student::getSubmissionTimePoint() const {
+    return std::chrono::system_clock::time_point(std::chrono::system_clock::duration(submittedAt));
+}
+
 #endif // STUDENT_H
@@ -0,0 +1,148 @@
+/**
+ * @file StudentRouter.h
+ * @brief Definition of the StudentRoute structure and the StudentRouter class.
+ *
+ * This file defines StudentRouter, a campus-wide index from student ID to the
+ * exams the student is registered in. It spans every exam the desk has open,
+ * so a shared hallway station can tell a student which room to go to, or turn
+ * away an ID that belongs to no exam today. A Bloom filter sits in front of the
+ * hash index, and foreign IDs are usually rejected without a hash lookup.
+ *
+ * Lookups may run on any number of station threads while exams are added or
+ * removed. The rosters themselves must not change while they are indexed.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#ifndef STUDENTROUTER_H
+#define STUDENTROUTER_H
+
+#include "BloomFilter.h"
+#include "Exam.h"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Where and when a student writes one exam.
+ */
+struct StudentRoute {
+    std::string examKey;     // Session key of the exam, e.g. "CS3307-MC110"
+    std::string courseNum;
+    std::string room;
+    std::chrono::system_clock::time_point start;   // The sitting
+    std::chrono::system_clock::time_point end;
+    Exam *exam = nullptr;    // Valid until the exam is removed from the router
+};
+
+class StudentRouter {
+private:
+    // One registration; registrations of the same student are chained
+    struct Link {
+        std::uint32_t sitting;   // Position in sittings
+        std::uint32_t next;      // Next registration of the same student, or NO_LINK
+    };
+    static constexpr std::uint32_t NO_LINK = 0xFFFFFFFFu;
+
+    std::vector<StudentRoute> sittings;                  // One per indexed exam
+    std::vector<Link> links;
+    std::unordered_map<int, std::uint32_t> byStudent;    // Student ID -> first registration in links
+    BloomFilter filter;
+    mutable std::atomic<std::uint64_t> filterRejects;
+    mutable std::shared_mutex lock;
+
+    void indexExam(std::uint32_t sitting);
+    bool eraseSitting(const std::string &examKey);
+
+public:
+    /**
+     * @brief Constructs an empty router.
+     */
+    StudentRouter();
+
+    StudentRouter(const StudentRouter &) = delete;
+    StudentRouter &operator=(const StudentRouter &) = delete;
+
+    /**
+     * @brief Indexes every student registered in an exam.
+     *
+     * @param examKey Key the exam is known by; adding the same key again replaces the old entry.
+     * @param exam A loaded exam; must stay alive and keep its roster until it is removed.
+     */
+    void addExam(const std::string &examKey, Exam &exam);
+
+    /**
+     * @brief Drops an exam from the index.
+     *
+     * @param examKey Key the exam was added with.
+     * @return true if the exam was indexed.
+     */
+    bool removeExam(const std::string &examKey);
+
+    /**
+     * @brief Checks the Bloom filter only.
+     *
+     * @param studentID The swiped ID.
+     * @return false if the student is certainly in no indexed exam.
+     */
+    bool mightBeRegistered(int studentID) const;
+
+    /**
+     * @brief Finds the exam a student should be sent to.
+     *
+     * Picks the sitting running at the given time; otherwise the next one to
+     * start; otherwise the one that ended last.
+     *
+     * @param studentID The swiped ID.
+     * @param at The time of the swipe.
+     * @param found Receives the chosen exam.
+     * @return true if the student is registered in an indexed exam.
+     */
+    bool route(int studentID, std::chrono::system_clock::time_point at, StudentRoute &found) const;
+
+    /**
+     * @brief Lists every indexed exam a student is registered in.
+     *
+     * @param studentID The student ID.
+     * @return The student's sittings, earliest start first.
+     */
+    std::vector<StudentRoute> lookup(int studentID) const;
+
+    /**
+     * @brief Finds an indexed exam by its session key.
+     *
+     * @param examKey The session key, e.g. "CS3307-MC110".
+     * @return The exam, or nullptr if no exam with that key is indexed.
+     */
+    Exam *findExam(const std::string &examKey) const;
+
+    /**
+     * @brief Retrieves the number of distinct students indexed.
+     *
+     * @return The student count.
+     */
+    std::size_t getStudentCount() const;
+
+    /**
+     * @brief Retrieves the number of exams indexed.
+     *
+     * @return The exam count.
+     */
+    std::size_t getExamCount() const;
+
+    /**
+     * @brief Retrieves how many lookups the Bloom filter answered alone.
+     *
+     * @return The number of IDs turned away without a hash lookup.
+     */
+    std::uint64_t getFilterRejectCount() const;
+};
+
+#endif // STUDENTROUTER_H
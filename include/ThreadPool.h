@@ -0,0 +1,76 @@
+/**
+ * @file ThreadPool.h
+ * @brief Definition of the ThreadPool class.
+ *
+ * This file defines the ThreadPool class, a fixed set of worker threads that
+ * run queued tasks in order of submission. The session manager shares one pool
+ * between every open exam for background work such as snapshots and photo
+ * prefetching, so opening another exam does not start more threads.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> tasks;
+    std::mutex lock;
+    std::condition_variable taskReady;
+    std::condition_variable idle;
+    std::size_t running;   // Tasks taken off the queue and not finished yet
+    bool stopping;
+
+    void workerLoop();
+
+public:
+    /**
+     * @brief Starts the worker threads.
+     *
+     * @param numThreads Number of workers; at least one is started.
+     */
+    explicit ThreadPool(std::size_t numThreads);
+
+    /**
+     * @brief Runs every task already queued, then stops the workers.
+     */
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /**
+     * @brief Queues a task to run on one of the workers.
+     *
+     * Tasks must not throw.
+     *
+     * @param task The task.
+     */
+    void submit(std::function<void()> task);
+
+    /**
+     * @brief Blocks until the queue is empty and no task is running.
+     */
+    void waitIdle();
+
+    /**
+     * @brief Retrieves the number of worker threads.
+     *
+     * @return The worker count.
+     */
+    std::size_t size() const;
+};
+
+#endif // THREADPOOL_H
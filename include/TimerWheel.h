@@ -0,0 +1,116 @@
+/**
+ * @file TimerWheel.h
+ * @brief Definition of the TimerWheel class.
+ *
+ * This file defines TimerWheel, a hierarchical timing wheel for the deadlines
+ * of every open exam: the exam-wide end times and the later deadlines of
+ * students with extra time. Four levels of 64 slots cover about 194 days at
+ * one-second ticks. Scheduling and cancelling are O(1); advancing fires only
+ * the timers that are due, plus an occasional move of one slot down a level.
+ *
+ * The wheel does not run a thread of its own. Its owner calls advance()
+ * regularly, for example from a UI timer. Timers may be scheduled or
+ * cancelled from any thread, including from inside a callback.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#ifndef TIMERWHEEL_H
+#define TIMERWHEEL_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+class TimerWheel {
+public:
+    using Clock = std::chrono::system_clock;
+    using TimerId = std::uint64_t;
+    using Callback = std::function<void()>;
+
+    static constexpr TimerId NO_TIMER = 0;
+    static constexpr int LEVELS = 4;
+    static constexpr int SLOT_BITS = 6;
+    static constexpr int SLOTS = 1 << SLOT_BITS;
+
+private:
+    static constexpr std::uint32_t NIL = 0xFFFFFFFFu;
+
+    struct Timer {
+        std::int64_t expiry = 0;          // Tick the timer fires on
+        Callback callback;
+        std::uint32_t prev = NIL;         // Neighbours in the slot list
+        std::uint32_t next = NIL;
+        std::uint32_t generation = 1;     // Bumped on every reuse, so stale IDs are ignored
+        std::uint16_t slot = 0;           // Slot list the timer is on
+        bool active = false;
+    };
+
+    std::chrono::milliseconds tick;
+    Clock::time_point origin;             // Time of tick 0
+    std::int64_t nextTick;                // First tick not yet processed
+    std::vector<Timer> timers;            // Timer storage, reused through freeList
+    std::vector<std::uint32_t> freeList;
+    std::array<std::uint32_t, LEVELS * SLOTS> slots;   // Head of each slot list
+    std::size_t activeCount;
+    mutable std::mutex lock;
+
+    std::int64_t tickFor(Clock::time_point at) const;
+    void link(std::uint32_t index);
+    void unlink(std::uint32_t index);
+    void release(std::uint32_t index);
+    void cascade(int level);
+
+public:
+    /**
+     * @brief Constructs an empty wheel.
+     *
+     * @param tick Resolution of the wheel; timers fire at most one tick late.
+     * @param origin Time of the first tick.
+     */
+    explicit TimerWheel(std::chrono::milliseconds tick = std::chrono::seconds(1),
+                        Clock::time_point origin = Clock::now());
+
+    TimerWheel(const TimerWheel &) = delete;
+    TimerWheel &operator=(const TimerWheel &) = delete;
+
+    /**
+     * @brief Schedules a callback.
+     *
+     * @param deadline When the callback is due; a deadline already past fires on the next tick.
+     * @param callback Runs on the thread that calls advance(), without the wheel's lock held.
+     * @return An ID for cancel(); never NO_TIMER.
+     */
+    TimerId schedule(Clock::time_point deadline, Callback callback);
+
+    /**
+     * @brief Cancels a timer that has not fired yet.
+     *
+     * @param id The ID returned by schedule().
+     * @return true if the timer was pending and will not fire.
+     */
+    bool cancel(TimerId id);
+
+    /**
+     * @brief Fires every timer due at or before a time.
+     *
+     * @param now The current time.
+     * @return The number of callbacks run.
+     */
+    std::size_t advance(Clock::time_point now);
+
+    /**
+     * @brief Retrieves the number of pending timers.
+     *
+     * @return The pending timer count.
+     */
+    std::size_t size() const;
+};
+
+#endif // TIMERWHEEL_H
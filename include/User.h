@@ -14,14 +14,37 @@
 #ifndef USER_H
 #define USER_H
 
+#include "StringPool.h"
+#include <cstdint>
+#include <memory>
 #include <string>
+#include <string_view>
 
 class User {
 private:
-    int ID;                 // User's unique identifier
-    std::string name;       // User's name
-    std::string DOB;        // User's date of birth
-    std::string pic_URL;    // User's picture URL
+    // Text lives in the pool; each field is a pointer plus a 32-bit length so the views pack tightly
+    std::shared_ptr<StringPool> strings;   // Holds the text pointed to below
+    const char *name;           // User's name
+    const char *DOB;            // User's date of birth, shared with everyone born the same day
+    const char *picDirectory;   // Directory of the picture, shared with the rest of the roster
+    const char *picFile;        // File name of the picture
+    std::uint32_t nameSize;
+    std::uint32_t DOBSize;
+    std::uint32_t picDirectorySize;
+    std::uint32_t picFileSize;
+    int ID;                     // User's unique identifier; last, so a subclass can use the padding after it
+
+    void assignName(std::string_view text);
+    void assignDOB(std::string_view text);
+    void assignPic(const PooledPath &path);
+
+protected:
+    /**
+     * @brief Copies the user's text into another pool and releases the old one.
+     *
+     * @param pool The pool to use from now on.
+     */
+    void moveToPool(const std::shared_ptr<StringPool> &pool);
 
 public:
    /**
@@ -34,8 +57,10 @@ public:
    * @param name The name of the user.
    * @param DOB The date of birth of the user.
    * @param pic_URL The URL of the user's profile picture.
+   * @param pool Pool that holds the text, usually the exam's; a standalone user gets its own.
    */
-    User(int ID, const std::string &name, const std::string &DOB, const std::string &pic_URL);
+    User(int ID, std::string_view name, std::string_view DOB, std::string_view pic_URL,
+         std::shared_ptr<StringPool> pool = nullptr);
 
    /**
    * @brief Retrieves the user's ID.
@@ -55,46 +80,60 @@ public:
    /**
    * @brief Retrieves the user's name.
    *
-   * @return A string representing the user's name.
+   * @return A view of the user's name, valid while the user is.
    */
-    std::string getName() const;
+    std::string_view getName() const;
 
    /**
      * @brief Sets the user's name.
      *
      * @param name The new name for the user.
      */
-    void setName(const std::string &name);
+    void setName(std::string_view name);
 
 
     /**
      * @brief Retrieves the user's date of birth.
      *
-     * @return A string representing the user's date of birth.
+     * @return A view of the user's date of birth, valid while the user is.
      */
-    std::string getDOB() const;
+    std::string_view getDOB() const;
 
     /**
      * @brief Sets the user's date of birth.
      *
      * @param DOB The new date of birth for the user.
      */
-    void setDOB(const std::string &DOB);
+    void setDOB(std::string_view DOB);
 
 
     /**
      * @brief Retrieves the user's profile picture URL.
      *
-     * @return A string representing the URL of the user's profile picture.
+     * @return The URL of the user's profile picture, joined from its directory and file name.
      */
     std::string getPicURL() const;
 
+    /**
+     * @brief Retrieves the user's profile picture URL without joining it.
+     *
+     * @return Views of the directory and file name of the picture.
+     */
+    PooledPath getPicPath() const;
+
+    /**
+     * @brief Retrieves the pool that holds the user's text.
+     *
+     * @return A const reference to the pool pointer.
+     */
+    const std::shared_ptr<StringPool> &getStringPool() const;
+
     /**
      * @brief Sets the user's profile picture URL.
      *
      * @param pic_URL The new URL for the user's profile picture.
      */
-    void setPicURL(const std::string &pic_URL);
+    void setPicURL(std::string_view pic_URL);
 };
 
 #endif // USER_H
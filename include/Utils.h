@@ -3,17 +3,286 @@
  * @brief Utility functions for the Project.
  *
  * @author Allen Pan
- * @version 1.1
+ * @version 1.2
  * @date 2025-03-29
  */
 #ifndef UTILS_H
 #define UTILS_H
 
-#include <QString>
+#include <atomic>
+#include <cctype>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+// The QString helper is only available to targets linked against Qt, so the
+// core classes can also be built into the unit tests without Qt.
+#ifdef QT_CORE_LIB
+#include <QString>
 #include <QDateTime>
-#include <iomanip>
-#include <sstream>
+#endif
+
+/**
+ * @brief Breaks a time_t down into local calendar time.
+ *
+ * Unlike std::localtime this does not share a static buffer, so check-in
+ * stations on different threads can format times at the same time.
+ *
+ * @param t The time to convert.
+ * @return The local calendar time.
+ */
+inline std::tm toLocalTm(std::time_t t) {
+    std::tm tm{};
+#ifdef _WIN32
+    localtime_s(&tm, &t);
+#else
+    localtime_r(&t, &tm);
+#endif
+    return tm;
+}
+
+// Buffer sizes for the formatters below, terminator included
+constexpr std::size_t CLOCK_TEXT_SIZE = 9;        // "HH:MM:SS"
+constexpr std::size_t TIMESTAMP_TEXT_SIZE = 20;   // "YYYY-MM-DD HH:MM:SS"
+constexpr std::size_t ELAPSED_TEXT_SIZE = 16;     // "HH:MM:SS", with more hour digits when needed
+
+/**
+ * @brief Counts changes of the local time zone, so cached offsets can tell they are stale.
+ *
+ * @return The process-wide generation counter.
+ */
+inline std::atomic<unsigned> &localTimeZoneGeneration() {
+    static std::atomic<unsigned> generation{0};
+    return generation;
+}
+
+/**
+ * @brief Re-reads the TZ setting and drops every thread's cached offset.
+ *
+ * Call after changing TZ; the formatters below otherwise keep the offset they looked up.
+ */
+inline void refreshLocalTimeZone() {
+#ifdef _WIN32
+    _tzset();
+#else
+    tzset();
+#endif
+    localTimeZoneGeneration().fetch_add(1);
+}
+
+/**
+ * @brief Counts the days from 1970-01-01 to a date of the proleptic Gregorian calendar.
+ *
+ * @param year The year.
+ * @param month The month, 1 to 12.
+ * @param day The day of the month, 1 to 31.
+ * @return The number of days; negative before 1970.
+ */
+inline std::int64_t daysFromCivil(std::int64_t year, unsigned month, unsigned day) {
+    year -= month <= 2;
+    const std::int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const unsigned yearOfEra = static_cast<unsigned>(year - era * 400);
+    const unsigned dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const unsigned dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + static_cast<std::int64_t>(dayOfEra) - 719468;
+}
+
+/**
+ * @brief Converts a count of days from 1970-01-01 back to a date.
+ *
+ * @param days The number of days.
+ * @param year Receives the year.
+ * @param month Receives the month, 1 to 12.
+ * @param day Receives the day of the month.
+ */
+inline void civilFromDays(std::int64_t days, std::int64_t &year, unsigned &month, unsigned &day) {
+    days += 719468;
+    const std::int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    const unsigned dayOfEra = static_cast<unsigned>(days - era * 146097);
+    const unsigned yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    const unsigned dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    const unsigned shiftedMonth = (5 * dayOfYear + 2) / 153;
+    day = dayOfYear - (153 * shiftedMonth + 2) / 5 + 1;
+    month = shiftedMonth < 10 ? shiftedMonth + 3 : shiftedMonth - 9;
+    year = static_cast<std::int64_t>(yearOfEra) + era * 400 + (month <= 2);
+}
+
+/**
+ * @brief Looks up the local offset from UTC at a time, without caching.
+ *
+ * @param t The time.
+ * @return Seconds east of UTC.
+ */
+inline long localUtcOffsetUncached(std::time_t t) {
+    std::tm tm = toLocalTm(t);
+    std::int64_t local = daysFromCivil(tm.tm_year + 1900, static_cast<unsigned>(tm.tm_mon + 1),
+                                       static_cast<unsigned>(tm.tm_mday)) * 86400 +
+                         tm.tm_hour * 3600 + tm.tm_min * 60 + tm.tm_sec;
+    return static_cast<long>(local - static_cast<std::int64_t>(t));
+}
+
+/**
+ * @brief Retrieves the local offset from UTC at a time.
+ *
+ * Each thread caches the span of time around the last lookup over which the
+ * offset holds, usually the whole exam day, so formatting a roster's worth of
+ * times asks the C library once. Offsets are assumed to change on quarter-hour
+ * boundaries and at most once a day, which holds for every zone in use.
+ *
+ * @param t The time.
+ * @return Seconds east of UTC.
+ */
+inline long localUtcOffset(std::time_t t) {
+    struct Span {
+        std::time_t from = 0;
+        std::time_t until = 0;
+        long offset = 0;
+        unsigned generation = 0;
+    };
+    thread_local Span cached;
+
+    unsigned generation = localTimeZoneGeneration().load(std::memory_order_acquire);
+    if (t >= cached.from && t < cached.until && cached.generation == generation) return cached.offset;
+
+    const std::time_t STEP = 15 * 60;
+    const std::time_t DAY = 24 * 3600;
+    long offset = localUtcOffsetUncached(t);
+    std::time_t slot = t - ((t % STEP) + STEP) % STEP;
+
+    // Search back up to a day for where this offset began
+    std::time_t same = slot, different = slot - DAY;
+    if (localUtcOffsetUncached(different) == offset) {
+        same = different;
+    } else {
+        while (same - different > STEP) {
+            std::time_t mid = different + (same - different) / STEP / 2 * STEP;
+            (localUtcOffsetUncached(mid) == offset ? same : different) = mid;
+        }
+    }
+    std::time_t from = same;
+
+    // And forward up to a day for where it ends
+    same = slot;
+    different = slot + DAY;
+    if (localUtcOffsetUncached(different) != offset) {
+        while (different - same > STEP) {
+            std::time_t mid = same + (different - same) / STEP / 2 * STEP;
+            (localUtcOffsetUncached(mid) == offset ? same : different) = mid;
+        }
+    }
+
+    cached = Span{from, different, offset, generation};
+    return offset;
+}
+
+/**
+ * @brief Converts a time point to seconds since 1970-01-01 00:00 local time.
+ *
+ * @param tp The time point.
+ * @return The local time in seconds.
+ */
+inline std::int64_t toLocalSeconds(const std::chrono::system_clock::time_point &tp) {
+    std::time_t t = std::chrono::system_clock::to_time_t(tp);
+    return static_cast<std::int64_t>(t) + localUtcOffset(t);
+}
+
+// Writes a value below 100 as two digits
+inline void writeTwoDigits(char *out, unsigned value) {
+    out[0] = static_cast<char>('0' + value / 10);
+    out[1] = static_cast<char>('0' + value % 10);
+}
+
+// Writes a second of the day as HH:MM:SS
+inline void writeClock(char *out, std::int64_t secondOfDay) {
+    writeTwoDigits(out, static_cast<unsigned>(secondOfDay / 3600));
+    out[2] = ':';
+    writeTwoDigits(out + 3, static_cast<unsigned>(secondOfDay / 60 % 60));
+    out[5] = ':';
+    writeTwoDigits(out + 6, static_cast<unsigned>(secondOfDay % 60));
+}
+
+/**
+ * @brief Formats a time point as local "HH:MM:SS" into a caller's buffer.
+ *
+ * Does not allocate and is safe to call from any thread.
+ *
+ * @param tp The time point.
+ * @param out Receives the text and a terminator.
+ * @return The length of the text.
+ */
+inline std::size_t formatClockTime(const std::chrono::system_clock::time_point &tp, char (&out)[CLOCK_TEXT_SIZE]) {
+    std::int64_t local = toLocalSeconds(tp);
+    writeClock(out, ((local % 86400) + 86400) % 86400);
+    out[8] = '\0';
+    return 8;
+}
+
+/**
+ * @brief Formats a time point as local "YYYY-MM-DD HH:MM:SS" into a caller's buffer.
+ *
+ * Does not allocate and is safe to call from any thread. Years are written
+ * as four digits, so times must fall in years 0 to 9999.
+ *
+ * @param tp The time point.
+ * @param out Receives the text and a terminator.
+ * @param separator Written between the date and the time; 'T' gives ISO 8601.
+ * @return The length of the text.
+ */
+inline std::size_t formatTimestamp(const std::chrono::system_clock::time_point &tp, char (&out)[TIMESTAMP_TEXT_SIZE],
+                                   char separator = ' ') {
+    std::int64_t local = toLocalSeconds(tp);
+    std::int64_t days = (local >= 0 ? local : local - 86399) / 86400;
+    std::int64_t year;
+    unsigned month, day;
+    civilFromDays(days, year, month, day);
+    writeTwoDigits(out, static_cast<unsigned>(year / 100));
+    writeTwoDigits(out + 2, static_cast<unsigned>(year % 100));
+    out[4] = '-';
+    writeTwoDigits(out + 5, month);
+    out[7] = '-';
+    writeTwoDigits(out + 8, day);
+    out[10] = separator;
+    writeClock(out + 11, local - days * 86400);
+    out[19] = '\0';
+    return 19;
+}
+
+/**
+ * @brief Formats a length of time as "HH:MM:SS" into a caller's buffer.
+ *
+ * Hours get more digits past 99; negative lengths are written as zero.
+ *
+ * @param elapsed The length of time.
+ * @param out Receives the text and a terminator.
+ * @return The length of the text.
+ */
+inline std::size_t formatElapsed(std::chrono::seconds elapsed, char (&out)[ELAPSED_TEXT_SIZE]) {
+    const std::int64_t MAX_HOURS = 999999999;   // Nine digits fill the buffer
+    std::int64_t total = elapsed.count() > 0 ? elapsed.count() : 0;
+    std::int64_t hours = total / 3600 < MAX_HOURS ? total / 3600 : MAX_HOURS;
+
+    char digits[9];
+    std::size_t numDigits = 0;
+    do {
+        digits[numDigits++] = static_cast<char>('0' + hours % 10);
+        hours /= 10;
+    } while (hours > 0);
+    if (numDigits < 2) digits[numDigits++] = '0';
+
+    std::size_t length = 0;
+    while (numDigits > 0) out[length++] = digits[--numDigits];
+    out[length] = ':';
+    writeTwoDigits(out + length + 1, static_cast<unsigned>(total / 60 % 60));
+    out[length + 3] = ':';
+    writeTwoDigits(out + length + 4, static_cast<unsigned>(total % 60));
+    length += 6;
+    out[length] = '\0';
+    return length;
+}
 
 /**
  * @brief Converts a std::chrono::system_clock::time_point to a formatted std::string.
@@ -24,12 +293,8 @@
  * @return A formatted string representing the time point.
  */
 inline std::string timePointToString(const std::chrono::system_clock::time_point& tp) {
-    std::time_t timeT = std::chrono::system_clock::to_time_t(tp);
-    std::tm tm = *std::localtime(&timeT);  // or std::gmtime for UTC
-
-    std::ostringstream oss;
-    oss << std::put_time(&tm, "%Y-%m-%d %H:%M:%S");  // Format: YYYY-MM-DD HH:MM:SS
-    return oss.str();
+    char text[TIMESTAMP_TEXT_SIZE];
+    return std::string(text, formatTimestamp(tp, text));  // Format: YYYY-MM-DD HH:MM:SS
 }
 
 /**
@@ -40,31 +305,128 @@ inline std::string timePointToString(const std::chrono::system_clock::time_point
  * @param tp The time point to convert.
  * @return A QString representing the time point.
  */
+#ifdef QT_CORE_LIB
 inline QString timePointToQString(const std::chrono::system_clock::time_point& tp) {
     std::time_t time = std::chrono::system_clock::to_time_t(tp);
     QDateTime dateTime = QDateTime::fromSecsSinceEpoch(static_cast<qint64>(time));
     return dateTime.toString("yyyy-MM-dd hh:mm:ss");
 }
+#endif
 
 
 
+/**
+ * @brief Converts seconds since 1970-01-01 00:00 local time to a time_t, using the cached offset.
+ *
+ * A local time that a daylight saving change skips or repeats resolves to one side of the change.
+ *
+ * @param local The local time in seconds.
+ * @return The same instant as a time_t.
+ */
+inline std::time_t fromLocalSeconds(std::int64_t local) {
+    std::time_t guess = static_cast<std::time_t>(local - localUtcOffset(static_cast<std::time_t>(local)));
+    return static_cast<std::time_t>(local - localUtcOffset(guess));
+}
+
+/**
+ * @brief Parses an ISO 8601 date and time without allocating.
+ *
+ * Accepts "YYYY-MM-DDTHH:MM[:SS[.fraction]]" with 'T' or a space between the
+ * date and the time, followed by 'Z', an offset such as "+05:30", "-0400" or
+ * "+01", or nothing for local time. Fractions keep up to nanoseconds.
+ * Surrounding whitespace is ignored. Safe to call from any thread.
+ *
+ * @param text The text to parse.
+ * @param tp Receives the time; left unchanged if the text is not a valid time.
+ * @return true if the text was parsed.
+ */
+inline bool parseIsoTimestamp(std::string_view text, std::chrono::system_clock::time_point &tp) {
+    std::size_t i = 0, n = text.size();
+    while (i < n && std::isspace(static_cast<unsigned char>(text[i]))) ++i;
+    while (n > i && std::isspace(static_cast<unsigned char>(text[n - 1]))) --n;
+
+    auto digits = [&](std::size_t count, int &value) {
+        if (n - i < count) return false;
+        value = 0;
+        for (std::size_t end = i + count; i < end; ++i) {
+            if (text[i] < '0' || text[i] > '9') return false;
+            value = value * 10 + (text[i] - '0');
+        }
+        return true;
+    };
+    auto skip = [&](char c) {
+        if (i < n && text[i] == c) {
+            ++i;
+            return true;
+        }
+        return false;
+    };
+
+    int year, month, day, hour, minute, second = 0;
+    if (!digits(4, year) || !skip('-') || !digits(2, month) || !skip('-') || !digits(2, day)) return false;
+    if (!skip('T') && !skip('t') && !skip(' ')) return false;
+    if (!digits(2, hour) || !skip(':') || !digits(2, minute)) return false;
+
+    long nanos = 0;
+    if (skip(':')) {
+        if (!digits(2, second)) return false;
+        if (skip('.') || skip(',')) {
+            std::size_t first = i;
+            for (long scale = 100000000; i < n && text[i] >= '0' && text[i] <= '9'; ++i, scale /= 10) {
+                nanos += (text[i] - '0') * scale;
+            }
+            if (i == first) return false;
+        }
+    }
+
+    static const int DAYS_IN_MONTH[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    if (month < 1 || month > 12 || hour > 23 || minute > 59 || second > 60) return false;
+    bool leapYear = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    if (day < 1 || day > DAYS_IN_MONTH[month - 1] + (month == 2 && leapYear)) return false;
+
+    std::int64_t seconds = daysFromCivil(year, static_cast<unsigned>(month), static_cast<unsigned>(day)) * 86400 +
+                           hour * 3600 + minute * 60 + second;
+    std::time_t utc;
+    if (i == n) {
+        utc = fromLocalSeconds(seconds);
+    } else if (skip('Z') || skip('z')) {
+        if (i != n) return false;   // Nothing may follow 'Z', not even an offset
+        utc = static_cast<std::time_t>(seconds);
+    } else if (text[i] == '+' || text[i] == '-') {
+        int sign = text[i++] == '-' ? -1 : 1;
+        int offsetHours, offsetMinutes = 0;
+        if (!digits(2, offsetHours)) return false;
+        if (i < n) {
+            skip(':');
+            if (!digits(2, offsetMinutes)) return false;
+        }
+        if (i != n || offsetHours > 23 || offsetMinutes > 59) return false;
+        utc = static_cast<std::time_t>(seconds - sign * (offsetHours * 3600 + offsetMinutes * 60));
+    } else {
+        return false;
+    }
+
+    tp = std::chrono::system_clock::from_time_t(utc) +
+         std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::nanoseconds(nanos));
+    return true;
+}
+
 /**
  * @brief Converts a ISO 8601 formatted string ti std::chrono::system_clock::time_point.
  *
- * The format used is "yyyy-MM-dd hh:mm:ss".
+ * The format used is "yyyy-MM-ddThh:mm:ss", with the optional fraction and
+ * UTC offset parseIsoTimestamp() accepts; without an offset the time is local.
  *
  * @param isoString String address to be converted.
  * @return A std::chrono::system_clock::time_point.
+ * @throws std::runtime_error if the string is not a valid time.
  */
 inline std::chrono::system_clock::time_point stringToTimePoint(const std::string &isoString) {
-    std::tm t = {};
-    std::istringstream ss(isoString);
-    ss >> std::get_time(&t, "%Y-%m-%dT%H:%M:%S");
-    if (ss.fail()) {
+    std::chrono::system_clock::time_point tp;
+    if (!parseIsoTimestamp(isoString, tp)) {
         throw std::runtime_error("Failed to parse time: " + isoString);
     }
-    std::time_t time_c = std::mktime(&t);
-    return std::chrono::system_clock::from_time_t(time_c);
+    return tp;
 }
 
 
@@ -12,6 +12,8 @@
 #include <QLabel>
 #include <QHBoxLayout>
 #include "Exam.h"
+#include "PhotoCache.h"
+#include "StudentRouter.h"
 
 /**
  * @class CheckInDialog
@@ -25,7 +27,8 @@ class CheckInDialog : public QDialog {
     Q_OBJECT
 
 public:
-    explicit CheckInDialog(Exam* exam, QWidget* parent = nullptr);
+    explicit CheckInDialog(Exam* exam, QWidget* parent = nullptr, PhotoCache* photos = nullptr,
+                           const StudentRouter* router = nullptr);
 
     private slots:
         void onLookupStudent();
@@ -33,7 +36,9 @@ public:
 
 private:
     Exam* examPtr;
-    Student* currentStudent;
+    PhotoCache* photoCache;   // Shared by every open exam; nullptr to read photos from disk each time
+    const StudentRouter* studentRouter;   // Finds the exam of students not in this one; may be nullptr
+    int currentStudentID;   // Student shown in the dialog, 0 if none
 
     QLineEdit* idInput;
     QLabel* nameLabel;
@@ -47,6 +52,6 @@ private:
 
     QPushButton* confirmButton;
 
-    void updateStudentInfo(Student* student);
+    void updateStudentInfo(const StudentStatus& student);
     void loadLocalPhoto(const QString& path);
 };
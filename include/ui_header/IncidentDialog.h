@@ -8,7 +8,9 @@
  */
 
 #include <QDialog>
+#include "IncidentStore.h"
 
+class QComboBox;
 class QLineEdit;
 class QTextEdit;
 
@@ -17,7 +19,7 @@ class QTextEdit;
  * @brief A dialog used to record an incident during an exam session.
  *
  * This dialog allows a TA or Course Instructor to enter and submit
- * information about an incident, including the student ID, proctor ID, and a descriptive message.
+ * information about an incident, including the student ID, proctor ID, category, and a descriptive message.
  */
 class IncidentDialog : public QDialog {
     Q_OBJECT
@@ -41,6 +43,12 @@ public:
      */
     int getProctorID() const;
 
+    /**
+     * @brief Retrieves the selected incident category.
+     * @return The category.
+     */
+    IncidentCategory getCategory() const;
+
     /**
      * @brief Retrieves the incident message.
      * @return The message as a QString.
@@ -50,5 +58,6 @@ public:
 private:
     QLineEdit* studentIDEdit;   ///< Line edit for entering the student ID.
     QLineEdit* proctorIDEdit;   ///< Line edit for entering the proctor ID.
+    QComboBox* categoryBox;     ///< Drop-down for choosing the incident category.
     QTextEdit* messageEdit;     ///< Text edit for entering the incident message.
 };
@@ -11,7 +11,17 @@
 #define MAINWINDOW_H
 
 #include <QMainWindow>
+#include <string>
+#include <vector>
 #include "Exam.h"
+#include "CommandQueue.h"
+#include "ExamCommandApplier.h"
+#include "SessionManager.h"
+
+class QComboBox;
+class QLabel;
+class QPushButton;
+class QTimer;
 
 QT_BEGIN_NAMESPACE
 namespace Ui {
@@ -34,10 +44,10 @@ class MainWindow : public QMainWindow
 public:
     /**
      * @brief Constructs a MainWindow object.
-     * @param exam Pointer to the Exam object containing current exam session data.
+     * @param sessions The session manager that owns every exam opened at this desk; must outlive the window.
      * @param parent Optional parent widget.
      */
-    explicit MainWindow(Exam* exam, QWidget *parent = nullptr);
+    explicit MainWindow(SessionManager* sessions, QWidget *parent = nullptr);
 
     /**
      * @brief Destructor for MainWindow.
@@ -49,11 +59,68 @@ public:
      */
     void populateExamDetails();
 
+    /**
+     * @brief Retrieves the queue input stations push exam commands into.
+     *
+     * Card readers, cameras and network stations may push from any thread;
+     * commands are applied once an exam has been loaded.
+     *
+     * @return A reference to the command queue.
+     */
+    CommandQueue &getCommandQueue();
+
 private:
     Ui::MainWindow *ui;   ///< Pointer to the auto-generated UI class.
-    Exam* examPtr;        ///< Pointer to the current Exam object.
+    SessionManager* sessionManager;   ///< Every exam open at this desk.
+    Exam* examPtr;        ///< Pointer to the active Exam object, nullptr until one is opened.
+    CommandQueue commandQueue;        ///< Commands from input stations waiting to be applied.
+    ExamCommandApplier *applier;      ///< Thread that drains commandQueue into the exam each command names.
+    QLabel *queueLabel;               ///< Status bar label showing the command queue depth.
+    QComboBox *sessionBox;            ///< Status bar list of open exams; picking one switches to it.
+    QPushButton *addExamButton;       ///< Opens another exam data file as a new session.
+    QTimer *snapshotTimer;            ///< Queues snapshots of every open exam.
+    QTimer *deadlineTimer;            ///< Drives the session manager's exam deadlines once a second.
+    std::vector<std::string> unfinishedJournals;   ///< Journals left behind by a crash, found at startup.
+
+    /**
+     * @brief Offers to rebuild the exams left open by a crash.
+     * @return true if an exam was recovered and the dashboard is shown.
+     */
+    bool offerRecovery();
+
+    /**
+     * @brief Asks for an exam data file and opens it as a new session.
+     * @return true if the exam was loaded and is now the active one.
+     */
+    bool openExamFile();
+
+    /**
+     * @brief Switches the dashboard to another open exam; station input still goes where each command says.
+     * @param index Position of the session in the session manager.
+     */
+    void activateSession(std::size_t index);
 
 private slots:
+    /**
+     * @brief Shows the outcome of a queued command in the status bar.
+     */
+    void onCommandApplied(const QString &examKey, ExamCommandType type, int studentID, BatchStatus status);
+
+    /**
+     * @brief Shows the command queue depth in the status bar.
+     */
+    void onQueueStats(qulonglong depth, qulonglong highWater, qulonglong rejected);
+
+    /**
+     * @brief Switches to the exam picked in the session list.
+     */
+    void onSessionSelected(int index);
+
+    /**
+     * @brief Opens another exam alongside the ones already open.
+     */
+    void onAddExamClicked();
+
     /**
      * @brief Triggered when the login button is clicked.
      *        Validates user credentials and proceeds to the dashboard.
@@ -0,0 +1,64 @@
+/**
+ * @file BloomFilter.cpp
+ * @brief Implementation of the BloomFilter class.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include "BloomFilter.h"
+#include <algorithm>
+
+namespace {
+const std::size_t MIN_BITS = 512;
+
+// SplitMix64 finalizer; spreads sequential student IDs over the whole word
+std::uint64_t mix(std::uint64_t x) {
+    x += 0x9E3779B97F4A7C15ull;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+    return x ^ (x >> 31);
+}
+}
+
+// Constructor
+BloomFilter::BloomFilter(std::size_t expectedKeys) : mask(0), capacity(0) {
+    reset(expectedKeys);
+}
+
+void BloomFilter::reset(std::size_t expectedKeys) {
+    std::size_t bits = MIN_BITS;
+    while (bits < expectedKeys * BITS_PER_KEY) bits <<= 1;
+    words.assign(bits / 64, 0);
+    mask = bits - 1;
+    capacity = std::max(expectedKeys, bits / BITS_PER_KEY);
+}
+
+// The HASHES probe positions come from two halves of one hash (double hashing)
+void BloomFilter::add(std::uint64_t key) {
+    std::uint64_t h = mix(key);
+    std::uint64_t h1 = h, h2 = (h >> 32) | 1;
+    for (unsigned i = 0; i < HASHES; ++i) {
+        std::uint64_t bit = (h1 + i * h2) & mask;
+        words[bit >> 6] |= std::uint64_t(1) << (bit & 63);
+    }
+}
+
+bool BloomFilter::mightContain(std::uint64_t key) const {
+    std::uint64_t h = mix(key);
+    std::uint64_t h1 = h, h2 = (h >> 32) | 1;
+    for (unsigned i = 0; i < HASHES; ++i) {
+        std::uint64_t bit = (h1 + i * h2) & mask;
+        if (!(words[bit >> 6] & (std::uint64_t(1) << (bit & 63)))) return false;
+    }
+    return true;
+}
+
+std::size_t BloomFilter::getCapacity() const {
+    return capacity;
+}
+
+std::size_t BloomFilter::getBitCount() const {
+    return words.size() * 64;
+}
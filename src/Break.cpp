@@ -13,36 +13,48 @@
 
 
 #include "Break.h"
-#include <sstream>
-#include <iomanip>
-#include <ctime>
+#include "Utils.h"
 
 // Constructor: Automatically sets current time as startTime
-Break::Break() : isEnded(false) {
-    startTime = std::chrono::system_clock::now();
-}
+Break::Break() : Break(std::chrono::system_clock::now()) {}
+
+// Constructor: Break that started at a given time
+Break::Break(std::chrono::system_clock::time_point start) : startTime(start), isEnded(false) {}
 
 // Convert time_point to HH:MM:SS
 std::string Break::getStartTime() const {
-    std::time_t startT = std::chrono::system_clock::to_time_t(startTime);
-    std::ostringstream oss;
-    oss << std::put_time(std::localtime(&startT), "%H:%M:%S");
-    return oss.str();
+    char text[CLOCK_TEXT_SIZE];
+    return std::string(text, formatClockTime(startTime, text));
 }
 
 // Convert endTime to HH:MM:SS
 std::string Break::getEndTime() const {
     // No End Time if still in a break
     if (!isEnded) return "Break in progress";
-    std::time_t endT = std::chrono::system_clock::to_time_t(endTime);
-    std::ostringstream oss;
-    oss << std::put_time(std::localtime(&endT), "%H:%M:%S");
-    return oss.str();
+    char text[CLOCK_TEXT_SIZE];
+    return std::string(text, formatClockTime(endTime, text));
+}
+
+std::chrono::system_clock::time_point Break::getStartTimePoint() const {
+    return startTime;
+}
+
+std::chrono::system_clock::time_point Break::getEndTimePoint() const {
+    return endTime;
+}
+
+bool Break::hasEnded() const {
+    return isEnded;
 }
 
 // Set End Time when as student return to exam
 void Break::endBreak() {
-    endTime = std::chrono::system_clock::now();
+    endBreak(std::chrono::system_clock::now());
+}
+
+// Set End Time to a given time
+void Break::endBreak(std::chrono::system_clock::time_point end) {
+    endTime = end;
     isEnded = true;
 }
 
@@ -51,16 +63,7 @@ std::string Break::getDuration() const {
     // No duration if still in a break
     if (!isEnded) return "Break in progress";
 
-    std::chrono::duration<int> duration = std::chrono::duration_cast<std::chrono::seconds>(endTime - startTime);
-    int hours = duration.count() / 3600;
-    int minutes = (duration.count() % 3600) / 60;
-    int seconds = duration.count() % 60;
-
-    std::ostringstream durationStream;
     // Make output as consistent as getTime operation
-    durationStream << std::setw(2) << std::setfill('0') << hours << ":"
-            << std::setw(2) << std::setfill('0') << minutes << ":"
-            << std::setw(2) << std::setfill('0') << seconds;
-
-    return durationStream.str();
+    char text[ELAPSED_TEXT_SIZE];
+    return std::string(text, formatElapsed(std::chrono::duration_cast<std::chrono::seconds>(endTime - startTime), text));
 }
@@ -0,0 +1,43 @@
+/**
+ * @file BreakLog.cpp
+ * @brief Implementation of the BreakLog class.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include "BreakLog.h"
+
+std::uint32_t BreakLog::start(int studentID, std::chrono::system_clock::time_point at, std::uint32_t previous) {
+    std::lock_guard<std::mutex> guard(lock);
+    std::uint32_t position = static_cast<std::uint32_t>(records.size());
+    records.push_back(BreakRecord{studentID, NONE, Break(at)});
+    if (previous != NONE) records[previous].next = position;
+    return position;
+}
+
+void BreakLog::end(std::uint32_t position, std::chrono::system_clock::time_point at) {
+    std::lock_guard<std::mutex> guard(lock);
+    records[position].span.endBreak(at);
+}
+
+BreakRecord BreakLog::record(std::uint32_t position) const {
+    std::lock_guard<std::mutex> guard(lock);
+    return records[position];
+}
+
+void BreakLog::reserve(std::size_t numBreaks) {
+    std::lock_guard<std::mutex> guard(lock);
+    records.reserve(numBreaks);
+}
+
+void BreakLog::clear() {
+    std::lock_guard<std::mutex> guard(lock);
+    records.clear();
+}
+
+std::size_t BreakLog::size() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return records.size();
+}
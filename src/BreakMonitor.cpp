@@ -0,0 +1,150 @@
+/**
+ * @file BreakMonitor.cpp
+ * @brief Implementation of the BreakMonitor class.
+ *
+ * Lock order: the exam's locks and event log lock (held while listeners run),
+ * or its break lock (held while watch() arms breaks already in progress), then
+ * the monitor's lock, then the wheel's. Timer callbacks run with no wheel
+ * lock held, and alert handlers run with no lock held at all.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include "BreakMonitor.h"
+#include <algorithm>
+
+constexpr std::chrono::minutes BreakMonitor::DEFAULT_LIMIT;
+
+// Constructor
+BreakMonitor::BreakMonitor(TimerWheel &wheel, std::chrono::minutes limit) : wheel(wheel), limit(limit) {}
+
+// Destructor
+BreakMonitor::~BreakMonitor() {
+    std::vector<std::string> keys;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        for (const auto &entry : watched) keys.push_back(entry.first);
+    }
+    for (const std::string &key : keys) unwatch(key);
+}
+
+void BreakMonitor::addAlertHandler(AlertHandler handler) {
+    handlers.push_back(std::move(handler));
+}
+
+// Arm one break timer, replacing any earlier one for the student; caller holds the lock
+void BreakMonitor::arm(const std::string &examKey, Watched &exam, int studentID,
+                       std::chrono::system_clock::time_point leftAt) {
+    auto it = exam.armed.find(studentID);
+    if (it != exam.armed.end()) wheel.cancel(it->second.timer);
+    exam.overdue.erase(studentID);
+    TimerWheel::TimerId timer = wheel.schedule(leftAt + limit, [this, examKey, studentID, leftAt] {
+        fire(examKey, studentID, leftAt);
+    });
+    exam.armed[studentID] = Armed{leftAt, limit, timer};
+}
+
+void BreakMonitor::fire(const std::string &examKey, int studentID, std::chrono::system_clock::time_point leftAt) {
+    BreakAlert alert;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        auto exam = watched.find(examKey);
+        if (exam == watched.end()) return;
+        auto it = exam->second.armed.find(studentID);
+        // The student came back, or left again, after the timer was taken off the wheel
+        if (it == exam->second.armed.end() || it->second.leftAt != leftAt) return;
+        alert = BreakAlert{examKey, studentID, leftAt, it->second.limit};
+        exam->second.armed.erase(it);
+        exam->second.overdue[studentID] = alert;
+    }
+    for (const AlertHandler &handler : handlers) handler(alert);
+}
+
+void BreakMonitor::watch(const std::string &examKey, Exam &exam) {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        watched[examKey].exam = &exam;
+    }
+
+    // Listen before looking at breaks in progress, so a break that starts in between is armed by its event
+    std::size_t listener = exam.getEventLog().addListener([this, examKey](const ExamEvent &event, const std::string &) {
+        if (event.type != ExamEventType::BreakStarted && event.type != ExamEventType::BreakEnded) return;
+        std::lock_guard<std::mutex> guard(lock);
+        auto entry = watched.find(examKey);
+        if (entry == watched.end()) return;
+        if (event.type == ExamEventType::BreakStarted) {
+            arm(examKey, entry->second, event.studentID, event.at());
+            return;
+        }
+        auto it = entry->second.armed.find(event.studentID);
+        if (it != entry->second.armed.end()) {
+            wheel.cancel(it->second.timer);
+            entry->second.armed.erase(it);
+        }
+        entry->second.overdue.erase(event.studentID);
+    });
+
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        watched[examKey].listener = listener;
+    }
+
+    // A break seen here and also by the listener is armed twice; the second replaces the first
+    exam.forEachBreakInProgress([this, &examKey](int studentID, std::chrono::system_clock::time_point leftAt) {
+        std::lock_guard<std::mutex> guard(lock);
+        auto entry = watched.find(examKey);
+        if (entry != watched.end()) arm(examKey, entry->second, studentID, leftAt);
+    });
+}
+
+void BreakMonitor::unwatch(const std::string &examKey) {
+    Exam *exam;
+    std::size_t listener;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        auto entry = watched.find(examKey);
+        if (entry == watched.end()) return;
+        exam = entry->second.exam;
+        listener = entry->second.listener;
+    }
+    // Not under the monitor's lock: listeners take it while the event log is locked
+    exam->getEventLog().removeListener(listener);
+
+    std::lock_guard<std::mutex> guard(lock);
+    auto entry = watched.find(examKey);
+    if (entry == watched.end()) return;
+    for (const auto &armed : entry->second.armed) wheel.cancel(armed.second.timer);
+    watched.erase(entry);
+}
+
+void BreakMonitor::setLimit(std::chrono::minutes limit) {
+    std::lock_guard<std::mutex> guard(lock);
+    this->limit = limit;
+}
+
+std::chrono::minutes BreakMonitor::getLimit() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return limit;
+}
+
+std::vector<BreakAlert> BreakMonitor::getOverdue() const {
+    std::vector<BreakAlert> overdue;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        for (const auto &exam : watched) {
+            for (const auto &student : exam.second.overdue) overdue.push_back(student.second);
+        }
+    }
+    std::sort(overdue.begin(), overdue.end(),
+              [](const BreakAlert &a, const BreakAlert &b) { return a.leftAt < b.leftAt; });
+    return overdue;
+}
+
+std::size_t BreakMonitor::getArmedCount() const {
+    std::lock_guard<std::mutex> guard(lock);
+    std::size_t count = 0;
+    for (const auto &exam : watched) count += exam.second.armed.size();
+    return count;
+}
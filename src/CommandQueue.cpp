@@ -0,0 +1,129 @@
+/**
+ * @file CommandQueue.cpp
+ * @brief Implementation of the CommandQueue class.
+ *
+ * The ring follows the bounded sequence-number design: a slot whose sequence
+ * equals the write position is free, and one whose sequence is one past the
+ * read position holds a command. Producers race only on the write position.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include "CommandQueue.h"
+#include <utility>
+
+// Constructor
+CommandQueue::CommandQueue(std::size_t capacity)
+    : mask(0), writePos(0), readPos(0), highWater(0), pushed(0), rejected(0), consumerSleeping(false), wakeRequested(false) {
+    std::size_t size = 2;
+    while (size < capacity) size <<= 1;
+    mask = size - 1;
+    slots.reset(new Slot[size]);
+    for (std::size_t i = 0; i < size; ++i) {
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool CommandQueue::tryPush(ExamCommand command) {
+    if (command.at == std::chrono::system_clock::time_point()) command.at = std::chrono::system_clock::now();
+
+    std::size_t pos = writePos.load(std::memory_order_relaxed);
+    Slot *slot;
+    for (;;) {
+        slot = &slots[pos & mask];
+        std::size_t seq = slot->sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+        if (diff == 0) {
+            if (writePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if (diff < 0) {
+            // The consumer has not freed this slot yet: the ring is full
+            rejected.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        } else {
+            pos = writePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->command = std::move(command);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    pushed.fetch_add(1, std::memory_order_relaxed);
+    noteDepth(pos + 1 - readPos.load(std::memory_order_relaxed));
+
+    // Pairs with the fence in waitForCommands(): either the consumer sees the
+    // command, or we see that it is asleep and wake it
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (consumerSleeping.load(std::memory_order_relaxed)) {
+        std::lock_guard<std::mutex> guard(sleepLock);
+        wakeUp.notify_one();
+    }
+    return true;
+}
+
+std::size_t CommandQueue::popBatch(std::vector<ExamCommand> &out, std::size_t maxCount) {
+    std::size_t pos = readPos.load(std::memory_order_relaxed);
+    std::size_t taken = 0;
+    while (taken < maxCount) {
+        Slot &slot = slots[pos & mask];
+        if (slot.sequence.load(std::memory_order_acquire) != pos + 1) break;
+        out.push_back(std::move(slot.command));
+        slot.sequence.store(pos + mask + 1, std::memory_order_release);
+        ++pos;
+        ++taken;
+    }
+    readPos.store(pos, std::memory_order_relaxed);
+    return taken;
+}
+
+bool CommandQueue::waitForCommands(std::chrono::milliseconds timeout) {
+    auto hasCommand = [this] {
+        std::size_t pos = readPos.load(std::memory_order_relaxed);
+        return slots[pos & mask].sequence.load(std::memory_order_acquire) == pos + 1;
+    };
+
+    std::unique_lock<std::mutex> lock(sleepLock);
+    consumerSleeping.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    wakeUp.wait_for(lock, timeout, [&] { return wakeRequested || hasCommand(); });
+    consumerSleeping.store(false, std::memory_order_relaxed);
+    wakeRequested = false;
+    return hasCommand();
+}
+
+void CommandQueue::wake() {
+    std::lock_guard<std::mutex> guard(sleepLock);
+    wakeRequested = true;
+    wakeUp.notify_all();
+}
+
+// Raise the high-water mark if this push made the queue deeper than before
+void CommandQueue::noteDepth(std::size_t depth) {
+    if (depth > capacity()) depth = capacity();  // readPos may lag behind slots the consumer already freed
+    std::size_t seen = highWater.load(std::memory_order_relaxed);
+    while (depth > seen && !highWater.compare_exchange_weak(seen, depth, std::memory_order_relaxed)) {
+    }
+}
+
+std::size_t CommandQueue::depth() const {
+    std::size_t write = writePos.load(std::memory_order_relaxed);
+    std::size_t read = readPos.load(std::memory_order_relaxed);
+    if (write <= read) return 0;
+    return write - read > capacity() ? capacity() : write - read;
+}
+
+std::size_t CommandQueue::capacity() const {
+    return mask + 1;
+}
+
+std::size_t CommandQueue::getHighWater() const {
+    return highWater.load(std::memory_order_relaxed);
+}
+
+std::uint64_t CommandQueue::getPushedCount() const {
+    return pushed.load(std::memory_order_relaxed);
+}
+
+std::uint64_t CommandQueue::getRejectedCount() const {
+    return rejected.load(std::memory_order_relaxed);
+}
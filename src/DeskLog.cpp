@@ -0,0 +1,116 @@
+/**
+ * @file DeskLog.cpp
+ * @brief Implementation of the DeskLog class.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include "DeskLog.h"
+#include "IncidentStore.h"
+#include "Utils.h"
+#include <sstream>
+
+// Constructor
+DeskLog::DeskLog(const std::string &path, std::size_t capacity)
+    : file(path, std::ios::app), queuedCount(0), writtenCount(0), stopping(false) {
+    sources.push_back(std::string());
+    pending.reserve(capacity);
+    writer = std::thread(&DeskLog::writerLoop, this);
+}
+
+// Destructor
+DeskLog::~DeskLog() {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    wakeWriter.notify_one();
+    if (writer.joinable()) writer.join();
+}
+
+std::uint32_t DeskLog::addSource(const std::string &key) {
+    std::lock_guard<std::mutex> guard(lock);
+    for (std::uint32_t i = 0; i < sources.size(); ++i) {
+        if (sources[i] == key) return i;
+    }
+    sources.push_back(key);
+    return static_cast<std::uint32_t>(sources.size() - 1);
+}
+
+// Events are stamped with the time they happened, which may be well before they were applied
+void DeskLog::post(std::uint32_t source, const ExamEvent &event, const std::string &message) {
+    queue(source, event.at(), true, event, message);
+}
+
+void DeskLog::write(std::uint32_t source, const std::string &text) {
+    queue(source, std::chrono::system_clock::now(), false, ExamEvent(), text);
+}
+
+void DeskLog::queue(std::uint32_t source, std::chrono::system_clock::time_point at, bool isEvent,
+                    const ExamEvent &event, const std::string &text) {
+    std::lock_guard<std::mutex> guard(lock);
+    pending.push_back(Entry{source, at, isEvent, event, text});
+    queuedCount++;
+    wakeWriter.notify_one();
+}
+
+// Take everything queued, then format and write it with no lock held
+void DeskLog::writerLoop() {
+    std::vector<Entry> batch;
+    batch.reserve(pending.capacity());
+    std::vector<std::string> names;   // Copy of sources, refreshed when an exam is added
+    std::unique_lock<std::mutex> guard(lock);
+    for (;;) {
+        wakeWriter.wait(guard, [this] { return stopping || !pending.empty(); });
+        if (pending.empty()) break;
+
+        batch.swap(pending);
+        if (names.size() != sources.size()) names = sources;
+        std::uint64_t upTo = queuedCount;
+        guard.unlock();
+
+        char stamp[TIMESTAMP_TEXT_SIZE];
+        for (const Entry &entry : batch) {
+            const std::string &key = names[entry.source];
+            file.write(stamp, static_cast<std::streamsize>(formatTimestamp(entry.at, stamp)));
+            file << " [" << (key.empty() ? "desk" : key) << "] "
+                 << (entry.isEvent ? describe(entry.event, entry.text) : entry.text) << '\n';
+        }
+        file.flush();
+        batch.clear();
+
+        guard.lock();
+        writtenCount = upTo;
+        written.notify_all();
+    }
+}
+
+void DeskLog::flush() {
+    std::unique_lock<std::mutex> guard(lock);
+    std::uint64_t target = queuedCount;
+    written.wait(guard, [&] { return writtenCount >= target; });
+}
+
+std::string DeskLog::describe(const ExamEvent &event, const std::string &message) {
+    std::ostringstream line;
+    line << "student " << event.studentID << ": ";
+    switch (event.type) {
+        case ExamEventType::CheckedIn:
+            line << "checked in at row " << event.arg0 + 1 << " seat " << event.arg1 + 1 << ", version " << event.arg2;
+            break;
+        case ExamEventType::CheckInUndone:  line << "check-in undone"; break;
+        case ExamEventType::StudentMoved:
+            line << "moved to row " << event.arg0 + 1 << " seat " << event.arg1 + 1;
+            break;
+        case ExamEventType::BreakStarted:   line << "left for break"; break;
+        case ExamEventType::BreakEnded:     line << "returned from break"; break;
+        case ExamEventType::Submitted:      line << "submitted"; break;
+        case ExamEventType::IncidentLogged:
+            line << "incident by proctor " << event.arg0 << " ("
+                 << incidentCategoryName(incidentCategoryFromCode(event.arg2)) << "): " << message;
+            break;
+    }
+    return line.str();
+}
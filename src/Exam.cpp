@@ -27,31 +27,403 @@
 #include "PDFReportGenerator.h"
 
 // Constructor
-Exam::Exam() {
+Exam::Exam() : strings(std::make_shared<StringPool>()), breakLog(std::make_shared<BreakLog>()), columnarEnabled(false) {
 }
 
 bool Exam::loadFromFile(const std::string &path) {
     return ExamDataLoader::loadExamData(path, *this);
 }
 
-bool Exam::isOnBreak(int studentID) const { // NEW
-    auto it = std::find(studentsInBreak.begin(), studentsInBreak.end(), studentID);
-    return (it != studentsInBreak.end());
+bool Exam::isOnBreak(int studentID) const {
+    auto it = studentIndex.find(studentID);
+    return it != studentIndex.end() && onBreakAt(it->second);
 }
 
-void Exam::addProctor(const Proctor &p) {
-    for (const auto &existing: proctors) {
-        if (existing.getID() == p.getID()) return; // skip if already added
+bool Exam::onBreakAt(std::size_t index) const {
+    std::lock_guard<std::mutex> guard(breakLock);
+    return breakSlot[index] >= 0;
+}
+
+std::mutex &Exam::studentLock(std::size_t index) const {
+    return studentLocks[index % STUDENT_LOCK_SHARDS];
+}
+
+// Every lock in the order the stations take them: each shard, then seat, break and incident locks
+std::vector<std::unique_lock<std::mutex>> Exam::lockAll() {
+    std::vector<std::unique_lock<std::mutex>> held;
+    held.reserve(STUDENT_LOCK_SHARDS + 3);
+    for (std::mutex &shard : studentLocks) held.emplace_back(shard);
+    held.emplace_back(seatLock);
+    held.emplace_back(breakLock);
+    held.emplace_back(incidentLock);
+    return held;
+}
+
+// The shards of the given students, each once, in the ascending order lockAll() takes them
+std::vector<std::unique_lock<std::mutex>> Exam::lockShards(const std::vector<std::size_t> &indices) {
+    std::array<bool, STUDENT_LOCK_SHARDS> wanted{};
+    for (std::size_t index : indices) wanted[index % STUDENT_LOCK_SHARDS] = true;
+    std::vector<std::unique_lock<std::mutex>> held;
+    for (std::size_t shard = 0; shard < STUDENT_LOCK_SHARDS; ++shard) {
+        if (wanted[shard]) held.emplace_back(studentLocks[shard]);
+    }
+    return held;
+}
+
+// Caller holds the student's shard lock
+void Exam::readStatusAt(std::size_t index, StudentStatus &out) const {
+    const Student &s = students[index];
+    out.studentID = s.getID();
+    out.name.assign(s.getName());
+    out.DOB.assign(s.getDOB());
+    out.picURL = s.getPicURL();
+    out.seatNum = s.getSeatNum();
+    out.seatRow = s.hasSeat() ? s.getSeatRow() : -1;
+    out.seatCol = s.hasSeat() ? s.getSeatCol() : -1;
+    out.examVersion = s.getExamVersion();
+    out.attended = s.getAttendance();
+    out.submitted = s.getSubmissionStatus();
+    out.onBreak = onBreakAt(index);
+}
+
+bool Exam::readStudent(int studentID, StudentStatus &out) const {
+    auto it = studentIndex.find(studentID);
+    if (it == studentIndex.end()) return false;
+    std::lock_guard<std::mutex> guard(studentLock(it->second));
+    readStatusAt(it->second, out);
+    return true;
+}
+
+const std::vector<std::size_t> &Exam::getStudentsOnBreak() const {
+    return studentsInBreak;
+}
+
+// A student is listed only after leaveForBreak() has recorded their break, so the latest break is the open one
+void Exam::forEachBreakInProgress(
+    const std::function<void(int studentID, std::chrono::system_clock::time_point leftAt)> &visit) const {
+    std::lock_guard<std::mutex> guard(breakLock);
+    for (std::size_t index : studentsInBreak) {
+        const Student &s = students[index];
+        visit(s.getID(), s.getBreaksList().back().getStartTimePoint());
+    }
+}
+
+// Caller holds the student's shard lock
+void Exam::startBreakAt(std::size_t index, std::chrono::system_clock::time_point at) {
+    students[index].leaveForBreak(at);
+    {
+        std::lock_guard<std::mutex> guard(breakLock);
+        breakSlot[index] = static_cast<int>(studentsInBreak.size());
+        studentsInBreak.push_back(index);
+    }
+}
+
+// Swap the last student out into the freed slot so removal stays O(1)
+void Exam::endBreakAt(std::size_t index, std::chrono::system_clock::time_point at) {
+    students[index].returnFromBreak(at);
+    {
+        std::lock_guard<std::mutex> guard(breakLock);
+        int slot = breakSlot[index];
+        std::size_t last = studentsInBreak.back();
+        studentsInBreak[slot] = last;
+        breakSlot[last] = slot;
+        studentsInBreak.pop_back();
+        breakSlot[index] = -1;
+    }
+}
+
+// Breaks open 30 minutes after the start and close 15 minutes before the end
+bool Exam::breakWindowOpen(std::chrono::system_clock::time_point at) const {
+    using namespace std::chrono;
+    return at >= startTime + minutes(30) && at <= endTime - minutes(15);
+}
+
+/**
+ * @brief Rebuilds exam state by applying the events of a log in order.
+ *
+ * The exam must have the same roster, seat map and versions as the one that
+ * produced the log and must not have run any events yet. Each event is checked
+ * against the current state before it is applied; events that do not fit are
+ * skipped. Replayed events are appended to this exam's own log.
+ *
+ * @param source The log to replay.
+ * @param from Position in source of the first event to apply.
+ * @return true if every event was applied.
+ */
+bool Exam::replay(const ExamEventLog &source, std::size_t from) {
+    bool allApplied = true;
+    for (const ExamEvent &event : source.snapshot(from)) {
+        if (!replayEvent(event, source.messageFor(event))) allApplied = false;
+    }
+    return allApplied;
+}
+
+// Check one recorded event against the current state, take its seat if it has one, then apply it
+bool Exam::replayEvent(const ExamEvent &event, const std::string &message) {
+    if (event.type == ExamEventType::IncidentLogged) {
+        return applyEvent(event, 0, message);
+    }
+
+    auto it = studentIndex.find(event.studentID);
+    if (it == studentIndex.end()) return false;
+    std::size_t index = it->second;
+    const Student &s = students[index];
+
+    std::lock_guard<std::mutex> guard(studentLock(index));
+    switch (event.type) {
+        case ExamEventType::CheckedIn: {
+            if (s.getAttendance()) return false;
+            std::lock_guard<std::mutex> seatGuard(seatLock);
+            if (!seatMap.reserve(event.arg0, event.arg1)) return false;
+            seatOccupant[seatSlot(event.arg0, event.arg1)] = static_cast<int>(index);
+            break;
+        }
+        case ExamEventType::CheckInUndone:
+            if (!s.getAttendance() || s.getSubmissionStatus() || onBreakAt(index)) return false;
+            break;
+        case ExamEventType::StudentMoved:
+            if (!s.hasSeat()) return false;
+            break;
+        case ExamEventType::BreakStarted:
+            if (!s.getAttendance() || s.getSubmissionStatus() || onBreakAt(index)) return false;
+            break;
+        case ExamEventType::BreakEnded:
+            if (!onBreakAt(index)) return false;
+            break;
+        case ExamEventType::Submitted:
+            if (!s.getAttendance() || s.getSubmissionStatus()) return false;
+            break;
+        default:
+            return false;
+    }
+    return applyEvent(event, index);
+}
+
+ExamEventLog &Exam::getEventLog() {
+    return eventLog;
+}
+
+// Exam version handed to a student at check-in; the seat decides, so this is one table read
+int Exam::versionFor(int row, int col) const {
+    if (versionsCode.empty()) return 0;
+    return versionsCode.at(seatVersion[seatSlot(row, col)]);
+}
+
+/**
+ * @brief Plans the version of every seat for the current layout.
+ *
+ * Seat (r, c) gets version (r + c) mod k, which differs from all four row and
+ * column neighbours for k of 2 or more. With k of 4 or more, (2r + c) mod k is
+ * used instead; its diagonal neighbours differ by 1 or 3, so they differ too.
+ * The plan is one pass over the seats, well under a millisecond even for halls
+ * of several thousand seats.
+ */
+void Exam::planVersions() {
+    int k = static_cast<int>(versionsCode.size());
+    if (numVersions > 0 && numVersions < k) k = numVersions;
+    k = std::min(k, 255);
+    int rowStep = k >= 4 ? 2 : 1;
+
+    int rows = seatMap.getRows(), cols = seatMap.getCols();
+    seatVersion.resize(static_cast<std::size_t>(rows) * cols);
+    if (k <= 1) {
+        std::fill(seatVersion.begin(), seatVersion.end(), 0);
+        return;
+    }
+    for (int r = 0; r < rows; ++r) {
+        std::uint8_t *seat = seatVersion.data() + seatSlot(r, 0);
+        int v = (r * rowStep) % k;
+        for (int c = 0; c < cols; ++c) {
+            seat[c] = static_cast<std::uint8_t>(v);
+            if (++v == k) v = 0;
+        }
+    }
+}
+
+/**
+ * @brief Applies one event to the exam state and appends it to the event log.
+ *
+ * This is the only place student state and the live counters change once the
+ * roster is loaded. Seat map bookkeeping that depends on the event (freeing a
+ * seat on undo, swapping seats on a move) also happens here; for CheckedIn the
+ * caller has already taken the seat and recorded it in seatOccupant.
+ * Events that take or free a seat are appended while seatLock is held, so a
+ * seat freed by an undo or a move is never logged as taken by someone else
+ * first; replaying the log then seats every student it seated here.
+ * The caller holds the shard lock of the student at index.
+ *
+ * @param event The event to apply.
+ * @param index Position of the student in students; ignored for incidents.
+ * @param message The incident message, empty for other events.
+ * @return false if a move targets a seat that is not free.
+ */
+bool Exam::applyEvent(const ExamEvent &event, std::size_t index, const std::string &message) {
+    auto at = event.at();
+
+    if (event.type == ExamEventType::IncidentLogged) {
+        // The log append stays under the lock so a snapshot never sees the incident without its event
+        std::lock_guard<std::mutex> guard(incidentLock);
+        incidents.add(Incident{event.studentID, event.arg0, at, incidentCategoryFromCode(event.arg2), message});
+        stats.incidents++;
+        eventLog.append(event, message);
+        return true;
+    }
+
+    Student *s = &students[index];
+    std::unique_lock<std::mutex> seatGuard(seatLock, std::defer_lock);
+    switch (event.type) {
+        case ExamEventType::CheckedIn:
+            seatGuard.lock();
+            s->setSeat(event.arg0, event.arg1);
+            s->setExamVersion(event.arg2);
+            s->setAttendance(true);
+            stats.checkedIn++;
+            break;
+
+        case ExamEventType::CheckInUndone:
+            seatGuard.lock();
+            if (s->hasSeat()) {
+                seatMap.release(s->getSeatRow(), s->getSeatCol());
+                seatOccupant[seatSlot(s->getSeatRow(), s->getSeatCol())] = -1;
+            }
+            s->clearSeat();
+            s->setExamVersion(0);
+            s->setAttendance(false);
+            stats.checkedIn--;
+            break;
+
+        case ExamEventType::StudentMoved: {
+            seatGuard.lock();
+            if (!seatMap.reserve(event.arg0, event.arg1)) return false;
+            std::size_t from = seatSlot(s->getSeatRow(), s->getSeatCol());
+            seatMap.release(s->getSeatRow(), s->getSeatCol());
+            seatOccupant[seatSlot(event.arg0, event.arg1)] = static_cast<int>(index);
+            seatOccupant[from] = -1;
+            s->setSeat(event.arg0, event.arg1);
+            break;
+        }
+
+        case ExamEventType::BreakStarted:
+        case ExamEventType::BreakEnded:
+        case ExamEventType::Submitted:
+            applyStudentEvent(event, index, stats);
+            break;
+
+        default:
+            return false;
+    }
+
+    syncColumns(s);
+    eventLog.append(event);
+    return true;
+}
+
+// Caller holds the student's shard lock. Without a batch the event is applied
+// and logged at once; a batch changes the student now and holds the event and
+// its counts back for commitBatch().
+bool Exam::applyOrHold(const ExamEvent &event, std::size_t index, PendingBatch *batch) {
+    if (!batch) return applyEvent(event, index);
+    applyStudentEvent(event, index, batch->counts);
+    syncColumns(&students[index]);
+    batch->events.push_back(event);
+    return true;
+}
+
+// Caller holds the student's shard lock. Break and submission changes, counted
+// into the live counters or into a batch's
+void Exam::applyStudentEvent(const ExamEvent &event, std::size_t index, ExamCounters &counts) {
+    auto at = event.at();
+    switch (event.type) {
+        case ExamEventType::BreakStarted: {
+            startBreakAt(index, at);
+            counts.onBreak++;
+            counts.totalBreaks++;
+            int slot = versionSlot(students[index].getExamVersion());
+            if (slot >= 0) counts.breaksPerVersion[slot]++;
+            break;
+        }
+
+        case ExamEventType::BreakEnded:
+            endBreakAt(index, at);
+            counts.onBreak--;
+            break;
+
+        case ExamEventType::Submitted:
+            students[index].submitExam(at);
+            counts.submitted++;
+            // Events keep microseconds; a submission stamped at the end time itself is not early
+            if (at < std::chrono::time_point_cast<std::chrono::microseconds>(endTime)) counts.earlySubmitted++;
+            break;
+
+        default:
+            break;
     }
+}
+
+// The batch's shard locks are still held, so a snapshot sees all of its changes and events or none
+void Exam::commitBatch(PendingBatch &batch) {
+    stats.add(batch.counts);
+    eventLog.appendBatch(batch.events);
+}
+
+// Position of a version code in versionsCode, or -1; there are only a handful of versions
+int Exam::versionSlot(int versionCode) const {
+    for (std::size_t i = 0; i < versionsCode.size(); ++i) {
+        if (versionsCode[i] == versionCode) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+// Copy a student's state into the columnar mirror
+void Exam::syncColumns(const Student *s) {
+    if (columnarEnabled) {
+        columns.update(static_cast<std::size_t>(s - students.data()), *s);
+    }
+}
+
+void Exam::addProctor(const Proctor &p) {
+    if (proctorIndex.count(p.getID())) return; // skip if already added
+    proctorIndex.emplace(p.getID(), proctors.size());
     proctors.push_back(p);
 }
 
 
 void Exam::addStudent(const Student &s) {
-    for (const auto &existing: students) {
-        if (existing.getID() == s.getID()) return;
-    }
+    if (studentIndex.count(s.getID())) return;
+    studentIndex.emplace(s.getID(), students.size());
     students.push_back(s);
+    students.back().useStringPool(strings);
+    students.back().useBreakLog(breakLog);
+    breakSlot.push_back(-1);
+    if (columnarEnabled) columns.append(s);
+}
+
+void Exam::reserveRoster(std::size_t numStudents, std::size_t numProctors) {
+    students.reserve(numStudents);
+    studentIndex.reserve(numStudents);
+    breakSlot.reserve(numStudents);
+    studentsInBreak.reserve(numStudents);
+    breakLog->reserve(numStudents * Student::RESERVED_BREAKS);
+    if (columnarEnabled) columns.reserve(numStudents);
+    proctors.reserve(numProctors);
+    proctorIndex.reserve(numProctors);
+    eventLog.reserve(numStudents * 4);  // Check-in, break out and back, submission
+}
+
+void Exam::rebuildIndex() {
+    studentIndex.clear();
+    studentIndex.reserve(students.size());
+    for (std::size_t i = 0; i < students.size(); ++i) {
+        studentIndex.emplace(students[i].getID(), i);
+    }
+    breakSlot.resize(students.size(), -1);
+    if (columnarEnabled) columns.assign(students);
+
+    proctorIndex.clear();
+    proctorIndex.reserve(proctors.size());
+    for (std::size_t i = 0; i < proctors.size(); ++i) {
+        proctorIndex.emplace(proctors[i].getID(), i);
+    }
 }
 
 void Exam::setExamDataURL(const std::string &url) {
@@ -59,26 +431,123 @@ void Exam::setExamDataURL(const std::string &url) {
 }
 
 void Exam::initializeSeatMap() {
-    seatMap = std::vector<std::vector<bool> >(maxRow, std::vector<bool>(maxCol, false));
+    // Students hold 16-bit seat coordinates
+    seatMap.reset(std::min(maxRow, Student::MAX_SEAT_INDEX + 1), std::min(maxCol, Student::MAX_SEAT_INDEX + 1));
+    seatOccupant.assign(static_cast<std::size_t>(seatMap.getRows()) * seatMap.getCols(), -1);
+    planVersions();
+}
+
+std::size_t Exam::seatSlot(int row, int col) const {
+    return static_cast<std::size_t>(row) * seatMap.getCols() + col;
+}
+
+bool Exam::releaseSeat(int row, int col) {
+    if (row < 0 || row >= seatMap.getRows() || col < 0 || col >= seatMap.getCols()) return false;
+    std::lock_guard<std::mutex> guard(seatLock);
+    if (seatOccupant[seatSlot(row, col)] >= 0) return false;
+    return seatMap.release(row, col);
+}
+
+int Exam::getSeatVersion(int row, int col) const {
+    if (row < 0 || row >= seatMap.getRows() || col < 0 || col >= seatMap.getCols()) return 0;
+    return versionFor(row, col);
+}
+
+Student *Exam::getStudentAtSeat(int row, int col) {
+    if (row < 0 || row >= seatMap.getRows() || col < 0 || col >= seatMap.getCols()) return nullptr;
+    std::lock_guard<std::mutex> guard(seatLock);
+    int index = seatOccupant[seatSlot(row, col)];
+    return index < 0 ? nullptr : &students[index];
+}
+
+bool Exam::readStudentAtSeat(int row, int col, StudentStatus &out) {
+    if (row < 0 || row >= seatMap.getRows() || col < 0 || col >= seatMap.getCols()) return false;
+    std::size_t slot = seatSlot(row, col);
+    int index;
+    {
+        std::lock_guard<std::mutex> seatGuard(seatLock);
+        index = seatOccupant[slot];
+    }
+
+    // The shard lock comes before the seat lock, so check the occupant is still there once it is held
+    while (index >= 0) {
+        std::lock_guard<std::mutex> guard(studentLock(index));
+        const Student &s = students[index];
+        if (s.hasSeat() && s.getSeatRow() == row && s.getSeatCol() == col) {
+            readStatusAt(static_cast<std::size_t>(index), out);
+            return true;
+        }
+        std::lock_guard<std::mutex> seatGuard(seatLock);
+        int current = seatOccupant[slot];
+        if (current == index) return false;   // A spare batch seat about to be handed back
+        index = current;
+    }
+    return false;
+}
+
+bool Exam::undoCheckIn(int studentID) {
+    Student *s = getStudentByID(studentID);
+    if (!s) return false;
+
+    std::size_t index = static_cast<std::size_t>(s - students.data());
+    std::lock_guard<std::mutex> guard(studentLock(index));
+    if (!s->getAttendance() || s->getSubmissionStatus() || onBreakAt(index)) {
+        return false;
+    }
+
+    return applyEvent(ExamEvent::make(ExamEventType::CheckInUndone, std::chrono::system_clock::now(), studentID), index);
+}
+
+bool Exam::moveStudent(int studentID, int row, int col) {
+    Student *s = getStudentByID(studentID);
+    if (!s) return false;
+
+    std::size_t index = static_cast<std::size_t>(s - students.data());
+    std::lock_guard<std::mutex> guard(studentLock(index));
+    if (!s->hasSeat()) return false;
+    return applyEvent(ExamEvent::make(ExamEventType::StudentMoved, std::chrono::system_clock::now(), studentID, row, col),
+                      index);
+}
+
+bool Exam::reserveSeatBlock(int length, int &row, int &col) {
+    std::lock_guard<std::mutex> guard(seatLock);
+    return seatMap.reserveBlock(length, row, col);
+}
+
+const SeatAllocator &Exam::getSeatAllocator() const {
+    return seatMap;
 }
 
 
 /**
  * @brief Retrieves a pointer to a student by their ID.
  * 
- * Iterates through the list of students and returns a pointer to the student 
- * whose ID matches the given studentID.
+ * Looks the ID up in the student index and returns a pointer to the matching
+ * entry of the student list.
  * 
  * @param studentID The unique identifier of the student.
  * @return Pointer to the matching Student object, or nullptr if not found.
  */
- Student *Exam::getStudentByID(int studentID) {
-    for (Student &s : students) {
-        if (s.getID() == studentID) {
-            return &s;
-        }
+Student *Exam::getStudentByID(int studentID) {
+    auto it = studentIndex.find(studentID);
+    if (it == studentIndex.end()) {
+        return nullptr;
     }
-    return nullptr;
+    return &students[it->second];
+}
+
+/**
+ * @brief Retrieves a pointer to a proctor by their ID.
+ *
+ * @param proctorID The unique identifier of the proctor.
+ * @return Pointer to the matching Proctor object, or nullptr if not found.
+ */
+Proctor *Exam::getProctorByID(int proctorID) {
+    auto it = proctorIndex.find(proctorID);
+    if (it == proctorIndex.end()) {
+        return nullptr;
+    }
+    return &proctors[it->second];
 }
 
 /**
@@ -86,76 +555,98 @@ void Exam::initializeSeatMap() {
  * 
  * Searches for the student using the provided studentID. If the student exists
  * and hasn't already checked in, assigns an available seat and exam version, marks 
- * attendance, and returns a pointer to the student. Otherwise, logs an error message.
+ * attendance, and returns a pointer to the student. Nothing is formatted or
+ * printed; the caller reports the outcome, and the event log records it.
  * 
  * @param studentID The unique identifier of the student to check in.
- * @return Pointer to the Student object after successful check-in, or nullptr on failure.
+ * @return Pointer to the Student object after successful check-in, or nullptr if
+ *         the ID is unknown, the student is already checked in or the room is full.
  */
 Student *Exam::checkIn(int studentID) {
     Student *s = getStudentByID(studentID);
-    if (!s) {
-        std::cerr << "Student ID not found: " << studentID << std::endl;
-        return nullptr;
-    }
+    if (!s) return nullptr;
 
-    if (s->getAttendance()) {
-        std::cout << "Student already checked in.\n";
-        return nullptr;
-    }
+    std::size_t index = static_cast<std::size_t>(s - students.data());
+    std::lock_guard<std::mutex> guard(studentLock(index));
+    if (s->getAttendance()) return nullptr;
 
     // Assign first available seat
-    bool seatAssigned = false;
-    for (int row = 0; row < maxRow && !seatAssigned; ++row) {
-        for (int col = 0; col < maxCol; ++col) {
-            if (!seatMap[row][col]) {
-                std::string seatLabel = "Row: " + std::to_string(row + 1) +
-                                        "\nColum: " + std::to_string(col + 1);
-                s->setSeatNum(seatLabel);
-                seatMap[row][col] = true;
-                seatAssigned = true;
-                break;
-            }
-        }
+    int row, col;
+    {
+        std::lock_guard<std::mutex> seatGuard(seatLock);
+        if (!seatMap.allocate(row, col)) return nullptr;
+        seatOccupant[seatSlot(row, col)] = static_cast<int>(index);
     }
 
-    if (!seatAssigned) {
-        std::cerr << "No available seat for student.\n";
-        return nullptr;
-    }
-
-    // Assign version
-    totalPresent++;
-    int versionIndex = studentID % numVersions;
-    s->setExamVersion(versionsCode.at(versionIndex));
-
-    // Mark attendance
-    s->setAttendance(true);
-
-    std::cout << "Student " << studentID << " checked in successfully.\n";
+    // Assign seat, version and attendance
+    applyEvent(ExamEvent::make(ExamEventType::CheckedIn, std::chrono::system_clock::now(), studentID,
+                               row, col, versionFor(row, col)), index);
     return s;
 }
 
 /**
  * @brief Processes a washroom break request for a student.
  * 
- * Determines if the current time is within the allowed break window. If the 
- * student is eligible for a break, toggles the break status (entering or returning 
- * from break) and returns a message indicating the action and timestamps. Otherwise, 
- * returns an error message.
+ * Toggles the break status (entering or returning from break) with
+ * toggleBreak() and returns a message indicating the action and timestamps,
+ * or an error message, from describeBreak().
  * 
  * @param studentID The unique identifier of the student requesting a break.
  * @return A message string describing the result of the break request.
  */
 std::string Exam::washroomBreak(int studentID) {
-    using namespace std::chrono;
+    std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
+    return describeBreak(studentID, toggleBreak(studentID, now), now);
+}
 
-    // Get current time and define break window
-    system_clock::time_point now = system_clock::now();
-    system_clock::time_point earliestBreak = startTime + minutes(30);
-    system_clock::time_point latestBreak = endTime - minutes(15);
+/**
+ * @brief Starts or ends a washroom break for one student.
+ *
+ * The break window is checked at the given time. Nothing is formatted. A
+ * break is appended to the exam's BreakLog, which allocates only when the log
+ * itself grows past the room it has reserved.
+ *
+ * @param studentID The student requesting a break.
+ * @param at The time recorded for the break.
+ * @return BreakStarted or BreakEnded, or why nothing changed: OutsideBreakWindow,
+ *         NotFound or Ineligible.
+ */
+BatchStatus Exam::toggleBreak(int studentID, std::chrono::system_clock::time_point at) {
+    if (!breakWindowOpen(at)) return BatchStatus::OutsideBreakWindow;
+    Student *s = getStudentByID(studentID);
+    if (!s) return BatchStatus::NotFound;
+
+    std::size_t index = static_cast<std::size_t>(s - students.data());
+    std::lock_guard<std::mutex> guard(studentLock(index));
+    return toggleBreakAt(index, at);
+}
+
+// Caller holds the student's shard lock and has checked the break window
+BatchStatus Exam::toggleBreakAt(std::size_t index, std::chrono::system_clock::time_point at, PendingBatch *batch) {
+    const Student &s = students[index];
+    if (!s.getAttendance() || s.getSubmissionStatus()) return BatchStatus::Ineligible;
+
+    if (onBreakAt(index)) {
+        applyOrHold(ExamEvent::make(ExamEventType::BreakEnded, at, s.getID()), index, batch);
+        return BatchStatus::BreakEnded;
+    }
+    applyOrHold(ExamEvent::make(ExamEventType::BreakStarted, at, s.getID()), index, batch);
+    return BatchStatus::BreakStarted;
+}
 
-    if (now < earliestBreak) {
-        auto waitDuration = duration_cast<seconds>(earliestBreak - now);
+/**
+ * @brief Formats the message shown for the outcome of a break request.
+ *
+ * @param studentID The student who requested the break.
+ * @param status The outcome returned by toggleBreak().
+ * @param at The time the request was made.
+ * @return The message for the desk.
+ */
+std::string Exam::describeBreak(int studentID, BatchStatus status, std::chrono::system_clock::time_point at) {
+    using namespace std::chrono;
+
+    if (status == BatchStatus::OutsideBreakWindow && at < startTime + minutes(30)) {
+        auto waitDuration = duration_cast<seconds>(startTime + minutes(30) - at);
         int minutesLeft = waitDuration.count() / 60;
         int secondsLeft = waitDuration.count() % 60;
 
@@ -166,101 +657,290 @@ std::string Exam::washroomBreak(int studentID) {
         return oss.str();
     }
 
-    if (now > latestBreak) {
+    if (status == BatchStatus::OutsideBreakWindow) {
         return "Washroom break not allowed: Within the last 15 minutes of the exam.";
     }
-
-    // Lookup student
-    Student* student = getStudentByID(studentID);
-    if (!student || !student->getAttendance() || student->getSubmissionStatus()) {
+    if (status != BatchStatus::BreakStarted && status != BatchStatus::BreakEnded) {
         return "Invalid student number or student is ineligible for a break.";
     }
 
-    auto it = std::find(studentsInBreak.begin(), studentsInBreak.end(), studentID);
-    if (it != studentsInBreak.end()) {
-        student->returnFromBreak();
-        studentsInBreak.erase(it);
-        Break* lastBreak = student->getBreaksList()->empty() ? nullptr : &student->getBreaksList()->back();
-
-        return "Student: " + student->getName() + " (" + std::to_string(studentID) + ") Returned from break.\n\n" +
-               "You left at " + lastBreak->getStartTime() +
-               "\nYou returned at " + lastBreak->getEndTime() +
-               "\nTotal time of " + lastBreak->getDuration();
+    Student *student = getStudentByID(studentID);
+    std::size_t index = static_cast<std::size_t>(student - students.data());
+    std::lock_guard<std::mutex> guard(studentLock(index));
+    Break lastBreak = student->getBreaksList().back();
+    std::ostringstream oss;
+    oss << "Student: " << student->getName() << " (" << studentID << ") ";
+    if (status == BatchStatus::BreakEnded) {
+        oss << "Returned from break.\n\n"
+            << "You left at " << lastBreak.getStartTime()
+            << "\nYou returned at " << lastBreak.getEndTime()
+            << "\nTotal time of " << lastBreak.getDuration();
     } else {
-        student->leaveForBreak();
-        studentsInBreak.push_back(studentID);
-        Break* currentBreak = student->getBreaksList()->empty() ? nullptr : &student->getBreaksList()->back();
+        oss << "Leaving for break.\n\n"
+            << "You leave at " << lastBreak.getStartTime();
+    }
+    return oss.str();
+}
+
+// Every ID is stamped with the same time
+std::vector<BatchResult> Exam::checkInBatch(const std::vector<int> &studentIDs,
+                                            std::chrono::system_clock::time_point at) {
+    return checkInBatch(studentIDs, std::vector<std::chrono::system_clock::time_point>(studentIDs.size(), at));
+}
+
+/**
+ * @brief Checks in a batch of students, each at their own time.
+ *
+ * The batch is validated first, then seats for every valid student are taken in
+ * one allocator pass. Each student is claimed under their shard lock only after
+ * the seats are taken; a student who was checked in meanwhile, by another
+ * station or by a duplicate ID in the same batch, is reported as AlreadyDone and
+ * their spare seat is handed back.
+ *
+ * @param studentIDs The students to check in.
+ * @param times The time recorded for each ID.
+ * @return One result per ID, in the same order.
+ */
+std::vector<BatchResult> Exam::checkInBatch(const std::vector<int> &studentIDs,
+                                            const std::vector<std::chrono::system_clock::time_point> &times) {
+    std::vector<BatchResult> results;
+    results.reserve(studentIDs.size());
+
+    // Pass 1: validate
+    std::vector<Student *> pending;
+    std::vector<std::size_t> pendingResult;
+    for (int id : studentIDs) {
+        Student *s = getStudentByID(id);
+        if (!s) {
+            results.push_back({id, BatchStatus::NotFound});
+            continue;
+        }
+        std::size_t index = static_cast<std::size_t>(s - students.data());
+        std::lock_guard<std::mutex> guard(studentLock(index));
+        if (s->getAttendance()) {
+            results.push_back({id, BatchStatus::AlreadyDone});
+        } else {
+            pending.push_back(s);
+            pendingResult.push_back(results.size());
+            results.push_back({id, BatchStatus::CheckedIn});
+        }
+    }
+
+    // Pass 2: one sweep over the seat bitmap for the whole batch
+    std::vector<int> rows, cols;
+    rows.reserve(pending.size());
+    cols.reserve(pending.size());
+    int seated;
+    {
+        std::lock_guard<std::mutex> seatGuard(seatLock);
+        seated = seatMap.allocateMany(static_cast<int>(pending.size()), rows, cols);
+        for (int i = 0; i < seated; ++i) {
+            seatOccupant[seatSlot(rows[i], cols[i])] = static_cast<int>(pending[i] - students.data());
+        }
+    }
+
+    // Pass 3: claim each student, keeping track of seats nobody ended up taking
+    std::vector<int> spare;
+    for (std::size_t i = 0; i < pending.size(); ++i) {
+        if (static_cast<int>(i) >= seated) {
+            results[pendingResult[i]].status = BatchStatus::NoSeat;
+            continue;
+        }
+        std::size_t index = static_cast<std::size_t>(pending[i] - students.data());
+        std::lock_guard<std::mutex> guard(studentLock(index));
+        if (pending[i]->getAttendance()) {
+            results[pendingResult[i]].status = BatchStatus::AlreadyDone;
+            spare.push_back(static_cast<int>(i));
+        } else {
+            applyEvent(ExamEvent::make(ExamEventType::CheckedIn, times[pendingResult[i]], pending[i]->getID(),
+                                       rows[i], cols[i], versionFor(rows[i], cols[i])), index);
+        }
+    }
 
-        return "Student: " + student->getName() + " (" + std::to_string(studentID) + ") Leaving for break.\n\n" +
-               "You leave at " + currentBreak->getStartTime();
+    if (!spare.empty()) {
+        std::lock_guard<std::mutex> seatGuard(seatLock);
+        for (int i : spare) {
+            seatMap.release(rows[i], cols[i]);
+            seatOccupant[seatSlot(rows[i], cols[i])] = -1;
+        }
     }
+    return results;
+}
+
+/**
+ * @brief Toggles washroom breaks for a batch of students with one shared timestamp.
+ *
+ * @param studentIDs The students to toggle.
+ * @param at The time recorded for every break in the batch.
+ * @return One result per ID, in the same order.
+ */
+std::vector<BatchResult> Exam::toggleBreakBatch(const std::vector<int> &studentIDs,
+                                                std::chrono::system_clock::time_point at) {
+    return toggleBreakBatch(studentIDs, std::vector<std::chrono::system_clock::time_point>(studentIDs.size(), at));
+}
+
+/**
+ * @brief Toggles washroom breaks for a batch of students, each at their own time.
+ *
+ * IDs and break windows are checked for the whole batch first. The shards of
+ * every student left are then held together while each is toggled in order,
+ * holding the events back, and the batch is committed before they are let go.
+ *
+ * @param studentIDs The students to toggle.
+ * @param times The time recorded for each ID.
+ * @return One result per ID, in the same order.
+ */
+std::vector<BatchResult> Exam::toggleBreakBatch(const std::vector<int> &studentIDs,
+                                                const std::vector<std::chrono::system_clock::time_point> &times) {
+    std::vector<BatchResult> results;
+    results.reserve(studentIDs.size());
+
+    // Pass 1: validate
+    std::vector<std::size_t> pending;
+    std::vector<std::size_t> pendingResult;
+    for (std::size_t i = 0; i < studentIDs.size(); ++i) {
+        int id = studentIDs[i];
+        if (!breakWindowOpen(times[i])) {
+            results.push_back({id, BatchStatus::OutsideBreakWindow});
+            continue;
+        }
+        Student *s = getStudentByID(id);
+        if (!s) {
+            results.push_back({id, BatchStatus::NotFound});
+            continue;
+        }
+        pending.push_back(static_cast<std::size_t>(s - students.data()));
+        pendingResult.push_back(results.size());
+        results.push_back({id, BatchStatus::Ineligible});
+    }
+    if (pending.empty()) return results;
+
+    // Pass 2: toggle in order under the batch's shard locks, then count and log once
+    PendingBatch batch(versionsCode.size(), pending.size());
+    auto held = lockShards(pending);
+    for (std::size_t i = 0; i < pending.size(); ++i) {
+        results[pendingResult[i]].status = toggleBreakAt(pending[i], times[pendingResult[i]], &batch);
+    }
+    commitBatch(batch);
+    return results;
+}
+
+/**
+ * @brief Submits a batch of exams with one shared timestamp.
+ *
+ * @param studentIDs The students submitting.
+ * @param at The submission time recorded for the batch.
+ * @return One result per ID, in the same order.
+ */
+std::vector<BatchResult> Exam::submitBatch(const std::vector<int> &studentIDs,
+                                           std::chrono::system_clock::time_point at) {
+    return submitBatch(studentIDs, std::vector<std::chrono::system_clock::time_point>(studentIDs.size(), at));
+}
+
+/**
+ * @brief Submits a batch of exams, each at their own time.
+ *
+ * IDs are checked for the whole batch first. Each student left then goes
+ * through trySubmitAt() in order under the batch's shard locks, and the batch
+ * is committed before they are let go. A student out on a break may be
+ * brought back, so a batch holds up to two events per student.
+ *
+ * @param studentIDs The students submitting.
+ * @param times The submission time recorded for each ID.
+ * @return One result per ID, in the same order.
+ */
+std::vector<BatchResult> Exam::submitBatch(const std::vector<int> &studentIDs,
+                                           const std::vector<std::chrono::system_clock::time_point> &times) {
+    std::vector<BatchResult> results;
+    results.reserve(studentIDs.size());
+
+    // Pass 1: validate
+    std::vector<std::size_t> pending;
+    std::vector<std::size_t> pendingResult;
+    for (int id : studentIDs) {
+        Student *s = getStudentByID(id);
+        if (!s) {
+            results.push_back({id, BatchStatus::NotFound});
+            continue;
+        }
+        pending.push_back(static_cast<std::size_t>(s - students.data()));
+        pendingResult.push_back(results.size());
+        results.push_back({id, BatchStatus::Ineligible});
+    }
+    if (pending.empty()) return results;
+
+    // Pass 2: submit in order under the batch's shard locks, then count and log once
+    PendingBatch batch(versionsCode.size(), 2 * pending.size());
+    auto held = lockShards(pending);
+    for (std::size_t i = 0; i < pending.size(); ++i) {
+        results[pendingResult[i]].status = trySubmitAt(pending[i], times[pendingResult[i]], &batch);
+    }
+    commitBatch(batch);
+    return results;
 }
 
 /**
  * @brief Logs an incident involving a student and a proctor.
  * 
- * Formats and appends an incident report message to the internal incident log.
- * Optionally prints the incident message to the console for debugging purposes.
+ * Adds a typed incident record to the incident store, indexed by student and
+ * by proctor. The desk log records it through the event log.
  * 
  * @param studentID The unique identifier of the student involved.
  * @param proctorID The unique identifier of the proctor involved.
  * @param incidentMsg A description of the incident.
+ * @param category The kind of incident.
  */
-void Exam::writeIncident(int studentID, int proctorID, const std::string &incidentMsg) {
-    // Log the incident
-    std::ostringstream report;
-    report << "Student: " << studentID
-           << "; Proctor: " << proctorID
-           << "; Message: " << incidentMsg << std::endl;
+void Exam::writeIncident(int studentID, int proctorID, const std::string &incidentMsg, IncidentCategory category) {
+    writeIncident(studentID, proctorID, incidentMsg, category, std::chrono::system_clock::now());
+}
 
-    incidentReport.push_back(report.str());
-    std::cout << report.str(); // Optional: for debug logging
+void Exam::writeIncident(int studentID, int proctorID, const std::string &incidentMsg, IncidentCategory category,
+                         std::chrono::system_clock::time_point at) {
+    applyEvent(ExamEvent::make(ExamEventType::IncidentLogged, at, studentID, proctorID, 0, static_cast<int>(category)),
+               0, incidentMsg);
 }
 
 /**
  * @brief Checks if a student with the given ID exists.
  * 
- * Iterates through the students to determine if any student's ID matches the given id.
+ * Looks the ID up in the student index.
  * 
  * @param id The unique identifier of the student.
  * @return True if a student with the specified ID exists, false otherwise.
  */
 bool Exam::hasStudent(int id) {
-    return std::any_of(students.begin(), students.end(),
-                       [id](Student &s) { return s.getID() == id; });
+    return studentIndex.count(id) != 0;
 }
 
 /**
  * @brief Checks if a proctor with the given ID exists.
  * 
- * Iterates through the proctors to determine if any proctor's ID matches the given id.
+ * Looks the ID up in the proctor index.
  * 
  * @param id The unique identifier of the proctor.
  * @return True if a proctor with the specified ID exists, false otherwise.
  */
 bool Exam::hasProctor(int id) {
-    return std::any_of(proctors.begin(), proctors.end(),
-                       [id](Proctor &p) { return p.getID() == id; });
+    return proctorIndex.count(id) != 0;
 }
 
 /**
  * @brief Processes an early exam submission for a student.
  * 
  * Checks if the student exists, has attended the exam, and has not already submitted.
- * If so, the student's exam is submitted.
+ * If so, the student's exam is submitted; a student out on a break has the
+ * break ended first.
  * 
  * @param studentID The unique identifier of the student.
  * @return True if the submission was processed successfully, false otherwise.
  */
 bool Exam::earlySubmission(int studentID) {
-    // Submit the exam
-    for (Student &s : students) {
-        if (s.getID() == studentID && s.getAttendance() && !s.getSubmissionStatus()) {
-            s.submitExam();
-            return true;
-        }
-    }
-    return false;
+    Student *s = getStudentByID(studentID);
+    if (!s) return false;
+
+    std::size_t index = static_cast<std::size_t>(s - students.data());
+    std::lock_guard<std::mutex> guard(studentLock(index));
+    return trySubmitAt(index, std::chrono::system_clock::now()) == BatchStatus::Submitted;
 }
 
 /**
@@ -269,12 +949,66 @@ bool Exam::earlySubmission(int studentID) {
  * Iterates through all students and submits the exam for those who have attended but have not yet submitted.
  */
 void Exam::endOfTimeSubmission() {
-    for (Student &s : students) {
+    // Every remaining student shares one submission timestamp
+    auto now = std::chrono::system_clock::now();
+    for (std::size_t i = 0; i < students.size(); ++i) {
+        Student &s = students[i];
+        std::lock_guard<std::mutex> guard(studentLock(i));
         // Only set final submission time for students who attended and haven't submitted
-        if (s.getAttendance() && !s.getSubmissionStatus()) {
-            s.submitExam();
+        if (s.getAttendance() && !s.getSubmissionStatus() && endTime + s.getExtraTime() <= now) {
+            submitAt(i, now);
+        }
+    }
+}
+
+std::chrono::system_clock::time_point Exam::getDeadline(int studentID) const {
+    auto it = studentIndex.find(studentID);
+    if (it == studentIndex.end()) return endTime;
+    return endTime + students[it->second].getExtraTime();
+}
+
+std::size_t Exam::submitDue(std::chrono::system_clock::time_point at) {
+    std::size_t submitted = 0;
+    for (std::size_t i = 0; i < students.size(); ++i) {
+        Student &s = students[i];
+        auto deadline = endTime + s.getExtraTime();
+        if (deadline > at) continue;
+        std::lock_guard<std::mutex> guard(studentLock(i));
+        if (s.getAttendance() && !s.getSubmissionStatus() && submitAt(i, deadline)) {
+            submitted++;
         }
     }
+    return submitted;
+}
+
+bool Exam::submitAtDeadline(int studentID) {
+    Student *s = getStudentByID(studentID);
+    if (!s) return false;
+
+    std::size_t index = static_cast<std::size_t>(s - students.data());
+    std::lock_guard<std::mutex> guard(studentLock(index));
+    if (!s->getAttendance() || s->getSubmissionStatus()) return false;
+    return submitAt(index, endTime + s->getExtraTime());
+}
+
+// Caller holds the student's shard lock. A student still out on a break when
+// they hand in, early or when time runs out, is brought back at the same
+// moment, so the break is closed in the log and the break monitor stops
+// waiting for them.
+bool Exam::submitAt(std::size_t index, std::chrono::system_clock::time_point at, PendingBatch *batch) {
+    int studentID = students[index].getID();
+    if (onBreakAt(index)) applyOrHold(ExamEvent::make(ExamEventType::BreakEnded, at, studentID), index, batch);
+    return applyOrHold(ExamEvent::make(ExamEventType::Submitted, at, studentID), index, batch);
+}
+
+// Caller holds the student's shard lock. The checks every early submission
+// goes through, alone or in a batch
+BatchStatus Exam::trySubmitAt(std::size_t index, std::chrono::system_clock::time_point at, PendingBatch *batch) {
+    const Student &s = students[index];
+    if (s.getSubmissionStatus()) return BatchStatus::AlreadyDone;
+    if (!s.getAttendance()) return BatchStatus::Ineligible;
+    submitAt(index, at, batch);
+    return BatchStatus::Submitted;
 }
 
 /**
@@ -282,7 +1016,8 @@ void Exam::endOfTimeSubmission() {
  * 
  * Converts the exam start and end times to string format, extracts relevant date and time information, 
  * and invokes the PDFReportGenerator to create a report including course details, student and proctor lists,
- * and incident reports.
+ * and incident reports. Every lock is held while the report is written, so it matches one point in the
+ * event log even if stations are still running.
  * 
  * @param fileName The name (or path) of the file to generate the report.
  */
@@ -293,6 +1028,8 @@ void Exam::generateReport(const std::string &fileName) {
     std::string examStart = startTimeStr.substr(11, 5);
     std::string examEnd = endTimeStr.substr(11, 5);
 
+    // Stations wait for the report instead of the report copying the roster, breaks and incidents
+    std::vector<std::unique_lock<std::mutex>> held = lockAll();
     PDFReportGenerator::generate(
         fileName,
         courseNum,
@@ -303,8 +1040,10 @@ void Exam::generateReport(const std::string &fileName) {
         examStart,
         examEnd,
         students,
+        *breakLog,
         proctors,
-        incidentReport
+        incidents.all(),
+        stats.snapshot()
     );
 }
 
@@ -319,7 +1058,7 @@ void Exam::setTermNum(int termNum) {
 }
 
 // Getter and Setter for termName
-std::string Exam::getTermName() const {
+const std::string &Exam::getTermName() const {
     return termName;
 }
 
@@ -328,7 +1067,7 @@ void Exam::setTermName(const std::string &termName) {
 }
 
 // Getter and Setter for courseNum
-std::string Exam::getCourseNum() const {
+const std::string &Exam::getCourseNum() const {
     return courseNum;
 }
 
@@ -337,7 +1076,7 @@ void Exam::setCourseNum(std::string courseNum) {
 }
 
 // Getter and Setter for rmNum
-std::string Exam::getRmNum() const {
+const std::string &Exam::getRmNum() const {
     return rmNum;
 }
 
@@ -382,12 +1121,13 @@ void Exam::setNumVersions(int numVersions) {
 }
 
 // Getter and Setter for versionsCode
-std::vector<int> Exam::getVersionsCode() const {
+const std::vector<int> &Exam::getVersionsCode() const {
     return versionsCode;
 }
 
 void Exam::setVersionsCode(std::vector<int> codes) {
     this->versionsCode = codes;
+    stats.resetVersions(versionsCode.size());
 }
 
 // Getter and Setter for startTime
@@ -409,7 +1149,7 @@ void Exam::setEndTime(const std::chrono::system_clock::time_point &endTime) {
 }
 
 // Getter for examReport_URL
-std::string Exam::getReportURL() const {
+const std::string &Exam::getReportURL() const {
     return examReport_URL;
 }
 
@@ -417,18 +1157,84 @@ std::vector<Student> &Exam::getStudents() {
     return students;
 }
 
+const std::shared_ptr<StringPool> &Exam::getStringPool() const {
+    return strings;
+}
+
+const std::shared_ptr<BreakLog> &Exam::getBreakLog() const {
+    return breakLog;
+}
+
 std::vector<Proctor> &Exam::getProctors() {
     return proctors;
 }
 
+void Exam::setColumnarRoster(bool enabled) {
+    columnarEnabled = enabled;
+    if (enabled) {
+        columns.assign(students);
+    } else {
+        columns = RosterColumns();
+    }
+}
+
+bool Exam::isColumnarRoster() const {
+    return columnarEnabled;
+}
+
+const RosterColumns &Exam::getRosterColumns() const {
+    return columns;
+}
+
+int Exam::countPresent() const {
+    if (columnarEnabled) return columns.countAttended();
+    int total = 0;
+    for (const Student &s : students) total += s.getAttendance();
+    return total;
+}
+
+int Exam::countSubmitted() const {
+    if (columnarEnabled) return columns.countSubmitted();
+    int total = 0;
+    for (const Student &s : students) total += s.getSubmissionStatus();
+    return total;
+}
+
+int Exam::countEarlySubmissions() const {
+    if (columnarEnabled) return columns.countSubmittedBefore(endTime);
+    // Same resolution as the earlySubmitted counter
+    auto deadline = std::chrono::time_point_cast<std::chrono::microseconds>(endTime);
+    int total = 0;
+    for (const Student &s : students) {
+        total += s.getSubmissionStatus() && s.getSubmissionTimePoint() < deadline;
+    }
+    return total;
+}
+
+int Exam::countBreaks() const {
+    if (columnarEnabled) return columns.countBreaks();
+    int total = 0;
+    for (const Student &s : students) total += static_cast<int>(s.getBreakCount());
+    return total;
+}
+
+ExamStats Exam::getStats() const {
+    return stats.snapshot();
+}
+
 int Exam::getTotalPresent() const {
-    return totalPresent;
+    return stats.checkedIn;
 }
 
 void Exam::setTotalPresent(int totalPresent) {
-    this->totalPresent = totalPresent;
+    stats.checkedIn = totalPresent;
+}
+
+const IncidentStore &Exam::getIncidents() const {
+    return incidents;
 }
 
-std::vector<std::string> Exam::getIncidentReport() const {
-    return incidentReport;
+std::vector<Incident> Exam::copyIncidents() const {
+    std::lock_guard<std::mutex> guard(incidentLock);
+    return incidents.all();
 }
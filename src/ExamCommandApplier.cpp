@@ -0,0 +1,134 @@
+/**
+ * @file ExamCommandApplier.cpp
+ * @brief Implementation of the ExamCommandApplier class.
+ *
+ * Consecutive commands of the same type for the same exam are applied as one
+ * batch, each at the time its station received it. A run is split where a
+ * student appears a second time, so one command for a student is applied
+ * before the next one is looked at. Commands for no open exam are reported as
+ * NotFound.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include "ExamCommandApplier.h"
+#include <algorithm>
+#include <chrono>
+
+// Constructor
+ExamCommandApplier::ExamCommandApplier(const SessionManager *sessions, CommandQueue *queue, QObject *parent)
+    : QThread(parent), sessions(sessions), queue(queue), stopRequested(false) {
+    qRegisterMetaType<ExamCommandType>("ExamCommandType");
+    qRegisterMetaType<BatchStatus>("BatchStatus");
+    batch.reserve(MAX_BATCH);
+    targets.reserve(MAX_BATCH);
+    ids.reserve(MAX_BATCH);
+    times.reserve(MAX_BATCH);
+}
+
+// Destructor
+ExamCommandApplier::~ExamCommandApplier() {
+    stop();
+    wait();
+}
+
+void ExamCommandApplier::startApplying() {
+    if (isRunning()) return;
+    stopRequested.store(false);
+    start();
+}
+
+void ExamCommandApplier::stop() {
+    stopRequested.store(true);
+    queue->wake();
+}
+
+void ExamCommandApplier::run() {
+    while (!stopRequested.load()) {
+        if (queue->waitForCommands(std::chrono::milliseconds(100))) {
+            drainOnce();
+        }
+    }
+    // Nothing accepted by the queue is dropped on shutdown
+    while (drainOnce()) {
+    }
+}
+
+// Apply up to MAX_BATCH queued commands; returns false if the queue was empty
+bool ExamCommandApplier::drainOnce() {
+    batch.clear();
+    if (queue->popBatch(batch, MAX_BATCH) == 0) return false;
+
+    // The exams found below stay open until the whole batch is applied
+    std::shared_lock<std::shared_mutex> inUse = sessions->holdExams();
+    targets.clear();
+    for (const ExamCommand &c : batch) targets.push_back(sessions->findExam(c.examKey, c.studentID, c.at));
+
+    std::size_t begin = 0;
+    while (begin < batch.size()) {
+        ids.clear();
+        times.clear();
+        std::size_t end = begin;
+        while (end < batch.size() && batch[end].type == batch[begin].type && targets[end] == targets[begin] &&
+               std::find(ids.begin(), ids.end(), batch[end].studentID) == ids.end()) {
+            ids.push_back(batch[end].studentID);
+            times.push_back(batch[end].at);
+            ++end;
+        }
+        applyRun(begin, end);
+        begin = end;
+    }
+
+    emit queueStats(queue->depth(), queue->getHighWater(), queue->getRejectedCount());
+    return true;
+}
+
+// Apply batch[begin, end), which share one command type and one exam and name each
+// student at most once; ids and times already hold the run's students and times
+void ExamCommandApplier::applyRun(std::size_t begin, std::size_t end) {
+    ExamCommandType type = batch[begin].type;
+    Exam *exam = targets[begin];
+
+    if (!exam) {
+        for (std::size_t i = begin; i < end; ++i) {
+            emit commandApplied(QString::fromStdString(batch[i].examKey), type, batch[i].studentID,
+                                BatchStatus::NotFound);
+        }
+        return;
+    }
+
+    QString key = QString::fromStdString(SessionManager::sessionKey(*exam));
+    if (type == ExamCommandType::Incident) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const ExamCommand &c = batch[i];
+            BatchStatus status = BatchStatus::NotFound;
+            if (exam->hasStudent(c.studentID) && exam->hasProctor(c.proctorID)) {
+                exam->writeIncident(c.studentID, c.proctorID, c.message, c.category, c.at);
+                status = BatchStatus::Logged;
+            }
+            emit commandApplied(key, type, c.studentID, status);
+        }
+        return;
+    }
+
+    std::vector<BatchResult> results;
+    switch (type) {
+        case ExamCommandType::CheckIn:
+            results = exam->checkInBatch(ids, times);
+            break;
+        case ExamCommandType::ToggleBreak:
+            results = exam->toggleBreakBatch(ids, times);
+            break;
+        case ExamCommandType::Submit:
+            results = exam->submitBatch(ids, times);
+            break;
+        default:
+            break;
+    }
+
+    for (const BatchResult &r : results) {
+        emit commandApplied(key, type, r.studentID, r.status);
+    }
+}
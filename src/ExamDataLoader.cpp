@@ -11,83 +11,161 @@
  */
 
 #include "../include/ExamDataLoader.h"
-#include <fstream>
-#include <sstream>
+#include <array>
+#include <charconv>
 #include <iostream>
 #include <algorithm>
-#include <stdexcept>
+#include <chrono>
+#include <string_view>
+#include "../include/MappedFile.h"
 #include "../include/Utils.h"
 
+namespace {
+    // Walks the lines of a mapped file; views point into the mapping
+    struct LineReader {
+        const char *pos;
+        const char *end;
+
+        bool next(std::string_view &line) {
+            if (pos >= end) return false;
+            const char *newline = std::find(pos, end, '\n');
+            line = std::string_view(pos, static_cast<std::size_t>(newline - pos));
+            pos = newline == end ? end : newline + 1;
+            return true;
+        }
+    };
+
+    std::string_view trimView(std::string_view text) {
+        std::size_t first = 0, last = text.size();
+        while (first < last && std::isspace(static_cast<unsigned char>(text[first]))) ++first;
+        while (last > first && std::isspace(static_cast<unsigned char>(text[last - 1]))) --last;
+        return text.substr(first, last - first);
+    }
+
+    // The value before ";;", if present, trimmed
+    std::string_view valueOf(std::string_view line) {
+        return trimView(line.substr(0, line.find(";;")));
+    }
+
+    // Reads a leading integer the way std::stoi does, without the exception
+    bool parseInt(std::string_view text, int &value) {
+        text = trimView(text);
+        if (!text.empty() && text[0] == '+') text.remove_prefix(1);
+        return std::from_chars(text.data(), text.data() + text.size(), value).ec == std::errc();
+    }
+
+    // Splits a row at commas into trimmed fields; returns the field count, which may exceed fields.size()
+    template <std::size_t N>
+    std::size_t splitFields(std::string_view row, std::array<std::string_view, N> &fields) {
+        std::size_t count = 0;
+        while (true) {
+            std::size_t comma = row.find(',');
+            if (count < N) fields[count] = trimView(row.substr(0, comma));
+            count++;
+            if (comma == std::string_view::npos) return count;
+            row.remove_prefix(comma + 1);
+        }
+    }
+}
+
 bool ExamDataLoader::loadExamData(const std::string &dataPath, Exam &exam) {
     try {
-        std::ifstream infile(dataPath);
-        if (!infile) {
+        // The file is tokenized in place; roster text is copied once, into the exam's string pool
+        MappedFile file;
+        if (!file.open(dataPath)) {
             std::cerr << "Error: Cannot open file " << dataPath << std::endl;
             return false;
         }
-
-        std::string line;
+        LineReader lines{file.data(), file.data() + file.size()};
+        std::string_view line;
+        int number;
 
         exam.setExamDataURL(dataPath);
 
-        if (std::getline(infile, line)) exam.setTermNum(std::stoi(trim(getValue(line))));
-        if (std::getline(infile, line)) exam.setTermName(trim(getValue(line)));
-        if (std::getline(infile, line)) exam.setCourseNum(trim(getValue(line)));
-        if (std::getline(infile, line)) exam.setRmNum(trim(getValue(line)));
-        if (std::getline(infile, line)) exam.setCapacity(std::stoi(trim(getValue(line))));
-        if (std::getline(infile, line)) exam.setMaxRow(std::stoi(trim(getValue(line))));
-        if (std::getline(infile, line)) exam.setMaxCol(std::stoi(trim(getValue(line))));
-        if (std::getline(infile, line)) exam.setNumVersions(std::stoi(trim(getValue(line))));
-
-        if (std::getline(infile, line)) {
-            std::stringstream ss(trim(getValue(line)));
-            std::string token;
+        auto readInt = [&](void (Exam::*set)(int)) {
+            if (!lines.next(line)) return true;
+            if (!parseInt(valueOf(line), number)) {
+                std::cerr << "Error: Expected a number: " << line << std::endl;
+                return false;
+            }
+            (exam.*set)(number);
+            return true;
+        };
+        auto readTime = [&](void (Exam::*set)(const std::chrono::system_clock::time_point &)) {
+            if (!lines.next(line)) return true;
+            std::chrono::system_clock::time_point at;
+            if (!parseIsoTimestamp(valueOf(line), at)) {
+                std::cerr << "Error: Failed to parse time: " << valueOf(line) << std::endl;
+                return false;
+            }
+            (exam.*set)(at);
+            return true;
+        };
+
+        if (!readInt(&Exam::setTermNum)) return false;
+        if (lines.next(line)) exam.setTermName(std::string(valueOf(line)));
+        if (lines.next(line)) exam.setCourseNum(std::string(valueOf(line)));
+        if (lines.next(line)) exam.setRmNum(std::string(valueOf(line)));
+        if (!readInt(&Exam::setCapacity) || !readInt(&Exam::setMaxRow) || !readInt(&Exam::setMaxCol) ||
+            !readInt(&Exam::setNumVersions)) {
+            return false;
+        }
+
+        if (lines.next(line)) {
             std::vector<int> versions;
-            while (std::getline(ss, token, ',')) {
-                token.erase(std::remove_if(token.begin(), token.end(), ::isspace), token.end());
-                if (!token.empty()) versions.push_back(std::stoi(token));
+            std::string_view codes = valueOf(line);
+            while (!codes.empty()) {
+                std::size_t comma = codes.find(',');
+                std::string_view token = trimView(codes.substr(0, comma));
+                if (!token.empty()) {
+                    if (!parseInt(token, number)) {
+                        std::cerr << "Error: Expected a version code: " << token << std::endl;
+                        return false;
+                    }
+                    versions.push_back(number);
+                }
+                codes = comma == std::string_view::npos ? std::string_view() : codes.substr(comma + 1);
             }
             exam.setVersionsCode(versions);
         }
 
-        if (std::getline(infile, line)) exam.setStartTime(stringToTimePoint(trim(getValue(line))));
-        if (std::getline(infile, line)) exam.setEndTime(stringToTimePoint(trim(getValue(line))));
+        if (!readTime(&Exam::setStartTime) || !readTime(&Exam::setEndTime)) return false;
+
+        // Room capacity is a good hint for the roster size; reserving up front keeps
+        // the student index from rehashing while rows are added.
+        exam.reserveRoster(static_cast<std::size_t>(std::max(exam.getCapacity(), 0)));
 
         // Expect "Proctor"
-        if (!std::getline(infile, line) || trim(getValue(line)) != "Proctor") {
+        if (!lines.next(line) || valueOf(line) != "Proctor") {
             std::cerr << "Error: Expected 'Proctor' section" << std::endl;
             return false;
         }
 
         // Load Proctors until "Student"
-        while (std::getline(infile, line)) {
-            std::string value = trim(getValue(line));
+        std::array<std::string_view, 5> fields;
+        while (lines.next(line)) {
+            std::string_view value = valueOf(line);
             if (value == "Student") break;
 
-            std::vector<std::string> tokens;
-            std::stringstream ss(value);
-            std::string token;
-            while (std::getline(ss, token, ',')) tokens.push_back(trim(token));
-
-            if (tokens.size() == 5) {
-                Proctor p(std::stoi(tokens[0]), tokens[1], tokens[2], tokens[3], tokens[4]);
-                exam.addProctor(p);
+            if (splitFields(value, fields) == 5 && parseInt(fields[0], number)) {
+                exam.addProctor(Proctor(number, fields[1], fields[2], fields[3], fields[4], exam.getStringPool()));
             } else {
                 std::cerr << "Warning: Skipping malformed proctor line: " << line << std::endl;
             }
         }
 
         // Load Students
-        while (std::getline(infile, line)) {
-            if (line.empty()) continue;
-
-            std::vector<std::string> tokens;
-            std::stringstream ss(trim(line));
-            std::string token;
-            while (std::getline(ss, token, ',')) tokens.push_back(trim(token));
+        int extraMinutes = 0;
+        while (lines.next(line)) {
+            std::string_view row = trimView(line);
+            if (row.empty()) continue;
 
-            if (tokens.size() == 4) {
-                Student s(std::stoi(tokens[0]), tokens[1], tokens[2], tokens[3], false, false);
+            // An optional fifth field grants extra writing time, in minutes
+            std::size_t count = splitFields(row, fields);
+            if ((count == 4 || count == 5) && parseInt(fields[0], number) &&
+                (count == 4 || parseInt(fields[4], extraMinutes))) {
+                Student s(number, fields[1], fields[2], fields[3], exam.getStringPool());
+                if (count == 5) s.setExtraTime(std::chrono::minutes(extraMinutes));
                 exam.addStudent(s);
             } else {
                 std::cerr << "Warning: Skipping malformed student line: " << line << std::endl;
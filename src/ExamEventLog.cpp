@@ -0,0 +1,97 @@
+/**
+ * @file ExamEventLog.cpp
+ * @brief Implementation of the ExamEventLog class.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include "ExamEventLog.h"
+#include <utility>
+
+std::size_t ExamEventLog::append(ExamEvent event, const std::string &message) {
+    std::lock_guard<std::mutex> guard(lock);
+    return appendLocked(event, message);
+}
+
+std::size_t ExamEventLog::appendBatch(const std::vector<ExamEvent> &batch) {
+    std::lock_guard<std::mutex> guard(lock);
+    std::size_t first = events.size();
+    for (const ExamEvent &event : batch) appendLocked(event, std::string());
+    return first;
+}
+
+// Caller holds the lock
+std::size_t ExamEventLog::appendLocked(ExamEvent event, const std::string &message) {
+    if (event.type == ExamEventType::IncidentLogged) {
+        event.arg1 = static_cast<std::int32_t>(messages.size());
+        messages.push_back(message);
+    }
+    events.push_back(event);
+    for (const auto &entry : listeners) {
+        entry.second(event, event.type == ExamEventType::IncidentLogged ? messages.back() : std::string());
+    }
+    return events.size() - 1;
+}
+
+std::size_t ExamEventLog::addListener(Listener listener) {
+    std::lock_guard<std::mutex> guard(lock);
+    listeners.emplace_back(nextListenerID, std::move(listener));
+    return nextListenerID++;
+}
+
+void ExamEventLog::removeListener(std::size_t listenerID) {
+    std::lock_guard<std::mutex> guard(lock);
+    for (auto it = listeners.begin(); it != listeners.end(); ++it) {
+        if (it->first == listenerID) {
+            listeners.erase(it);
+            return;
+        }
+    }
+}
+
+void ExamEventLog::reserve(std::size_t numEvents) {
+    std::lock_guard<std::mutex> guard(lock);
+    events.reserve(numEvents);
+}
+
+void ExamEventLog::clear() {
+    std::lock_guard<std::mutex> guard(lock);
+    events.clear();
+    messages.clear();
+    firstSequence = 0;
+}
+
+void ExamEventLog::setFirstSequence(std::size_t sequence) {
+    std::lock_guard<std::mutex> guard(lock);
+    firstSequence = sequence;
+}
+
+std::size_t ExamEventLog::nextSequence() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return firstSequence + events.size();
+}
+
+std::size_t ExamEventLog::size() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return events.size();
+}
+
+ExamEvent ExamEventLog::at(std::size_t position) const {
+    std::lock_guard<std::mutex> guard(lock);
+    return events.at(position);
+}
+
+std::string ExamEventLog::messageFor(const ExamEvent &event) const {
+    if (event.type != ExamEventType::IncidentLogged) return std::string();
+    std::lock_guard<std::mutex> guard(lock);
+    if (event.arg1 < 0 || static_cast<std::size_t>(event.arg1) >= messages.size()) return std::string();
+    return messages[event.arg1];
+}
+
+std::vector<ExamEvent> ExamEventLog::snapshot(std::size_t from) const {
+    std::lock_guard<std::mutex> guard(lock);
+    if (from >= events.size()) return {};
+    return std::vector<ExamEvent>(events.begin() + from, events.end());
+}
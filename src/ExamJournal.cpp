@@ -0,0 +1,301 @@
+/**
+ * @file ExamJournal.cpp
+ * @brief Implementation of the ExamJournal class.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include "ExamJournal.h"
+#include "Exam.h"
+#include "BinaryIO.h"
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <system_error>
+
+namespace {
+const char MAGIC[8] = {'E', 'X', 'J', 'O', 'U', 'R', 'N', 'L'};
+const std::uint8_t FINISHED_RECORD = 0xFF;     // Payload of the record close(true) writes
+const std::size_t EVENT_PAYLOAD_SIZE = 1 + 8 + 4 * 4 + 4;
+
+std::string encodeHeader(const std::string &examDataPath) {
+    std::string body;
+    putLE<std::uint32_t>(body, ExamJournal::FORMAT_VERSION);
+    putLE<std::uint32_t>(body, static_cast<std::uint32_t>(examDataPath.size()));
+    body += examDataPath;
+
+    std::string header(MAGIC, sizeof(MAGIC));
+    header += body;
+    putLE<std::uint32_t>(header, crc32(body.data(), body.size()));
+    return header;
+}
+
+// Appends the payload of an event record to out
+void appendEvent(std::string &out, const ExamEvent &event, const std::string &message) {
+    putLE<std::uint8_t>(out, static_cast<std::uint8_t>(event.type));
+    putLE<std::int64_t>(out, event.atMicros);
+    putLE<std::int32_t>(out, event.studentID);
+    putLE<std::int32_t>(out, event.arg0);
+    putLE<std::int32_t>(out, event.type == ExamEventType::IncidentLogged ? 0 : event.arg1);
+    putLE<std::int32_t>(out, event.arg2);
+    putLE<std::uint32_t>(out, static_cast<std::uint32_t>(message.size()));
+    out += message;
+}
+
+/**
+ * Walks a journal file. Valid event records are appended to log when it is
+ * not null. Stops at the first record that is cut short or fails its CRC.
+ */
+JournalInfo readJournal(const std::string &path, ExamEventLog *log) {
+    JournalInfo info;
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return info;
+    std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    // Header
+    std::size_t pos = sizeof(MAGIC);
+    if (data.size() < pos + 8 || data.compare(0, sizeof(MAGIC), MAGIC, sizeof(MAGIC)) != 0) return info;
+    std::uint32_t version = getLE<std::uint32_t>(&data[pos]);
+    std::uint32_t pathLen = getLE<std::uint32_t>(&data[pos + 4]);
+    if (version != ExamJournal::FORMAT_VERSION || data.size() < pos + 8 + pathLen + 4) return info;
+    std::uint32_t headerCrc = getLE<std::uint32_t>(&data[pos + 8 + pathLen]);
+    if (crc32(&data[pos], 8 + pathLen) != headerCrc) return info;
+    info.found = true;
+    info.examDataPath = data.substr(pos + 8, pathLen);
+    pos += 8 + pathLen + 4;
+    info.validBytes = pos;
+
+    // Records
+    while (pos < data.size()) {
+        if (data.size() - pos < 8) {
+            info.truncated = true;
+            break;
+        }
+        std::uint32_t length = getLE<std::uint32_t>(&data[pos]);
+        std::uint32_t crc = getLE<std::uint32_t>(&data[pos + 4]);
+        if (data.size() - pos - 8 < length || length == 0 || crc32(&data[pos + 8], length) != crc) {
+            info.truncated = true;
+            break;
+        }
+        const char *payload = &data[pos + 8];
+        pos += 8 + length;
+
+        if (static_cast<std::uint8_t>(payload[0]) == FINISHED_RECORD) {
+            info.finished = true;
+            info.validBytes = pos;
+            continue;
+        }
+        if (length < EVENT_PAYLOAD_SIZE) {
+            info.truncated = true;
+            break;
+        }
+
+        ExamEvent event;
+        event.type = static_cast<ExamEventType>(static_cast<std::uint8_t>(payload[0]));
+        event.atMicros = getLE<std::int64_t>(payload + 1);
+        event.studentID = getLE<std::int32_t>(payload + 9);
+        event.arg0 = getLE<std::int32_t>(payload + 13);
+        event.arg1 = getLE<std::int32_t>(payload + 17);
+        event.arg2 = getLE<std::int32_t>(payload + 21);
+        std::uint32_t messageLen = getLE<std::uint32_t>(payload + 25);
+        if (EVENT_PAYLOAD_SIZE + messageLen != length) {
+            info.truncated = true;
+            break;
+        }
+        if (log) log->append(event, std::string(payload + EVENT_PAYLOAD_SIZE, messageLen));
+
+        info.events++;
+        info.finished = false;   // Events after a finished marker mean the exam was resumed
+        info.validBytes = pos;
+    }
+    return info;
+}
+}
+
+// Constructor
+ExamJournal::ExamJournal(const std::string &path, std::chrono::milliseconds commitInterval, std::size_t commitBytes)
+    : path(path), file(nullptr), commitInterval(commitInterval), commitBytes(commitBytes),
+      appendedCount(0), durableCount(0), syncCount(0), flushRequested(false), stopping(false), failed(false),
+      attachedExam(nullptr), listenerID(0) {}
+
+// Destructor
+ExamJournal::~ExamJournal() {
+    close(false);
+}
+
+bool ExamJournal::open(const std::string &examDataPath, std::uint64_t resumeAt) {
+    close(false);
+
+    if (resumeAt > 0) {
+        // Drop any torn record at the end before appending after it
+        std::error_code ec;
+        std::filesystem::resize_file(path, resumeAt, ec);
+        if (ec) {
+            std::cerr << "Could not resume journal " << path << ": " << ec.message() << std::endl;
+            return false;
+        }
+        file = std::fopen(path.c_str(), "ab");
+    } else {
+        file = std::fopen(path.c_str(), "wb");
+        if (file) {
+            std::string header = encodeHeader(examDataPath);
+            if (std::fwrite(header.data(), 1, header.size(), file) != header.size() ||
+                std::fflush(file) != 0 || !syncFile(file)) {
+                std::fclose(file);
+                file = nullptr;
+            }
+        }
+    }
+
+    if (!file) {
+        std::cerr << "Could not open journal " << path << std::endl;
+        return false;
+    }
+
+    stopping = false;
+    failed = false;
+    pending.reserve(2 * commitBytes);
+    writer = std::thread(&ExamJournal::writerLoop, this);
+    return true;
+}
+
+void ExamJournal::attach(Exam &exam) {
+    detach();
+    attachedExam = &exam;
+    listenerID = exam.getEventLog().addListener([this](const ExamEvent &event, const std::string &message) {
+        record(event, message);
+    });
+}
+
+void ExamJournal::detach() {
+    if (attachedExam) {
+        attachedExam->getEventLog().removeListener(listenerID);
+        attachedExam = nullptr;
+    }
+}
+
+// Framed straight into pending, which keeps its capacity between commits, so
+// recording allocates nothing once the buffers have grown to a commit's worth
+void ExamJournal::record(const ExamEvent &event, const std::string &message) {
+    std::lock_guard<std::mutex> guard(lock);
+    if (!file) return;
+    std::size_t start = pending.size();
+    putLE<std::uint32_t>(pending, static_cast<std::uint32_t>(EVENT_PAYLOAD_SIZE + message.size()));
+    putLE<std::uint32_t>(pending, 0);   // CRC, filled in once the payload is in place
+    appendEvent(pending, event, message);
+    setLE<std::uint32_t>(&pending[start + 4], crc32(&pending[start + 8], pending.size() - start - 8));
+    appendedCount++;
+    if (pending.size() >= commitBytes) wakeWriter.notify_one();
+}
+
+// Frame a payload as [length][CRC-32][payload] and queue it for the writer
+void ExamJournal::appendRecord(const std::string &payload) {
+    std::lock_guard<std::mutex> guard(lock);
+    if (!file) return;
+    putLE<std::uint32_t>(pending, static_cast<std::uint32_t>(payload.size()));
+    putLE<std::uint32_t>(pending, crc32(payload.data(), payload.size()));
+    pending += payload;
+    appendedCount++;
+    if (pending.size() >= commitBytes) wakeWriter.notify_one();
+}
+
+// Group commit: wait for the first record, give others the commit interval to
+// join it, then write the whole batch with a single fsync
+void ExamJournal::writerLoop() {
+    std::string batch;
+    batch.reserve(2 * commitBytes);   // Swapped with pending, so both keep room for a full commit
+    std::unique_lock<std::mutex> guard(lock);
+    for (;;) {
+        wakeWriter.wait(guard, [this] { return stopping || !pending.empty(); });
+        if (pending.empty()) break;
+        wakeWriter.wait_for(guard, commitInterval, [this] {
+            return stopping || flushRequested || pending.size() >= commitBytes;
+        });
+
+        batch.swap(pending);
+        flushRequested = false;
+        std::uint64_t upTo = appendedCount;
+        guard.unlock();
+
+        bool ok = std::fwrite(batch.data(), 1, batch.size(), file) == batch.size() &&
+                  std::fflush(file) == 0 && syncFile(file);
+        batch.clear();
+
+        guard.lock();
+        if (ok) {
+            syncCount++;
+        } else if (!failed) {
+            failed = true;
+            std::cerr << "Journal write failed: " << path << std::endl;
+        }
+        durableCount = upTo;
+        committed.notify_all();
+    }
+}
+
+bool ExamJournal::flush() {
+    std::unique_lock<std::mutex> guard(lock);
+    if (!file) return !failed;
+    std::uint64_t target = appendedCount;
+    flushRequested = true;
+    wakeWriter.notify_one();
+    committed.wait(guard, [&] { return durableCount >= target; });
+    return !failed;
+}
+
+void ExamJournal::stopWriter() {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    wakeWriter.notify_one();
+    if (writer.joinable()) writer.join();
+}
+
+void ExamJournal::close(bool finished) {
+    detach();
+    if (!file) return;
+    if (finished) {
+        std::string marker;
+        putLE<std::uint8_t>(marker, FINISHED_RECORD);
+        appendRecord(marker);
+    }
+    flush();
+    stopWriter();
+
+    std::lock_guard<std::mutex> guard(lock);
+    std::fclose(file);
+    file = nullptr;
+}
+
+bool ExamJournal::isOpen() {
+    std::lock_guard<std::mutex> guard(lock);
+    return file != nullptr;
+}
+
+std::uint64_t ExamJournal::getSyncCount() {
+    std::lock_guard<std::mutex> guard(lock);
+    return syncCount;
+}
+
+std::uint64_t ExamJournal::getRecordCount() {
+    std::lock_guard<std::mutex> guard(lock);
+    return appendedCount;
+}
+
+JournalInfo ExamJournal::inspect(const std::string &path) {
+    return readJournal(path, nullptr);
+}
+
+JournalInfo ExamJournal::recover(const std::string &path, Exam &exam) {
+    ExamEventLog log;
+    JournalInfo info = readJournal(path, &log);
+    // An exam restored from a snapshot already holds the first events; replay only the tail
+    if (info.found && !exam.replay(log, exam.getEventLog().nextSequence())) {
+        std::cerr << "Some journal events did not match the loaded exam and were skipped." << std::endl;
+    }
+    return info;
+}
@@ -0,0 +1,447 @@
+/**
+ * @file ExamSnapshot.cpp
+ * @brief Implementation of the ExamSnapshot class.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include "ExamSnapshot.h"
+#include "Exam.h"
+#include "BinaryIO.h"
+#include "MappedFile.h"
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <limits>
+#include <system_error>
+#include <vector>
+
+namespace {
+const char MAGIC[8] = {'E', 'X', 'S', 'N', 'A', 'P', 'S', 'H'};
+const std::size_t HEADER_SIZE = 64;
+const std::size_t HEADER_CRC_OFFSET = 60;                  // Header CRC covers every byte before it
+const std::size_t STUDENT_RECORD_SIZE = 4 * 7 + 8 + 8 * 3;  // Fixed fields, submission time, three strings
+const std::size_t BREAK_RECORD_SIZE = 4 + 8 + 8;     // Student ID, start, end
+const std::int64_t NO_END = std::numeric_limits<std::int64_t>::min();   // Break still in progress
+
+// Student flags
+const std::uint32_t ATTENDED = 1;
+const std::uint32_t SUBMITTED = 2;
+const std::uint32_t ON_BREAK = 4;
+
+std::int64_t toMicros(std::chrono::system_clock::time_point at) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(at.time_since_epoch()).count();
+}
+
+std::chrono::system_clock::time_point fromMicros(std::int64_t micros) {
+    return std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::microseconds(micros)));
+}
+
+// Builds the body; strings go to a shared table and the body keeps [offset][length]
+struct Encoder {
+    std::string body;
+    std::string strings;
+
+    template <typename T>
+    void put(T value) { putLE<T>(body, value); }
+
+    void str(std::string_view s) {
+        put<std::uint32_t>(static_cast<std::uint32_t>(strings.size()));
+        put<std::uint32_t>(static_cast<std::uint32_t>(s.size()));
+        strings += s;
+    }
+
+    // A pooled path is written whole, the same as str() would write it
+    void path(const PooledPath &p) {
+        put<std::uint32_t>(static_cast<std::uint32_t>(strings.size()));
+        put<std::uint32_t>(static_cast<std::uint32_t>(p.size()));
+        strings.append(p.directory).append(p.file);
+    }
+};
+
+// Reads fields in order from a mapped body; any read past the end clears ok
+struct Decoder {
+    const char *pos;
+    const char *end;
+    const char *strings;
+    std::size_t stringsSize;
+    bool ok;
+
+    template <typename T>
+    T get() {
+        if (static_cast<std::size_t>(end - pos) < sizeof(T)) {
+            ok = false;
+            return T();
+        }
+        T value = getLE<T>(pos);
+        pos += sizeof(T);
+        return value;
+    }
+
+    std::string str() {
+        std::uint32_t offset = get<std::uint32_t>();
+        std::uint32_t length = get<std::uint32_t>();
+        if (offset > stringsSize || length > stringsSize - offset) {
+            ok = false;
+            return std::string();
+        }
+        return std::string(strings + offset, length);
+    }
+
+    // Like str(), but viewing the mapped file; valid until it is unmapped
+    std::string_view view() {
+        std::uint32_t offset = get<std::uint32_t>();
+        std::uint32_t length = get<std::uint32_t>();
+        if (offset > stringsSize || length > stringsSize - offset) {
+            ok = false;
+            return std::string_view();
+        }
+        return std::string_view(strings + offset, length);
+    }
+
+    void skip(std::size_t bytes) {
+        if (static_cast<std::size_t>(end - pos) < bytes) {
+            ok = false;
+            pos = end;
+        } else {
+            pos += bytes;
+        }
+    }
+};
+
+struct Header {
+    std::uint64_t eventSequence;
+    std::int64_t takenAtMicros;
+    std::uint32_t students;
+    std::uint32_t proctors;
+    std::uint32_t breaks;
+    std::uint32_t incidents;
+    std::uint32_t reservedSeats;
+    std::uint32_t stringsOffset;
+    std::uint32_t bodyCrc;
+};
+
+/**
+ * Checks the magic, version and header CRC of a mapped snapshot and decodes
+ * the header. When checkBody is set the body CRC is verified too.
+ */
+bool readHeader(const MappedFile &map, Header &header, bool checkBody) {
+    const char *data = map.data();
+    if (map.size() < HEADER_SIZE || std::string(data, sizeof(MAGIC)) != std::string(MAGIC, sizeof(MAGIC))) {
+        return false;
+    }
+    if (getLE<std::uint32_t>(data + 8) != ExamSnapshot::FORMAT_VERSION ||
+        getLE<std::uint32_t>(data + 12) != HEADER_SIZE ||
+        crc32(data, HEADER_CRC_OFFSET) != getLE<std::uint32_t>(data + HEADER_CRC_OFFSET)) {
+        return false;
+    }
+    header.eventSequence = getLE<std::uint64_t>(data + 16);
+    header.takenAtMicros = getLE<std::int64_t>(data + 24);
+    header.students = getLE<std::uint32_t>(data + 32);
+    header.proctors = getLE<std::uint32_t>(data + 36);
+    header.breaks = getLE<std::uint32_t>(data + 40);
+    header.incidents = getLE<std::uint32_t>(data + 44);
+    header.reservedSeats = getLE<std::uint32_t>(data + 48);
+    header.stringsOffset = getLE<std::uint32_t>(data + 52);
+    header.bodyCrc = getLE<std::uint32_t>(data + 56);
+    if (header.stringsOffset < HEADER_SIZE || header.stringsOffset > map.size()) return false;
+    return !checkBody || crc32(data + HEADER_SIZE, map.size() - HEADER_SIZE) == header.bodyCrc;
+}
+
+Decoder bodyDecoder(const MappedFile &map, const Header &header) {
+    return Decoder{map.data() + HEADER_SIZE, map.data() + header.stringsOffset,
+                   map.data() + header.stringsOffset, map.size() - header.stringsOffset, true};
+}
+}
+
+std::string ExamSnapshot::capture(Exam &exam, const std::string &examDataPath) {
+    std::vector<std::unique_lock<std::mutex>> held = exam.lockAll();
+
+    Encoder out;
+    out.body.reserve(256 + exam.students.size() * STUDENT_RECORD_SIZE);
+
+    // Exam configuration
+    out.put<std::int32_t>(exam.termNum);
+    out.put<std::int32_t>(exam.capacity);
+    out.put<std::int32_t>(exam.maxRow);
+    out.put<std::int32_t>(exam.maxCol);
+    out.put<std::int32_t>(exam.numVersions);
+    out.put<std::int64_t>(toMicros(exam.startTime));
+    out.put<std::int64_t>(toMicros(exam.endTime));
+    out.str(exam.termName);
+    out.str(exam.courseNum);
+    out.str(exam.rmNum);
+    out.str(examDataPath);
+    out.str(exam.examReport_URL);
+    out.put<std::uint32_t>(static_cast<std::uint32_t>(exam.versionsCode.size()));
+    for (int code : exam.versionsCode) out.put<std::int32_t>(code);
+
+    // Live counters
+    ExamStats stats = exam.stats.snapshot();
+    out.put<std::int32_t>(stats.checkedIn);
+    out.put<std::int32_t>(stats.submitted);
+    out.put<std::int32_t>(stats.earlySubmitted);
+    out.put<std::int32_t>(stats.onBreak);
+    out.put<std::int32_t>(stats.totalBreaks);
+    out.put<std::int32_t>(stats.incidents);
+    out.put<std::uint32_t>(static_cast<std::uint32_t>(stats.breaksPerVersion.size()));
+    for (int count : stats.breaksPerVersion) out.put<std::int32_t>(count);
+
+    // Students, then every break in the order the breaks started
+    for (std::size_t i = 0; i < exam.students.size(); ++i) {
+        Student &s = exam.students[i];
+        std::uint32_t flags = (s.getAttendance() ? ATTENDED : 0) | (s.getSubmissionStatus() ? SUBMITTED : 0) |
+                              (exam.breakSlot[i] >= 0 ? ON_BREAK : 0);
+        out.put<std::int32_t>(s.getID());
+        out.put<std::int32_t>(s.getSeatRow());
+        out.put<std::int32_t>(s.getSeatCol());
+        out.put<std::int32_t>(s.getExamVersion());
+        out.put<std::uint32_t>(flags);
+        out.put<std::uint32_t>(static_cast<std::uint32_t>(s.getBreakCount()));
+        out.put<std::int32_t>(static_cast<std::int32_t>(s.getExtraTime().count()));
+        out.put<std::int64_t>(s.getSubmissionStatus() ? toMicros(s.getSubmissionTimePoint()) : 0);
+        out.str(s.getName());
+        out.str(s.getDOB());
+        out.path(s.getPicPath());
+    }
+    std::size_t breakCount = exam.breakLog->size();
+    out.body.reserve(out.body.size() + breakCount * BREAK_RECORD_SIZE);
+    exam.breakLog->forEach([&out](const BreakRecord &r) {
+        out.put<std::int32_t>(r.studentID);
+        out.put<std::int64_t>(toMicros(r.span.getStartTimePoint()));
+        out.put<std::int64_t>(r.span.hasEnded() ? toMicros(r.span.getEndTimePoint()) : NO_END);
+    });
+
+    for (const Proctor &p : exam.proctors) {
+        out.put<std::int32_t>(p.getID());
+        out.str(p.getName());
+        out.str(p.getDOB());
+        out.path(p.getPicPath());
+        out.str(p.getRole());
+    }
+
+    for (const Incident &incident : exam.incidents.all()) {
+        out.put<std::int32_t>(incident.studentID);
+        out.put<std::int32_t>(incident.proctorID);
+        out.put<std::int64_t>(toMicros(incident.at));
+        out.put<std::uint8_t>(static_cast<std::uint8_t>(incident.category));
+        out.str(incident.message);
+    }
+
+    // Seats reserved as blocks: taken in the seat map but held by no student
+    std::uint32_t reservedSeats = 0;
+    for (int row = 0; row < exam.seatMap.getRows(); ++row) {
+        for (int col = 0; col < exam.seatMap.getCols(); ++col) {
+            if (exam.seatMap.isTaken(row, col) && exam.seatOccupant[exam.seatSlot(row, col)] < 0) {
+                out.put<std::int32_t>(row);
+                out.put<std::int32_t>(col);
+                reservedSeats++;
+            }
+        }
+    }
+
+    std::uint64_t sequence = exam.eventLog.nextSequence();
+    std::size_t numStudents = exam.students.size();
+    std::size_t numProctors = exam.proctors.size();
+    std::size_t numIncidents = exam.incidents.size();
+    held.clear();   // The rest only touches the copy
+
+    std::string image;
+    image.reserve(HEADER_SIZE + out.body.size() + out.strings.size());
+    image.append(MAGIC, sizeof(MAGIC));
+    putLE<std::uint32_t>(image, FORMAT_VERSION);
+    putLE<std::uint32_t>(image, static_cast<std::uint32_t>(HEADER_SIZE));
+    putLE<std::uint64_t>(image, sequence);
+    putLE<std::int64_t>(image, toMicros(std::chrono::system_clock::now()));
+    putLE<std::uint32_t>(image, static_cast<std::uint32_t>(numStudents));
+    putLE<std::uint32_t>(image, static_cast<std::uint32_t>(numProctors));
+    putLE<std::uint32_t>(image, static_cast<std::uint32_t>(breakCount));
+    putLE<std::uint32_t>(image, static_cast<std::uint32_t>(numIncidents));
+    putLE<std::uint32_t>(image, reservedSeats);
+    putLE<std::uint32_t>(image, static_cast<std::uint32_t>(HEADER_SIZE + out.body.size()));
+    std::uint32_t bodyCrc = crc32(out.body.data(), out.body.size());
+    putLE<std::uint32_t>(image, crc32(out.strings.data(), out.strings.size(), bodyCrc));
+    putLE<std::uint32_t>(image, crc32(image.data(), HEADER_CRC_OFFSET));
+    image += out.body;
+    image += out.strings;
+    return image;
+}
+
+bool ExamSnapshot::write(const std::string &path, const std::string &image) {
+    std::string tempPath = path + ".tmp";
+    std::FILE *file = std::fopen(tempPath.c_str(), "wb");
+    if (!file) {
+        std::cerr << "Could not write snapshot " << tempPath << std::endl;
+        return false;
+    }
+    bool ok = std::fwrite(image.data(), 1, image.size(), file) == image.size() &&
+              std::fflush(file) == 0 && syncFile(file);
+    ok = std::fclose(file) == 0 && ok;
+
+    std::error_code ec;
+    if (ok) std::filesystem::rename(tempPath, path, ec);
+    if (!ok || ec) {
+        std::cerr << "Could not write snapshot " << path << std::endl;
+        std::filesystem::remove(tempPath, ec);
+        return false;
+    }
+    return true;
+}
+
+SnapshotInfo ExamSnapshot::inspect(const std::string &path) {
+    SnapshotInfo info;
+    MappedFile map;
+    Header header;
+    if (!map.open(path) || !readHeader(map, header, false)) return info;
+
+    // The data path is the fourth string of the configuration, after seven fixed fields
+    Decoder in = bodyDecoder(map, header);
+    in.skip(4 * 5 + 8 * 2 + 8 * 3);
+    std::string examDataPath = in.str();
+    if (!in.ok) return info;
+
+    info.found = true;
+    info.examDataPath = examDataPath;
+    info.eventSequence = header.eventSequence;
+    info.takenAt = fromMicros(header.takenAtMicros);
+    info.students = header.students;
+    return info;
+}
+
+SnapshotInfo ExamSnapshot::load(const std::string &path, Exam &exam) {
+    SnapshotInfo info;
+    MappedFile map;
+    Header header;
+    if (!map.open(path) || !readHeader(map, header, true)) return info;
+    if (!exam.students.empty()) {
+        std::cerr << "A snapshot can only be loaded into an empty exam." << std::endl;
+        return info;
+    }
+
+    Decoder in = bodyDecoder(map, header);
+
+    // Exam configuration
+    exam.setTermNum(in.get<std::int32_t>());
+    exam.setCapacity(in.get<std::int32_t>());
+    exam.setMaxRow(in.get<std::int32_t>());
+    exam.setMaxCol(in.get<std::int32_t>());
+    exam.setNumVersions(in.get<std::int32_t>());
+    exam.setStartTime(fromMicros(in.get<std::int64_t>()));
+    exam.setEndTime(fromMicros(in.get<std::int64_t>()));
+    exam.setTermName(in.str());
+    exam.setCourseNum(in.str());
+    exam.setRmNum(in.str());
+    info.examDataPath = in.str();
+    exam.setExamDataURL(info.examDataPath);
+    exam.examReport_URL = in.str();
+    std::vector<int> codes(in.get<std::uint32_t>());
+    if (!in.ok || codes.size() > map.size()) return info;
+    for (int &code : codes) code = in.get<std::int32_t>();
+    exam.setVersionsCode(codes);
+    exam.initializeSeatMap();
+
+    // Live counters
+    exam.stats.checkedIn = in.get<std::int32_t>();
+    exam.stats.submitted = in.get<std::int32_t>();
+    exam.stats.earlySubmitted = in.get<std::int32_t>();
+    exam.stats.onBreak = in.get<std::int32_t>();
+    exam.stats.totalBreaks = in.get<std::int32_t>();
+    exam.stats.incidents = in.get<std::int32_t>();
+    std::uint32_t versionCounters = in.get<std::uint32_t>();
+    if (!in.ok || versionCounters != exam.stats.breaksPerVersion.size()) return info;
+    for (auto &count : exam.stats.breaksPerVersion) count = in.get<std::int32_t>();
+
+    // Students
+    exam.reserveRoster(header.students, header.proctors);
+    std::vector<std::uint32_t> breakCounts;
+    breakCounts.reserve(header.students);
+    for (std::uint32_t i = 0; i < header.students && in.ok; ++i) {
+        int id = in.get<std::int32_t>();
+        int row = in.get<std::int32_t>();
+        int col = in.get<std::int32_t>();
+        int version = in.get<std::int32_t>();
+        std::uint32_t flags = in.get<std::uint32_t>();
+        std::uint32_t numBreaks = in.get<std::uint32_t>();
+        int extraMinutes = in.get<std::int32_t>();
+        std::int64_t submittedAt = in.get<std::int64_t>();
+        std::string_view name = in.view();
+        std::string_view dob = in.view();
+        std::string_view pic = in.view();
+
+        std::size_t index = exam.students.size();
+        exam.addStudent(Student(id, name, dob, pic, exam.getStringPool()));
+        if (exam.students.size() != index + 1) return info;   // Duplicate ID
+        Student &s = exam.students[index];
+
+        if (row >= 0) {
+            if (!exam.seatMap.reserve(row, col)) return info;
+            exam.seatOccupant[exam.seatSlot(row, col)] = static_cast<int>(index);
+            s.setSeat(row, col);
+        }
+        s.setExamVersion(version);
+        s.setExtraTime(std::chrono::minutes(extraMinutes));
+        s.setAttendance(flags & ATTENDED);
+        breakCounts.push_back(numBreaks);
+        if (flags & ON_BREAK) {
+            exam.breakSlot[index] = static_cast<int>(exam.studentsInBreak.size());
+            exam.studentsInBreak.push_back(index);
+        }
+        if (flags & SUBMITTED) s.submitExam(fromMicros(submittedAt));
+    }
+    if (!in.ok) return info;
+
+    // Breaks, replayed in the order they started so the exam's break log keeps that order
+    for (std::uint32_t i = 0; i < header.breaks && in.ok; ++i) {
+        int id = in.get<std::int32_t>();
+        std::int64_t startedAt = in.get<std::int64_t>();
+        std::int64_t endedAt = in.get<std::int64_t>();
+        auto it = exam.studentIndex.find(id);
+        if (!in.ok || it == exam.studentIndex.end()) return info;
+        Student &s = exam.students[it->second];
+        s.leaveForBreak(fromMicros(startedAt));
+        if (endedAt != NO_END) s.returnFromBreak(fromMicros(endedAt));
+    }
+    if (!in.ok) return info;
+    for (std::size_t i = 0; i < exam.students.size(); ++i) {
+        if (exam.students[i].getBreakCount() != breakCounts[i]) return info;
+        exam.syncColumns(&exam.students[i]);
+    }
+
+    for (std::uint32_t i = 0; i < header.proctors && in.ok; ++i) {
+        int id = in.get<std::int32_t>();
+        std::string_view name = in.view();
+        std::string_view dob = in.view();
+        std::string_view pic = in.view();
+        std::string_view role = in.view();
+        exam.addProctor(Proctor(id, name, dob, pic, role, exam.getStringPool()));
+    }
+
+    for (std::uint32_t i = 0; i < header.incidents && in.ok; ++i) {
+        Incident incident;
+        incident.studentID = in.get<std::int32_t>();
+        incident.proctorID = in.get<std::int32_t>();
+        incident.at = fromMicros(in.get<std::int64_t>());
+        incident.category = incidentCategoryFromCode(in.get<std::uint8_t>());
+        incident.message = in.str();
+        exam.incidents.add(std::move(incident));
+    }
+
+    for (std::uint32_t i = 0; i < header.reservedSeats && in.ok; ++i) {
+        int row = in.get<std::int32_t>();
+        int col = in.get<std::int32_t>();
+        if (!exam.seatMap.reserve(row, col)) return info;   // Already held by a student
+    }
+    if (!in.ok) return info;
+
+    exam.eventLog.clear();
+    exam.eventLog.setFirstSequence(header.eventSequence);
+
+    info.found = true;
+    info.eventSequence = header.eventSequence;
+    info.takenAt = fromMicros(header.takenAtMicros);
+    info.students = header.students;
+    return info;
+}
@@ -0,0 +1,85 @@
+/**
+ * @file IncidentStore.cpp
+ * @brief Implementation of the Incident structure and the IncidentStore class.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include "IncidentStore.h"
+
+namespace {
+const std::vector<std::uint32_t> NO_POSITIONS;
+
+const char *const CATEGORY_NAMES[INCIDENT_CATEGORY_COUNT] = {
+    "General", "Academic misconduct", "Unauthorized material", "Disruption", "Medical"};
+}
+
+const char *incidentCategoryName(IncidentCategory category) {
+    return CATEGORY_NAMES[static_cast<int>(incidentCategoryFromCode(static_cast<int>(category)))];
+}
+
+IncidentCategory incidentCategoryFromCode(int code) {
+    if (code < 0 || code >= INCIDENT_CATEGORY_COUNT) return IncidentCategory::General;
+    return static_cast<IncidentCategory>(code);
+}
+
+std::string Incident::describe() const {
+    return "Student: " + std::to_string(studentID) + "; Proctor: " + std::to_string(proctorID) +
+           "; Category: " + incidentCategoryName(category) + "; Message: " + message;
+}
+
+bool operator==(const Incident &a, const Incident &b) {
+    return a.studentID == b.studentID && a.proctorID == b.proctorID && a.at == b.at && a.category == b.category &&
+           a.message == b.message;
+}
+
+bool operator!=(const Incident &a, const Incident &b) {
+    return !(a == b);
+}
+
+void IncidentStore::add(Incident incident) {
+    auto position = static_cast<std::uint32_t>(records.size());
+    byStudent[incident.studentID].push_back(position);
+    byProctor[incident.proctorID].push_back(position);
+    categoryCounts[static_cast<int>(incidentCategoryFromCode(static_cast<int>(incident.category)))]++;
+    records.push_back(std::move(incident));
+}
+
+void IncidentStore::clear() {
+    records.clear();
+    byStudent.clear();
+    byProctor.clear();
+    categoryCounts.fill(0);
+}
+
+std::size_t IncidentStore::size() const {
+    return records.size();
+}
+
+bool IncidentStore::empty() const {
+    return records.empty();
+}
+
+const std::vector<Incident> &IncidentStore::all() const {
+    return records;
+}
+
+IncidentView IncidentStore::find(const std::vector<Incident> &records,
+                                 const std::unordered_map<int, std::vector<std::uint32_t>> &index, int id) {
+    auto it = index.find(id);
+    return IncidentView(&records, it == index.end() ? &NO_POSITIONS : &it->second);
+}
+
+IncidentView IncidentStore::forStudent(int studentID) const {
+    return find(records, byStudent, studentID);
+}
+
+IncidentView IncidentStore::forProctor(int proctorID) const {
+    return find(records, byProctor, proctorID);
+}
+
+std::size_t IncidentStore::countOf(IncidentCategory category) const {
+    return categoryCounts[static_cast<int>(incidentCategoryFromCode(static_cast<int>(category)))];
+}
@@ -0,0 +1,79 @@
+/**
+ * @file MappedFile.cpp
+ * @brief Implementation of the MappedFile class.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include "MappedFile.h"
+#ifdef _WIN32
+#include <fstream>
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// Constructor
+MappedFile::MappedFile() : bytes(nullptr), length(0) {}
+
+// Destructor
+MappedFile::~MappedFile() {
+    close();
+}
+
+bool MappedFile::open(const std::string &path) {
+    close();
+#ifdef _WIN32
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    buffer.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    bytes = buffer.empty() ? nullptr : buffer.data();
+    length = buffer.size();
+    return true;
+#else
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        ::close(fd);
+        return false;
+    }
+    length = static_cast<std::size_t>(info.st_size);
+    if (length > 0) {
+        void *mapped = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped == MAP_FAILED) {
+            ::close(fd);
+            length = 0;
+            return false;
+        }
+        bytes = static_cast<const char *>(mapped);
+    }
+    // The mapping stays valid after the descriptor is closed
+    ::close(fd);
+    return true;
+#endif
+}
+
+void MappedFile::close() {
+#ifdef _WIN32
+    buffer.clear();
+    buffer.shrink_to_fit();
+#else
+    if (bytes) munmap(const_cast<char *>(bytes), length);
+#endif
+    bytes = nullptr;
+    length = 0;
+}
+
+const char *MappedFile::data() const {
+    return bytes;
+}
+
+std::size_t MappedFile::size() const {
+    return length;
+}
@@ -14,6 +14,7 @@
 #include <iostream>
 #include <iomanip>
 #include <sstream>
+#include <unordered_map>
 
 void PDFReportGenerator::generate(const std::string &fileName,
                                   const std::string &courseNum,
@@ -24,8 +25,10 @@ void PDFReportGenerator::generate(const std::string &fileName,
                                   const std::string &startTimeStr,
                                   const std::string &endTimeStr,
                                   const std::vector<Student> &students,
+                                  const BreakLog &breaks,
                                   const std::vector<Proctor> &proctors,
-                                  const std::vector<std::string> &incidentReport) {
+                                  const std::vector<Incident> &incidents,
+                                  const ExamStats &stats) {
     HPDF_Doc pdf = HPDF_New(NULL, NULL);
     if (!pdf) {
         std::cerr << "Failed to create PDF object\n";
@@ -71,7 +74,7 @@ void PDFReportGenerator::generate(const std::string &fileName,
     // Proctor info
     printLine("Proctors:");
     for (const Proctor &p : proctors) {
-        printLine("- " + p.getName() + " (" + p.getRole() + ")");
+        printLine("- " + std::string(p.getName()) + " (" + std::string(p.getRole()) + ")");
     }
     printLine("");
 
@@ -80,46 +83,26 @@ void PDFReportGenerator::generate(const std::string &fileName,
     printLine(formatField("ID", 11) + formatField("Name", 30) + formatField("Attend", 10) +
               formatField("Seat", 15) + formatField("Version", 10) + formatField("Submission", 18) + "Breaks");
 
-    int totalPresent = 0;
-    int totalSubmitted = 0;
-    int totalBreaks = 0;
+    // One pass over the break log collects every student's breaks
+    std::unordered_map<int, std::string> breakText;
+    breakText.reserve(students.size());
+    breaks.forEach([&](const BreakRecord &record) {
+        breakText[record.studentID] += "[" + record.span.getStartTime() + "-" + record.span.getEndTime() + "] ";
+    });
 
-    for (Student &s : const_cast<std::vector<Student>&>(students)) {
+    for (const Student &s : students) {
 
         std::string id = std::to_string(s.getID());
-        std::string name = s.getName();
+        std::string name(s.getName());
         std::string attendance = s.getAttendance() ? "Present" : "Absent";
-        if (s.getAttendance()) totalPresent++;
-
-        std::string seat = s.getSeatNum();
-        if (seat.empty()) {
-            seat = "--";
-        } else {
-            size_t rowPos = seat.find("Row: ");
-            if (rowPos != std::string::npos) {
-                seat.replace(rowPos, 4, "R");
-            }
-            size_t colPos = seat.find("Colum: ");
-            if (colPos != std::string::npos) {
-                seat.replace(colPos, 7, "C");
-            }
-        }
 
+        std::string seat = s.hasSeat() ? s.getSeatCode() : "--";
 
         std::string version = (s.getExamVersion() == 0) ? "N/A" : std::to_string(s.getExamVersion());
         std::string submission = s.getSubmissionStatus() ? "Submitted" : "Not Submitted";
-        if (s.getSubmissionStatus()) totalSubmitted++;
-
-        std::string breaksStr;
-        std::vector<Break> *breaks = s.getBreaksList();
-        if (breaks->empty()) {
-            breaksStr = "---";
-        } else {
-            for (const Break &br : *breaks) {
-                breaksStr += "[" + br.getStartTime() + "-" + br.getEndTime() + "] ";
-                totalBreaks++;
-            }
-        }
+
+        auto found = breakText.find(s.getID());
+        std::string breaksStr = found == breakText.end() ? "---" : found->second;
 
         printLine(formatField(id, 11) + formatField(name, 30) + formatField(attendance, 10) +
                   formatField(seat, 15) + formatField(version, 10) + formatField(submission, 18) + breaksStr);
@@ -128,18 +111,19 @@ void PDFReportGenerator::generate(const std::string &fileName,
     // Summary
     printLine("");
     printLine("Summary:");
-    printLine("- Total Present: " + std::to_string(totalPresent));
-    printLine("- Total Submitted: " + std::to_string(totalSubmitted));
-    printLine("- Total Breaks Taken: " + std::to_string(totalBreaks));
+    printLine("- Total Present: " + std::to_string(stats.checkedIn));
+    printLine("- Total Submitted: " + std::to_string(stats.submitted));
+    printLine("- Early Submissions: " + std::to_string(stats.earlySubmitted));
+    printLine("- Total Breaks Taken: " + std::to_string(stats.totalBreaks));
 
     // Incidents
     printLine("");
     printLine("Incident Report:");
-    if (incidentReport.empty()) {
+    if (incidents.empty()) {
         printLine("None");
     } else {
-        for (const std::string &r : incidentReport) {
-            printLine("- " + r);
+        for (const Incident &incident : incidents) {
+            printLine("- " + incident.describe());
         }
     }
 
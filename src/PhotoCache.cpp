@@ -0,0 +1,92 @@
+/**
+ * @file PhotoCache.cpp
+ * @brief Implementation of the PhotoCache class.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include "PhotoCache.h"
+#include "ThreadPool.h"
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+
+namespace {
+const std::size_t PREFETCH_CHUNK = 64;   // Photos read per pool task
+}
+
+// Constructor
+PhotoCache::PhotoCache(std::size_t maxBytes) : maxBytes(maxBytes), usedBytes(0), hits(0), misses(0) {}
+
+std::shared_ptr<const std::string> PhotoCache::get(const std::string &path) {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        auto it = entries.find(path);
+        if (it != entries.end()) {
+            recentOrder.splice(recentOrder.begin(), recentOrder, it->second.recent);
+            hits++;
+            return it->second.bytes;
+        }
+        misses++;
+    }
+
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return nullptr;
+    auto bytes = std::make_shared<const std::string>(std::istreambuf_iterator<char>(in),
+                                                     std::istreambuf_iterator<char>());
+
+    std::lock_guard<std::mutex> guard(lock);
+    auto it = entries.find(path);
+    if (it != entries.end()) return it->second.bytes;   // Another thread read it meanwhile
+    if (bytes->size() > maxBytes) return bytes;          // Too large to keep
+
+    evictTo(maxBytes - bytes->size());
+    recentOrder.push_front(path);
+    entries.emplace(path, Entry{bytes, recentOrder.begin()});
+    usedBytes += bytes->size();
+    return bytes;
+}
+
+void PhotoCache::prefetch(const std::vector<std::string> &paths, ThreadPool &pool) {
+    for (std::size_t begin = 0; begin < paths.size(); begin += PREFETCH_CHUNK) {
+        std::size_t end = std::min(paths.size(), begin + PREFETCH_CHUNK);
+        std::vector<std::string> chunk(paths.begin() + begin, paths.begin() + end);
+        pool.submit([this, chunk] {
+            for (const std::string &path : chunk) get(path);
+        });
+    }
+}
+
+// Drop least recently used photos until at most limit bytes are cached
+void PhotoCache::evictTo(std::size_t limit) {
+    while (usedBytes > limit && !recentOrder.empty()) {
+        auto it = entries.find(recentOrder.back());
+        usedBytes -= it->second.bytes->size();
+        entries.erase(it);
+        recentOrder.pop_back();
+    }
+}
+
+void PhotoCache::clear() {
+    std::lock_guard<std::mutex> guard(lock);
+    entries.clear();
+    recentOrder.clear();
+    usedBytes = 0;
+}
+
+std::size_t PhotoCache::getBytesUsed() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return usedBytes;
+}
+
+std::uint64_t PhotoCache::getHitCount() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return hits;
+}
+
+std::uint64_t PhotoCache::getMissCount() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return misses;
+}
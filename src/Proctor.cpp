@@ -13,15 +13,16 @@
 #include "Proctor.h"
 
 // Constructor
-Proctor::Proctor(int ID, const std::string &name, const std::string &DOB, const std::string &pic_URL, const std::string &role)
-    : User(ID, name, DOB, pic_URL), role(role) {}
+Proctor::Proctor(int ID, std::string_view name, std::string_view DOB, std::string_view pic_URL, std::string_view role,
+                 std::shared_ptr<StringPool> pool)
+    : User(ID, name, DOB, pic_URL, std::move(pool)), role(getStringPool()->intern(role)) {}
 
 // Getter for Role
-std::string Proctor::getRole() const {
+std::string_view Proctor::getRole() const {
     return role;
 }
 
 // Setter for Role
-void Proctor::setRole(const std::string &role) {
-    this->role = role;
+void Proctor::setRole(std::string_view role) {
+    this->role = getStringPool()->intern(role);
 }
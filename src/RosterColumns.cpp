@@ -0,0 +1,124 @@
+/**
+ * @file RosterColumns.cpp
+ * @brief Implementation of the RosterColumns class.
+ *
+ * This file implements the RosterColumns class, which mirrors the per-student
+ * exam state in parallel arrays and answers aggregate questions with tight
+ * loops over a single column.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-16
+ */
+
+#include "RosterColumns.h"
+
+namespace {
+    int32_t packSeat(const Student &s) {
+        return s.hasSeat() ? (s.getSeatRow() << 16) | s.getSeatCol() : -1;
+    }
+
+    // Microseconds, the resolution the event log stamps submissions with
+    int64_t submissionMicros(const Student &s) {
+        if (!s.getSubmissionStatus()) return 0;
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+                s.getSubmissionTimePoint().time_since_epoch()).count();
+    }
+}
+
+void RosterColumns::assign(const std::vector<Student> &students) {
+    clear();
+    reserve(students.size());
+    for (const Student &s : students) {
+        append(s);
+    }
+}
+
+void RosterColumns::append(const Student &s) {
+    ids.push_back(s.getID());
+    attended.push_back(s.getAttendance() ? 1 : 0);
+    submittedAt.push_back(submissionMicros(s));
+    versions.push_back(s.getExamVersion());
+    seats.push_back(packSeat(s));
+    breakCounts.push_back(static_cast<uint16_t>(s.getBreakCount()));
+}
+
+void RosterColumns::update(std::size_t index, const Student &s) {
+    ids[index] = s.getID();
+    attended[index] = s.getAttendance() ? 1 : 0;
+    submittedAt[index] = submissionMicros(s);
+    versions[index] = s.getExamVersion();
+    seats[index] = packSeat(s);
+    breakCounts[index] = static_cast<uint16_t>(s.getBreakCount());
+}
+
+void RosterColumns::reserve(std::size_t count) {
+    ids.reserve(count);
+    attended.reserve(count);
+    submittedAt.reserve(count);
+    versions.reserve(count);
+    seats.reserve(count);
+    breakCounts.reserve(count);
+}
+
+void RosterColumns::clear() {
+    ids.clear();
+    attended.clear();
+    submittedAt.clear();
+    versions.clear();
+    seats.clear();
+    breakCounts.clear();
+}
+
+std::size_t RosterColumns::size() const {
+    return ids.size();
+}
+
+int RosterColumns::countAttended() const {
+    int total = 0;
+    for (uint8_t flag : attended) total += flag;
+    return total;
+}
+
+int RosterColumns::countSubmitted() const {
+    int total = 0;
+    for (int64_t t : submittedAt) total += (t != 0);
+    return total;
+}
+
+int RosterColumns::countSubmittedBefore(std::chrono::system_clock::time_point deadline) const {
+    int64_t limit = std::chrono::duration_cast<std::chrono::microseconds>(deadline.time_since_epoch()).count();
+    int total = 0;
+    for (int64_t t : submittedAt) total += (t != 0 && t < limit);
+    return total;
+}
+
+int RosterColumns::countBreaks() const {
+    int total = 0;
+    for (uint16_t count : breakCounts) total += count;
+    return total;
+}
+
+const std::vector<int> &RosterColumns::getIDs() const {
+    return ids;
+}
+
+const std::vector<uint8_t> &RosterColumns::getAttendance() const {
+    return attended;
+}
+
+const std::vector<int64_t> &RosterColumns::getSubmissionTimes() const {
+    return submittedAt;
+}
+
+const std::vector<int> &RosterColumns::getVersions() const {
+    return versions;
+}
+
+const std::vector<int32_t> &RosterColumns::getSeats() const {
+    return seats;
+}
+
+const std::vector<uint16_t> &RosterColumns::getBreakCounts() const {
+    return breakCounts;
+}
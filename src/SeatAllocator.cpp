@@ -0,0 +1,238 @@
+/**
+ * @file SeatAllocator.cpp
+ * @brief Implementation of the SeatAllocator class.
+ *
+ * This file implements the SeatAllocator class. Each row is stored as a run of
+ * 64-bit words where a set bit marks a taken seat, and a second bitmap marks the
+ * rows that are completely full so allocation can skip them a word at a time.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-16
+ */
+
+#include "SeatAllocator.h"
+#include <cstddef>
+
+namespace {
+    const uint64_t ALL_TAKEN = ~uint64_t(0);
+
+    // Index of the lowest set bit; word must not be zero
+    inline int lowestSetBit(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(word);
+#else
+        int index = 0;
+        while (!(word & 1)) {
+            word >>= 1;
+            ++index;
+        }
+        return index;
+#endif
+    }
+
+    // Bitmap of `count` bits with the bits past `count` (the padding) set
+    std::vector<uint64_t> paddedBitmap(int count, int words) {
+        std::vector<uint64_t> bitmap(words, 0);
+        int used = count % 64;
+        if (used != 0) {
+            bitmap.back() = ALL_TAKEN << used;
+        }
+        return bitmap;
+    }
+}
+
+// Constructor: empty room
+SeatAllocator::SeatAllocator() : rows(0), cols(0), wordsPerRow(0), takenCount(0) {}
+
+// Constructor: room with every seat free
+SeatAllocator::SeatAllocator(int rows, int cols) : SeatAllocator() {
+    reset(rows, cols);
+}
+
+void SeatAllocator::reset(int rows, int cols) {
+    this->rows = rows > 0 ? rows : 0;
+    this->cols = cols > 0 ? cols : 0;
+    wordsPerRow = (this->cols + 63) / 64;
+    takenCount = 0;
+
+    std::vector<uint64_t> row = paddedBitmap(this->cols, wordsPerRow);
+    seatBits.clear();
+    seatBits.reserve(static_cast<std::size_t>(this->rows) * wordsPerRow);
+    for (int r = 0; r < this->rows; ++r) {
+        seatBits.insert(seatBits.end(), row.begin(), row.end());
+    }
+
+    // A room without columns has nothing to hand out, so every row starts full
+    fullRows = paddedBitmap(this->rows, (this->rows + 63) / 64);
+    if (this->cols == 0) {
+        for (uint64_t &word : fullRows) word = ALL_TAKEN;
+    }
+}
+
+uint64_t *SeatAllocator::rowWords(int row) {
+    return seatBits.data() + static_cast<std::size_t>(row) * wordsPerRow;
+}
+
+const uint64_t *SeatAllocator::rowWords(int row) const {
+    return seatBits.data() + static_cast<std::size_t>(row) * wordsPerRow;
+}
+
+// Refresh the full-row bit after a row changed
+void SeatAllocator::markRowState(int row) {
+    const uint64_t *words = rowWords(row);
+    bool full = true;
+    for (int w = 0; w < wordsPerRow && full; ++w) {
+        full = words[w] == ALL_TAKEN;
+    }
+
+    uint64_t mask = uint64_t(1) << (row % 64);
+    if (full) {
+        fullRows[row / 64] |= mask;
+    } else {
+        fullRows[row / 64] &= ~mask;
+    }
+}
+
+// First column of `length` adjacent free seats in a row, or -1
+int SeatAllocator::findZeroRun(int row, int length) const {
+    const uint64_t *words = rowWords(row);
+    int pos = 0;
+
+    while (pos + length <= cols) {
+        // Next free seat at or after pos
+        int w = pos / 64;
+        uint64_t freeBits = ~words[w] & (ALL_TAKEN << (pos % 64));
+        while (!freeBits) {
+            if (++w >= wordsPerRow) return -1;
+            freeBits = ~words[w];
+        }
+        int start = w * 64 + lowestSetBit(freeBits);
+        if (start + length > cols) return -1;
+
+        // Next taken seat after start; padding bits stop the run at the end of the row
+        w = start / 64;
+        uint64_t takenBits = words[w] & (ALL_TAKEN << (start % 64));
+        while (!takenBits && ++w < wordsPerRow) {
+            takenBits = words[w];
+        }
+        int end = takenBits ? w * 64 + lowestSetBit(takenBits) : cols;
+
+        if (end - start >= length) return start;
+        pos = end;
+    }
+    return -1;
+}
+
+bool SeatAllocator::allocate(int &row, int &col) {
+    for (std::size_t fw = 0; fw < fullRows.size(); ++fw) {
+        uint64_t openRows = ~fullRows[fw];
+        if (!openRows) continue;
+
+        int r = static_cast<int>(fw) * 64 + lowestSetBit(openRows);
+        uint64_t *words = rowWords(r);
+        for (int w = 0; w < wordsPerRow; ++w) {
+            uint64_t freeBits = ~words[w];
+            if (!freeBits) continue;
+
+            int bit = lowestSetBit(freeBits);
+            words[w] |= uint64_t(1) << bit;
+            ++takenCount;
+            markRowState(r);
+
+            row = r;
+            col = w * 64 + bit;
+            return true;
+        }
+    }
+    return false;
+}
+
+int SeatAllocator::allocateMany(int count, std::vector<int> &rows, std::vector<int> &cols) {
+    int taken = 0;
+    for (std::size_t fw = 0; fw < fullRows.size() && taken < count; ++fw) {
+        uint64_t openRows = ~fullRows[fw];
+        while (openRows && taken < count) {
+            int r = static_cast<int>(fw) * 64 + lowestSetBit(openRows);
+            openRows &= openRows - 1;
+
+            uint64_t *words = rowWords(r);
+            for (int w = 0; w < wordsPerRow && taken < count; ++w) {
+                uint64_t freeBits = ~words[w];
+                while (freeBits && taken < count) {
+                    int bit = lowestSetBit(freeBits);
+                    freeBits &= freeBits - 1;
+                    words[w] |= uint64_t(1) << bit;
+                    rows.push_back(r);
+                    cols.push_back(w * 64 + bit);
+                    ++taken;
+                }
+            }
+            markRowState(r);
+        }
+    }
+    takenCount += taken;
+    return taken;
+}
+
+bool SeatAllocator::reserve(int row, int col) {
+    if (isTaken(row, col)) return false;
+
+    rowWords(row)[col / 64] |= uint64_t(1) << (col % 64);
+    ++takenCount;
+    markRowState(row);
+    return true;
+}
+
+bool SeatAllocator::reserveBlock(int length, int &row, int &col) {
+    if (length <= 0 || length > cols) return false;
+
+    for (int r = 0; r < rows; ++r) {
+        if (fullRows[r / 64] & (uint64_t(1) << (r % 64))) continue;
+
+        int start = findZeroRun(r, length);
+        if (start < 0) continue;
+
+        uint64_t *words = rowWords(r);
+        for (int c = start; c < start + length; ++c) {
+            words[c / 64] |= uint64_t(1) << (c % 64);
+        }
+        takenCount += length;
+        markRowState(r);
+
+        row = r;
+        col = start;
+        return true;
+    }
+    return false;
+}
+
+bool SeatAllocator::release(int row, int col) {
+    if (row < 0 || row >= rows || col < 0 || col >= cols) return false;
+
+    uint64_t mask = uint64_t(1) << (col % 64);
+    uint64_t &word = rowWords(row)[col / 64];
+    if (!(word & mask)) return false;
+
+    word &= ~mask;
+    --takenCount;
+    fullRows[row / 64] &= ~(uint64_t(1) << (row % 64));
+    return true;
+}
+
+bool SeatAllocator::isTaken(int row, int col) const {
+    if (row < 0 || row >= rows || col < 0 || col >= cols) return true;
+    return (rowWords(row)[col / 64] >> (col % 64)) & 1;
+}
+
+int SeatAllocator::getRows() const {
+    return rows;
+}
+
+int SeatAllocator::getCols() const {
+    return cols;
+}
+
+int SeatAllocator::getFreeCount() const {
+    return rows * cols - takenCount;
+}
@@ -0,0 +1,289 @@
+/**
+ * @file SessionManager.cpp
+ * @brief Implementation of the SessionManager class.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include "SessionManager.h"
+#include "ExamSnapshot.h"
+#include "Utils.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+
+namespace {
+const char *const SESSION_PREFIX = "exam-";
+const char *const DESK_LOG = "exam-desk.log";
+
+// When the last student with extra time has to stop
+std::chrono::system_clock::time_point latestDeadline(Exam &exam) {
+    std::chrono::minutes longest{0};
+    for (const Student &s : exam.getStudents()) longest = std::max(longest, s.getExtraTime());
+    return exam.getEndTime() + longest;
+}
+}
+
+// Constructor
+SessionManager::SessionManager(const std::string &directory, std::size_t workerThreads, std::size_t photoCacheBytes)
+    : directory(directory), photos(photoCacheBytes),
+      deskLog((std::filesystem::path(directory) / DESK_LOG).string()), pool(workerThreads), activeIndex(0) {
+    breakMonitor.addAlertHandler([this](const BreakAlert &alert) {
+        log(alert.examKey, "student " + std::to_string(alert.studentID) + ": out on break since " +
+                               timePointToString(alert.leftAt) + ", past the " +
+                               std::to_string(alert.limit.count()) + "-minute limit");
+    });
+}
+
+// Destructor
+SessionManager::~SessionManager() {
+    auto now = std::chrono::system_clock::now();
+    while (!sessions.empty()) {
+        // Students with extra time may still be writing after the end time
+        closeSession(sessions.size() - 1, now > latestDeadline(*sessions.back()->exam));
+    }
+}
+
+std::string SessionManager::sessionKey(const Exam &exam) {
+    std::string key = exam.getCourseNum() + "-" + exam.getRmNum();
+    for (char &c : key) {
+        if (!std::isalnum(static_cast<unsigned char>(c)) && c != '-') c = '_';
+    }
+    return key;
+}
+
+std::string SessionManager::pathFor(const std::string &key, const char *extension) const {
+    return (std::filesystem::path(directory) / (SESSION_PREFIX + key + extension)).string();
+}
+
+ExamSession *SessionManager::openExam(const std::string &dataPath) {
+    auto exam = std::make_unique<Exam>();
+    if (!exam->loadFromFile(dataPath)) return nullptr;
+
+    std::string key = sessionKey(*exam);
+    for (const auto &session : sessions) {
+        if (session->key == key) {
+            log(key, "already open, not loaded again from " + dataPath);
+            return nullptr;
+        }
+    }
+
+    // A snapshot from an earlier run would not match the new journal
+    std::remove(pathFor(key, ".snapshot").c_str());
+    ExamSession *session = addSession(std::move(exam), dataPath, pathFor(key, ".journal"), 0);
+    log(key, "opened from " + dataPath);
+
+    std::vector<std::string> photoPaths;
+    photoPaths.reserve(session->exam->getStudents().size());
+    for (const Student &s : session->exam->getStudents()) photoPaths.push_back(s.getPicURL());
+    photos.prefetch(photoPaths, pool);
+    return session;
+}
+
+ExamSession *SessionManager::recoverExam(const std::string &journalPath) {
+    JournalInfo found = ExamJournal::inspect(journalPath);
+    if (!found.found) return nullptr;
+
+    // The snapshot sits next to the journal with the same name
+    std::string snapshotPath = (std::filesystem::path(journalPath).replace_extension(".snapshot")).string();
+    auto exam = std::make_unique<Exam>();
+    SnapshotInfo snapshot = ExamSnapshot::inspect(snapshotPath);
+    bool fromSnapshot = snapshot.found && snapshot.examDataPath == found.examDataPath &&
+                        snapshot.eventSequence <= found.events &&
+                        ExamSnapshot::load(snapshotPath, *exam).found;
+    if (!fromSnapshot) {
+        // A snapshot that failed part-way leaves its students behind; start over from the data file
+        exam = std::make_unique<Exam>();
+        if (!exam->loadFromFile(found.examDataPath)) return nullptr;
+    }
+
+    std::string key = sessionKey(*exam);
+    for (const auto &session : sessions) {
+        if (session->key == key) return nullptr;
+    }
+
+    JournalInfo recovered = ExamJournal::recover(journalPath, *exam);
+    ExamSession *session = addSession(std::move(exam), recovered.examDataPath, journalPath, recovered.validBytes);
+    session->snapshotPath = snapshotPath;
+    log(key, "recovered " + std::to_string(recovered.events) + " journal records" +
+                 (fromSnapshot ? " on top of the snapshot" : ""));
+    return session;
+}
+
+// Take ownership of a loaded exam, open its journal and make it the active session
+ExamSession *SessionManager::addSession(std::unique_ptr<Exam> exam, const std::string &dataPath,
+                                        const std::string &journalPath, std::uint64_t resumeAt) {
+    auto session = std::make_unique<ExamSession>();
+    session->key = sessionKey(*exam);
+    session->dataPath = dataPath;
+    session->journalPath = journalPath;
+    session->snapshotPath = pathFor(session->key, ".snapshot");
+    session->exam = std::move(exam);
+    session->journal = std::make_unique<ExamJournal>(journalPath);
+    if (session->journal->open(dataPath, resumeAt)) {
+        session->journal->attach(*session->exam);
+    } else {
+        log(session->key, "journal " + journalPath + " could not be opened; changes will not survive a crash");
+    }
+
+    // Runs under the exam's locks, so the event is only queued; the desk log's thread formats and writes it
+    std::uint32_t source = deskLog.addSource(session->key);
+    session->logListener = session->exam->getEventLog().addListener(
+        [this, source](const ExamEvent &event, const std::string &message) {
+            deskLog.post(source, event, message);
+        });
+
+    std::string key = session->key;
+
+    // Timers and the break monitor are in place before the router lets stations find the exam
+    scheduleDeadlines(*session);
+    breakMonitor.watch(key, *session->exam);
+    router.addExam(key, *session->exam);
+
+    sessions.push_back(std::move(session));
+    activeIndex = sessions.size() - 1;
+    return sessions.back().get();
+}
+
+// One timer for the end of the exam, and one per student with extra time
+void SessionManager::scheduleDeadlines(ExamSession &session) {
+    Exam *exam = session.exam.get();
+    std::string key = session.key;
+    auto endTime = exam->getEndTime();
+    session.deadlineTimers.push_back(timers.schedule(endTime, [this, exam, key, endTime] {
+        std::size_t submitted = exam->submitDue(endTime);
+        deadlineSubmissions += submitted;
+        log(key, "time is up; " + std::to_string(submitted) + " exams submitted");
+    }));
+
+    for (const Student &s : exam->getStudents()) {
+        if (s.getExtraTime().count() == 0) continue;
+        int id = s.getID();
+        // The event log listener records the submission in the desk log
+        session.deadlineTimers.push_back(timers.schedule(endTime + s.getExtraTime(), [this, exam, id] {
+            if (exam->submitAtDeadline(id)) deadlineSubmissions++;
+        }));
+    }
+}
+
+std::vector<std::string> SessionManager::findUnfinishedJournals() const {
+    std::vector<std::string> found;
+    std::error_code ec;
+    for (const auto &entry : std::filesystem::directory_iterator(directory, ec)) {
+        std::string name = entry.path().filename().string();
+        // exam-<key>.journal, plus exam.journal from single-exam versions
+        if (name.rfind("exam", 0) != 0 || entry.path().extension() != ".journal") continue;
+        JournalInfo info = ExamJournal::inspect(entry.path().string());
+        if (info.found && !info.finished) found.push_back(entry.path().string());
+    }
+    return found;
+}
+
+void SessionManager::closeSession(std::size_t index, bool finished) {
+    if (index >= sessions.size()) return;
+    // Queued snapshots and prefetches may still refer to the session
+    pool.waitIdle();
+
+    ExamSession &session = *sessions[index];
+    router.removeExam(session.key);
+    {
+        // A station thread may still be applying commands to an exam it found before the removal
+        std::unique_lock<std::shared_mutex> drained(examsInUse);
+    }
+    for (TimerWheel::TimerId id : session.deadlineTimers) timers.cancel(id);
+    breakMonitor.unwatch(session.key);
+    session.exam->getEventLog().removeListener(session.logListener);
+    session.journal->close(finished);
+    log(session.key, finished ? "closed, exam finished" : "closed");
+
+    sessions.erase(sessions.begin() + static_cast<std::ptrdiff_t>(index));
+    if (activeIndex >= sessions.size()) {
+        activeIndex = sessions.empty() ? 0 : sessions.size() - 1;
+    } else if (activeIndex > index) {
+        activeIndex--;
+    }
+}
+
+std::size_t SessionManager::getSessionCount() const {
+    return sessions.size();
+}
+
+ExamSession *SessionManager::getSession(std::size_t index) {
+    return sessions.at(index).get();
+}
+
+ExamSession *SessionManager::getActiveSession() {
+    return sessions.empty() ? nullptr : sessions[activeIndex].get();
+}
+
+std::size_t SessionManager::getActiveIndex() const {
+    return activeIndex;
+}
+
+bool SessionManager::setActiveSession(std::size_t index) {
+    if (index >= sessions.size()) return false;
+    activeIndex = index;
+    return true;
+}
+
+Exam *SessionManager::findExam(const std::string &examKey, int studentID,
+                               std::chrono::system_clock::time_point at) const {
+    if (!examKey.empty()) return router.findExam(examKey);
+    StudentRoute route;
+    return router.route(studentID, at, route) ? route.exam : nullptr;
+}
+
+std::shared_lock<std::shared_mutex> SessionManager::holdExams() const {
+    return std::shared_lock<std::shared_mutex>(examsInUse);
+}
+
+void SessionManager::snapshotAll() {
+    for (const auto &owned : sessions) {
+        ExamSession *session = owned.get();
+        std::uint64_t sequence = session->exam->getEventLog().nextSequence();
+        if (sequence == session->snapshotSequence.load()) continue;   // Nothing new
+        if (session->snapshotQueued.exchange(true)) continue;         // The last one is still being written
+
+        pool.submit([this, session, sequence] {
+            std::string image = ExamSnapshot::capture(*session->exam, session->dataPath);
+            // Every event the snapshot covers must be in the journal before the snapshot replaces the old one
+            if (session->journal->flush() && ExamSnapshot::write(session->snapshotPath, image)) {
+                session->snapshotSequence.store(sequence);
+            } else {
+                log(session->key, "snapshot failed");
+            }
+            session->snapshotQueued.store(false);
+        });
+    }
+}
+
+std::size_t SessionManager::advanceDeadlines(std::chrono::system_clock::time_point now) {
+    deadlineSubmissions = 0;
+    timers.advance(now);
+    return deadlineSubmissions;
+}
+
+void SessionManager::log(const std::string &key, const std::string &message) {
+    deskLog.write(deskLog.addSource(key), message);
+}
+
+BreakMonitor &SessionManager::getBreakMonitor() {
+    return breakMonitor;
+}
+
+ThreadPool &SessionManager::getThreadPool() {
+    return pool;
+}
+
+StudentRouter &SessionManager::getRouter() {
+    return router;
+}
+
+PhotoCache &SessionManager::getPhotoCache() {
+    return photos;
+}
@@ -0,0 +1,64 @@
+/**
+ * @file StringPool.cpp
+ * @brief Implementation of the StringPool class.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include "StringPool.h"
+#include <algorithm>
+#include <cstring>
+
+// Constructor
+StringPool::StringPool() : blockSize(0), blockUsed(0), byteCount(0) {}
+
+// Copy text to the end of the current block, starting a new one when it does not fit; caller holds the lock
+std::string_view StringPool::copy(std::string_view text) {
+    if (text.empty()) return std::string_view();
+    if (blocks.empty() || blockSize - blockUsed < text.size()) {
+        std::size_t next = blocks.empty() ? FIRST_BLOCK_SIZE : std::min(blockSize * 2, MAX_BLOCK_SIZE);
+        blockSize = std::max(next, text.size());
+        blocks.push_back(std::unique_ptr<char[]>(new char[blockSize]));
+        blockUsed = 0;
+    }
+    char *at = blocks.back().get() + blockUsed;
+    std::memcpy(at, text.data(), text.size());
+    blockUsed += text.size();
+    byteCount += text.size();
+    return std::string_view(at, text.size());
+}
+
+std::string_view StringPool::store(std::string_view text) {
+    std::lock_guard<std::mutex> guard(lock);
+    return copy(text);
+}
+
+std::string_view StringPool::intern(std::string_view text) {
+    std::lock_guard<std::mutex> guard(lock);
+    auto it = shared.find(text);
+    if (it != shared.end()) return *it;
+    std::string_view stored = copy(text);
+    if (!stored.empty()) shared.insert(stored);
+    return stored;
+}
+
+PooledPath StringPool::storePath(std::string_view path) {
+    std::size_t split = path.find_last_of("/\\");
+    split = split == std::string_view::npos ? 0 : split + 1;
+    PooledPath stored;
+    stored.directory = intern(path.substr(0, split));
+    stored.file = store(path.substr(split));
+    return stored;
+}
+
+std::size_t StringPool::getByteCount() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return byteCount;
+}
+
+std::size_t StringPool::getSharedCount() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return shared.size();
+}
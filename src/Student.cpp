@@ -12,27 +12,62 @@
  */
 
 #include "Student.h"
-#include <sstream>
-#include <iomanip>
-#include <ctime>
+#include <algorithm>
+#include "Utils.h"
 
 // Constructor
-Student::Student(int ID, const std::string &name, const std::string &DOB, const std::string &pic_URL, bool isAttend, bool isSubmit)
-    : User(ID, name, DOB, pic_URL), isAttend(isAttend), isSubmit(isSubmit), examVersion(0) {}
+Student::Student(int ID, std::string_view name, std::string_view DOB, std::string_view pic_URL, bool isAttend, bool isSubmit)
+    : User(ID, name, DOB, pic_URL), examVersion(0), submittedAt(0), firstBreak(BreakLog::NONE),
+      lastBreak(BreakLog::NONE), seatRow(-1), seatCol(-1), extraMinutes(0), breakCount(0),
+      state(static_cast<std::uint8_t>((isAttend ? ATTENDED : 0) | (isSubmit ? SUBMITTED : 0))) {}
 
-// Getter for Seat Number
-std::string Student::getSeatNum() const {
-    return seatNum;
+// Constructor with the exam's string pool
+Student::Student(int ID, std::string_view name, std::string_view DOB, std::string_view pic_URL,
+                 std::shared_ptr<StringPool> pool)
+    : User(ID, name, DOB, pic_URL, std::move(pool)), examVersion(0), submittedAt(0),
+      firstBreak(BreakLog::NONE), lastBreak(BreakLog::NONE), seatRow(-1), seatCol(-1), extraMinutes(0), breakCount(0),
+      state(0) {}
+
+// Share the text storage of an exam
+void Student::useStringPool(const std::shared_ptr<StringPool> &pool) {
+    moveToPool(pool);
+}
+
+// Record breaks in an exam's log, bringing along any taken before joining
+void Student::useBreakLog(const std::shared_ptr<BreakLog> &log) {
+    if (log == breakLog) return;
+    std::shared_ptr<BreakLog> previous = std::move(breakLog);
+    BreakView taken(previous.get(), firstBreak, lastBreak, breakCount);
+    breakLog = log;
+    breakCount = 0;
+    for (const Break &b : taken) {
+        leaveForBreak(b.getStartTimePoint());
+        if (b.hasEnded()) returnFromBreak(b.getEndTimePoint());
+    }
 }
 
-// Setter for Seat Number
-void Student::setSeatNum(const std::string &seat) {
-    seatNum = seat;
+// Setter for Seat
+void Student::setSeat(int row, int col) {
+    seatRow = static_cast<std::int16_t>(row);
+    seatCol = static_cast<std::int16_t>(col);
+}
+
+// Remove the seat assignment
+void Student::clearSeat() {
+    seatRow = -1;
+    seatCol = -1;
+}
+
+// Seat label for display, rows and columns counted from 1
+std::string Student::getSeatNum() const {
+    if (!hasSeat()) return "";
+    return "Row: " + std::to_string(seatRow + 1) + "\nColum: " + std::to_string(seatCol + 1);
 }
 
-// Getter for Exam Version
-int Student::getExamVersion() const {
-    return examVersion;
+// Compact seat code for reports
+std::string Student::getSeatCode() const {
+    if (!hasSeat()) return "";
+    return "R" + std::to_string(seatRow + 1) + "C" + std::to_string(seatCol + 1);
 }
 
 // Setter for Exam Version
@@ -40,52 +75,65 @@ void Student::setExamVersion(int version) {
     examVersion = version;
 }
 
-// Getter for Attendance
-bool Student::getAttendance() const {
-    return isAttend;
+// Setter for Extra Time
+void Student::setExtraTime(std::chrono::minutes extra) {
+    auto minutes = std::min<std::chrono::minutes::rep>(std::max<std::chrono::minutes::rep>(extra.count(), 0),
+                                                       MAX_EXTRA_MINUTES);
+    extraMinutes = static_cast<std::uint16_t>(minutes);
 }
 
 // Setter for Attendance
 void Student::setAttendance(bool status) {
-    isAttend = status;
+    state = static_cast<std::uint8_t>(status ? state | ATTENDED : state & ~ATTENDED);
 }
 
 // Start a new break (automatically records start time)
 void Student::leaveForBreak() {
-    Break newBreak;                 // Break Class will automatically record the current system time
-    breaks.push_back(newBreak);
+    leaveForBreak(std::chrono::system_clock::now());
+}
+
+// Start a new break at a given time
+void Student::leaveForBreak(std::chrono::system_clock::time_point at) {
+    if (!breakLog) breakLog = std::make_shared<BreakLog>();
+    lastBreak = breakLog->start(getID(), at, breakCount ? lastBreak : BreakLog::NONE);
+    if (!breakCount) firstBreak = lastBreak;
+    breakCount++;
 }
 
 // End the last recorded break
 void Student::returnFromBreak() {
-    if (!breaks.empty()) {
-        breaks.back().endBreak();  // Set end time for the last break
+    returnFromBreak(std::chrono::system_clock::now());
+}
+
+// End the last recorded break at a given time
+void Student::returnFromBreak(std::chrono::system_clock::time_point at) {
+    if (breakCount) {
+        breakLog->end(lastBreak, at);  // Set end time for the last break
     }
 }
 
-// Get a reference to break records
-std::vector<Break>* Student::getBreaksList() {
-    return &breaks;
+// Get a view of break records
+BreakView Student::getBreaksList() const {
+    return BreakView(breakLog.get(), firstBreak, lastBreak, breakCount);
 }
 
 // Submit the exam
 void Student::submitExam() {
-    if (!isSubmit) {
-        isSubmit = true;
-        submissionTime = std::chrono::system_clock::now();
-    }
-}
-// Getter for Submission
-bool Student::getSubmissionStatus() const {
-    return isSubmit;
+    submitExam(std::chrono::system_clock::now());
 }
 
+// Submit the exam at a given time
+void Student::submitExam(std::chrono::system_clock::time_point at) {
+    if (!(state & SUBMITTED)) {
+        state |= SUBMITTED;
+        submittedAt = at.time_since_epoch().count();
+    }
+}
 // Getter for Submission Time
 std::string Student::getSubmissionTime() const {
     // No End Time if still in a break
-    if (!isSubmit) return "Exam in progress";
-    std::time_t submissionT = std::chrono::system_clock::to_time_t(submissionTime);
-    std::ostringstream oss;
-    oss << std::put_time(std::localtime(&submissionT), "%H:%M:%S");
-    return oss.str();
+    if (!(state & SUBMITTED)) return "Exam in progress";
+    char text[CLOCK_TEXT_SIZE];
+    return std::string(text, formatClockTime(getSubmissionTimePoint(), text));
 }
+
@@ -0,0 +1,140 @@
+/**
+ * @file StudentRouter.cpp
+ * @brief Implementation of the StudentRouter class.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include "StudentRouter.h"
+#include <algorithm>
+#include <mutex>
+
+// Constructor
+StudentRouter::StudentRouter() : filterRejects(0) {}
+
+// Add the students of one sitting to the chains and the filter; caller holds the lock exclusively
+void StudentRouter::indexExam(std::uint32_t sitting) {
+    std::vector<Student> &students = sittings[sitting].exam->getStudents();
+    std::size_t expected = byStudent.size() + students.size();
+    byStudent.reserve(expected);
+    links.reserve(links.size() + students.size());
+
+    bool refill = expected > filter.getCapacity();
+    if (refill) filter.reset(expected * 2);   // Room to grow before the next refill
+
+    for (const Student &s : students) {
+        auto slot = static_cast<std::uint32_t>(links.size());
+        auto it = byStudent.find(s.getID());
+        if (it == byStudent.end()) {
+            links.push_back({sitting, NO_LINK});
+            byStudent.emplace(s.getID(), slot);
+            if (!refill) filter.add(static_cast<std::uint64_t>(s.getID()));
+        } else {
+            links.push_back({sitting, it->second});
+            it->second = slot;
+        }
+    }
+    if (refill) {
+        for (const auto &entry : byStudent) filter.add(static_cast<std::uint64_t>(entry.first));
+    }
+}
+
+void StudentRouter::addExam(const std::string &examKey, Exam &exam) {
+    StudentRoute sitting;
+    sitting.examKey = examKey;
+    sitting.courseNum = exam.getCourseNum();
+    sitting.room = exam.getRmNum();
+    sitting.start = exam.getStartTime();
+    sitting.end = exam.getEndTime();
+    sitting.exam = &exam;
+
+    std::unique_lock<std::shared_mutex> guard(lock);
+    eraseSitting(examKey);
+    sittings.push_back(std::move(sitting));
+    indexExam(static_cast<std::uint32_t>(sittings.size() - 1));
+}
+
+bool StudentRouter::removeExam(const std::string &examKey) {
+    std::unique_lock<std::shared_mutex> guard(lock);
+    return eraseSitting(examKey);
+}
+
+// Exams are removed rarely, so the index is rebuilt from the remaining sittings; caller holds the lock exclusively
+bool StudentRouter::eraseSitting(const std::string &examKey) {
+    auto it = std::find_if(sittings.begin(), sittings.end(),
+                           [&examKey](const StudentRoute &s) { return s.examKey == examKey; });
+    if (it == sittings.end()) return false;
+    sittings.erase(it);
+
+    byStudent.clear();
+    links.clear();
+    filter.reset(0);
+    for (std::uint32_t i = 0; i < sittings.size(); ++i) indexExam(i);
+    return true;
+}
+
+bool StudentRouter::mightBeRegistered(int studentID) const {
+    std::shared_lock<std::shared_mutex> guard(lock);
+    return filter.mightContain(static_cast<std::uint64_t>(studentID));
+}
+
+bool StudentRouter::route(int studentID, std::chrono::system_clock::time_point at, StudentRoute &found) const {
+    std::shared_lock<std::shared_mutex> guard(lock);
+    if (!filter.mightContain(static_cast<std::uint64_t>(studentID))) {
+        filterRejects.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    auto it = byStudent.find(studentID);
+    if (it == byStudent.end()) return false;
+
+    const StudentRoute *running = nullptr, *upcoming = nullptr, *past = nullptr;
+    for (std::uint32_t l = it->second; l != NO_LINK; l = links[l].next) {
+        const StudentRoute &s = sittings[links[l].sitting];
+        if (s.start <= at && at <= s.end) {
+            if (!running || s.start < running->start) running = &s;
+        } else if (s.start > at) {
+            if (!upcoming || s.start < upcoming->start) upcoming = &s;
+        } else if (!past || s.end > past->end) {
+            past = &s;
+        }
+    }
+    found = running ? *running : upcoming ? *upcoming : *past;
+    return true;
+}
+
+std::vector<StudentRoute> StudentRouter::lookup(int studentID) const {
+    std::vector<StudentRoute> found;
+    std::shared_lock<std::shared_mutex> guard(lock);
+    auto it = byStudent.find(studentID);
+    if (it == byStudent.end()) return found;
+    for (std::uint32_t l = it->second; l != NO_LINK; l = links[l].next) {
+        found.push_back(sittings[links[l].sitting]);
+    }
+    std::sort(found.begin(), found.end(),
+              [](const StudentRoute &a, const StudentRoute &b) { return a.start < b.start; });
+    return found;
+}
+
+Exam *StudentRouter::findExam(const std::string &examKey) const {
+    std::shared_lock<std::shared_mutex> guard(lock);
+    for (const StudentRoute &s : sittings) {
+        if (s.examKey == examKey) return s.exam;
+    }
+    return nullptr;
+}
+
+std::size_t StudentRouter::getStudentCount() const {
+    std::shared_lock<std::shared_mutex> guard(lock);
+    return byStudent.size();
+}
+
+std::size_t StudentRouter::getExamCount() const {
+    std::shared_lock<std::shared_mutex> guard(lock);
+    return sittings.size();
+}
+
+std::uint64_t StudentRouter::getFilterRejectCount() const {
+    return filterRejects.load(std::memory_order_relaxed);
+}
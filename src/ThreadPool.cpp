@@ -0,0 +1,64 @@
+/**
+ * @file ThreadPool.cpp
+ * @brief Implementation of the ThreadPool class.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include "ThreadPool.h"
+#include <utility>
+
+// Constructor
+ThreadPool::ThreadPool(std::size_t numThreads) : running(0), stopping(false) {
+    if (numThreads == 0) numThreads = 1;
+    workers.reserve(numThreads);
+    for (std::size_t i = 0; i < numThreads; ++i) {
+        workers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+// Destructor
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    taskReady.notify_all();
+    for (std::thread &worker : workers) worker.join();
+}
+
+void ThreadPool::submit(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        tasks.push_back(std::move(task));
+    }
+    taskReady.notify_one();
+}
+
+void ThreadPool::waitIdle() {
+    std::unique_lock<std::mutex> guard(lock);
+    idle.wait(guard, [this] { return tasks.empty() && running == 0; });
+}
+
+std::size_t ThreadPool::size() const {
+    return workers.size();
+}
+
+void ThreadPool::workerLoop() {
+    std::unique_lock<std::mutex> guard(lock);
+    for (;;) {
+        taskReady.wait(guard, [this] { return stopping || !tasks.empty(); });
+        if (tasks.empty()) return;   // Stopping, and everything queued has run
+
+        std::function<void()> task = std::move(tasks.front());
+        tasks.pop_front();
+        running++;
+        guard.unlock();
+        task();
+        guard.lock();
+        running--;
+        if (tasks.empty() && running == 0) idle.notify_all();
+    }
+}
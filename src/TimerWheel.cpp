@@ -0,0 +1,158 @@
+/**
+ * @file TimerWheel.cpp
+ * @brief Implementation of the TimerWheel class.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include "TimerWheel.h"
+
+namespace {
+const std::int64_t SLOT_MASK = TimerWheel::SLOTS - 1;
+
+// Ticks covered by levels 0 to level
+std::int64_t span(int level) {
+    return std::int64_t(1) << (TimerWheel::SLOT_BITS * (level + 1));
+}
+}
+
+// Constructor
+TimerWheel::TimerWheel(std::chrono::milliseconds tick, Clock::time_point origin)
+    : tick(tick.count() > 0 ? tick : std::chrono::milliseconds(1)), origin(origin), nextTick(0), activeCount(0) {
+    slots.fill(NIL);
+}
+
+// First tick at or after a time, so timers never fire early
+std::int64_t TimerWheel::tickFor(Clock::time_point at) const {
+    std::int64_t ms = std::chrono::duration_cast<std::chrono::milliseconds>(at - origin).count();
+    std::int64_t t = tick.count();
+    return ms <= 0 ? ms / t : (ms + t - 1) / t;
+}
+
+// Put a timer on the slot list for its expiry, relative to the next tick to process
+void TimerWheel::link(std::uint32_t index) {
+    Timer &timer = timers[index];
+    std::int64_t expiry = timer.expiry;
+    std::int64_t delta = expiry - nextTick;
+    int level = 0;
+    if (delta < 0) {
+        expiry = nextTick;
+    } else {
+        while (level < LEVELS - 1 && delta >= span(level)) level++;
+        // Beyond the top level: park in its furthest slot and place it again when that slot cascades
+        if (delta >= span(LEVELS - 1)) expiry = nextTick + span(LEVELS - 1) - 1;
+    }
+
+    auto slot = static_cast<std::uint16_t>(level * SLOTS + ((expiry >> (SLOT_BITS * level)) & SLOT_MASK));
+    timer.slot = slot;
+    timer.prev = NIL;
+    timer.next = slots[slot];
+    if (timer.next != NIL) timers[timer.next].prev = index;
+    slots[slot] = index;
+}
+
+void TimerWheel::unlink(std::uint32_t index) {
+    Timer &timer = timers[index];
+    if (timer.prev != NIL) {
+        timers[timer.prev].next = timer.next;
+    } else {
+        slots[timer.slot] = timer.next;
+    }
+    if (timer.next != NIL) timers[timer.next].prev = timer.prev;
+    timer.prev = timer.next = NIL;
+}
+
+void TimerWheel::release(std::uint32_t index) {
+    Timer &timer = timers[index];
+    timer.active = false;
+    timer.callback = nullptr;
+    timer.generation++;
+    freeList.push_back(index);
+    activeCount--;
+}
+
+// Move every timer in the current slot of a level down to the level that now fits it
+void TimerWheel::cascade(int level) {
+    std::size_t slot = level * SLOTS + ((nextTick >> (SLOT_BITS * level)) & SLOT_MASK);
+    std::uint32_t index = slots[slot];
+    slots[slot] = NIL;
+    while (index != NIL) {
+        std::uint32_t next = timers[index].next;
+        link(index);
+        index = next;
+    }
+}
+
+TimerWheel::TimerId TimerWheel::schedule(Clock::time_point deadline, Callback callback) {
+    std::lock_guard<std::mutex> guard(lock);
+    std::uint32_t index;
+    if (!freeList.empty()) {
+        index = freeList.back();
+        freeList.pop_back();
+    } else {
+        index = static_cast<std::uint32_t>(timers.size());
+        timers.emplace_back();
+    }
+
+    Timer &timer = timers[index];
+    timer.expiry = tickFor(deadline);
+    timer.callback = std::move(callback);
+    timer.active = true;
+    activeCount++;
+    link(index);
+    return (static_cast<TimerId>(timer.generation) << 32) | index;
+}
+
+bool TimerWheel::cancel(TimerId id) {
+    auto index = static_cast<std::uint32_t>(id & 0xFFFFFFFFu);
+    auto generation = static_cast<std::uint32_t>(id >> 32);
+    std::lock_guard<std::mutex> guard(lock);
+    if (index >= timers.size() || !timers[index].active || timers[index].generation != generation) return false;
+    unlink(index);
+    release(index);
+    return true;
+}
+
+std::size_t TimerWheel::advance(Clock::time_point now) {
+    std::vector<Callback> due;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        std::int64_t target = std::chrono::duration_cast<std::chrono::milliseconds>(now - origin).count() /
+                              tick.count();
+        while (nextTick <= target) {
+            if (activeCount == 0) {
+                nextTick = target + 1;   // Nothing to fire or cascade on the way
+                break;
+            }
+
+            // At the start of a block, bring the next block's timers down from the levels above
+            for (int level = LEVELS - 1; level > 0; --level) {
+                if ((nextTick & (span(level - 1) - 1)) == 0) cascade(level);
+            }
+
+            std::uint32_t index = slots[nextTick & SLOT_MASK];
+            slots[nextTick & SLOT_MASK] = NIL;
+            while (index != NIL) {
+                std::uint32_t next = timers[index].next;
+                if (timers[index].expiry <= nextTick) {
+                    due.push_back(std::move(timers[index].callback));
+                    release(index);
+                } else {
+                    link(index);
+                }
+                index = next;
+            }
+            nextTick++;
+        }
+    }
+
+    for (Callback &callback : due) callback();
+    return due.size();
+}
+
+std::size_t TimerWheel::size() const {
+    std::lock_guard<std::mutex> guard(lock);
+    return activeCount;
+}
@@ -15,8 +15,41 @@
 #include "User.h"
 
 // Constructor
-User::User(int ID, const std::string &name, const std::string &DOB, const std::string &pic_URL)
-    : ID(ID), name(name), DOB(DOB), pic_URL(pic_URL) {}
+User::User(int ID, std::string_view name, std::string_view DOB, std::string_view pic_URL,
+           std::shared_ptr<StringPool> pool)
+    : strings(pool ? std::move(pool) : std::make_shared<StringPool>()), ID(ID) {
+    assignName(strings->store(name));
+    assignDOB(strings->intern(DOB));
+    assignPic(strings->storePath(pic_URL));
+}
+
+// Point at pooled text
+void User::assignName(std::string_view text) {
+    name = text.data();
+    nameSize = static_cast<std::uint32_t>(text.size());
+}
+
+void User::assignDOB(std::string_view text) {
+    DOB = text.data();
+    DOBSize = static_cast<std::uint32_t>(text.size());
+}
+
+void User::assignPic(const PooledPath &path) {
+    picDirectory = path.directory.data();
+    picDirectorySize = static_cast<std::uint32_t>(path.directory.size());
+    picFile = path.file.data();
+    picFileSize = static_cast<std::uint32_t>(path.file.size());
+}
+
+// Copy the text into another pool; the old pool goes once no user refers to it
+void User::moveToPool(const std::shared_ptr<StringPool> &pool) {
+    if (pool == strings) return;
+    PooledPath pic = getPicPath();
+    assignName(pool->store(getName()));
+    assignDOB(pool->intern(getDOB()));
+    assignPic(PooledPath{pool->intern(pic.directory), pool->store(pic.file)});
+    strings = pool;
+}
 
 // Getter for ID
 int User::getID() const {
@@ -29,31 +62,41 @@ void User::setID(int ID) {
 }
 
 // Getter for Name
-std::string User::getName() const {
-    return name;
+std::string_view User::getName() const {
+    return std::string_view(name, nameSize);
 }
 
 // Setter for Name
-void User::setName(const std::string &name) {
-    this->name = name;
+void User::setName(std::string_view name) {
+    assignName(strings->store(name));
 }
 
 // Getter for DOB
-std::string User::getDOB() const {
-    return DOB;
+std::string_view User::getDOB() const {
+    return std::string_view(DOB, DOBSize);
 }
 
 // Setter for DOB
-void User::setDOB(const std::string &DOB) {
-    this->DOB = DOB;
+void User::setDOB(std::string_view DOB) {
+    assignDOB(strings->intern(DOB));
 }
 
 // Getter for Picture URL
 std::string User::getPicURL() const {
-    return pic_URL;
+    return getPicPath().str();
+}
+
+// Getter for the picture URL as stored
+PooledPath User::getPicPath() const {
+    return PooledPath{std::string_view(picDirectory, picDirectorySize), std::string_view(picFile, picFileSize)};
+}
+
+// Getter for the pool holding the text
+const std::shared_ptr<StringPool> &User::getStringPool() const {
+    return strings;
 }
 
 // Setter for Picture URL
-void User::setPicURL(const std::string &pic_URL) {
-    this->pic_URL = pic_URL;
+void User::setPicURL(std::string_view pic_URL) {
+    assignPic(strings->storePath(pic_URL));
 }
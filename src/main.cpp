@@ -1,19 +1,20 @@
 /**
  * @file main.cpp
- * @brief Entry point for the University Examination Identity Verification System. Initializes the application, creates an exam instance, and launches the MainWindow for user authentication and exam management.
+ * @brief Entry point for the University Examination Identity Verification System. Initializes the application, creates the exam session manager, and launches the MainWindow for user authentication and exam management.
  * @author Andy Dai
  * @version 1.0
  * @date 2025-03-30
  */
 #include "../include/ui_header/mainwindow.h"
-#include "Exam.h"
+#include "SessionManager.h"
 #include <QApplication>
 
 int main(int argc, char *argv[])
 {
     QApplication a(argc, argv);
-    Exam exam;
-    MainWindow w(&exam);
+    // Owns every exam opened at this desk; declared first so it outlives the window
+    SessionManager sessions;
+    MainWindow w(&sessions);
     w.show();
     return a.exec();
 }
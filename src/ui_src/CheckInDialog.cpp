@@ -21,9 +21,11 @@
   * 
   * @param exam Pointer to the Exam object
   * @param parent Pointer to the parent widget
+  * @param photos Photo cache to read student photos through, or nullptr
+  * @param router Index of every open exam, used to redirect students of other exams, or nullptr
   */
- CheckInDialog::CheckInDialog(Exam* exam, QWidget* parent)
-     : QDialog(parent), examPtr(exam), currentStudent(nullptr)
+ CheckInDialog::CheckInDialog(Exam* exam, QWidget* parent, PhotoCache* photos, const StudentRouter* router)
+     : QDialog(parent), examPtr(exam), photoCache(photos), studentRouter(router), currentStudentID(0)
  {
      setWindowTitle("Student Check-In");
  
@@ -73,30 +75,41 @@
          return;
      }
  
-     currentStudent = examPtr->getStudentByID(studentID);
-     if (!currentStudent) {
-         QMessageBox::critical(this, "Not Found", "Student not found.");
+     // The command applier may be changing the exam, so read a locked copy of the student
+     StudentStatus student;
+     if (!examPtr->readStudent(studentID, student)) {
+         currentStudentID = 0;
+         StudentRoute route;
+         if (studentRouter && studentRouter->route(studentID, std::chrono::system_clock::now(), route)) {
+             QMessageBox::information(this, "Wrong Exam",
+                                      QString("This student writes %1 in room %2.")
+                                          .arg(QString::fromStdString(route.courseNum),
+                                               QString::fromStdString(route.room)));
+         } else {
+             QMessageBox::critical(this, "Not Found", "Student not found.");
+         }
          confirmButton->setEnabled(false);
          return;
      }
  
-     updateStudentInfo(currentStudent);
-     confirmButton->setEnabled(!currentStudent->getAttendance());
+     currentStudentID = studentID;
+     updateStudentInfo(student);
+     confirmButton->setEnabled(!student.attended);
  }
  
  /**
   * @brief Updates the student information on the UI
   * 
-  * @param s Pointer to the Student object
+  * @param s Copy of the student's state
   */
- void CheckInDialog::updateStudentInfo(Student* s) {
-     nameLabel->setText("Name: " + QString::fromStdString(s->getName()));
-     dobLabel->setText("DOB: " + QString::fromStdString(s->getDOB()));
-     seatLabel->setText("Seat: " + QString::fromStdString(s->getSeatNum()));
-     versionLabel->setText("Version: " + QString::number(s->getExamVersion()));
-     statusLabel->setText("Status: " + QString(s->getAttendance() ? "Already Checked In" : "Not Checked In"));
- 
-     QString picPath = QString::fromStdString(s->getPicURL());
+ void CheckInDialog::updateStudentInfo(const StudentStatus& s) {
+     nameLabel->setText("Name: " + QString::fromStdString(s.name));
+     dobLabel->setText("DOB: " + QString::fromStdString(s.DOB));
+     seatLabel->setText("Seat: " + QString::fromStdString(s.seatNum));
+     versionLabel->setText("Version: " + QString::number(s.examVersion));
+     statusLabel->setText("Status: " + QString(s.attended ? "Already Checked In" : "Not Checked In"));
+ 
+     QString picPath = QString::fromStdString(s.picURL);
      photoUrlLabel->setText("Photo URL: " + picPath);
      loadLocalPhoto(picPath);
  }
@@ -108,7 +121,15 @@
   */
  void CheckInDialog::loadLocalPhoto(const QString& path) {
      QPixmap pix;
-     if (!pix.load(path)) {
+     bool loaded = false;
+     if (photoCache) {
+         std::shared_ptr<const std::string> bytes = photoCache->get(path.toStdString());
+         loaded = bytes && pix.loadFromData(reinterpret_cast<const uchar*>(bytes->data()),
+                                            static_cast<uint>(bytes->size()));
+     } else {
+         loaded = pix.load(path);
+     }
+     if (!loaded) {
          photoLabel->setText("Photo not found");
          photoLabel->setPixmap(QPixmap());
          return;
@@ -123,10 +144,10 @@
   * 
   */
  void CheckInDialog::onConfirmCheckIn() {
-     if (!currentStudent) return;
+     if (!currentStudentID) return;
  
-     Student* updated = examPtr->checkIn(currentStudent->getID());
-     if (!updated) {
+     StudentStatus updated;
+     if (!examPtr->checkIn(currentStudentID) || !examPtr->readStudent(currentStudentID, updated)) {
          QMessageBox::warning(this, "Check-In Failed", "Unable to check in student.");
          return;
      }
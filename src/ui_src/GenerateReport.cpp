@@ -20,6 +20,7 @@
  #include <QMessageBox>
  #include "Utils.h"
  #include <iostream>
+ #include <sstream>
  
  /**
   * @brief Constructor for GenerateReport dialog
@@ -67,8 +68,8 @@
   */
  void GenerateReport::populateProctors() {
      for (Proctor &p : examPtr->getProctors()) {
-         QString name = QString::fromStdString(p.getName());
-         QString role = QString::fromStdString(p.getRole());
+         QString name = QString::fromUtf8(p.getName().data(), p.getName().size());
+         QString role = QString::fromUtf8(p.getRole().data(), p.getRole().size());
  
          QLabel *label = new QLabel(QString("- %1 (%2)").arg(name, role));
          QFont font = label->font();
@@ -92,33 +93,11 @@
   * 
   */
  void GenerateReport::populateSummary() {
-     std::vector<Student>& students = examPtr->getStudents();
-     QString examEndTimeStr = timePointToQString(examPtr->getEndTime());
-     QDateTime examEndDT = QDateTime::fromString(examEndTimeStr, "yyyy-MM-dd hh:mm:ss");
- 
-     int totalPresent = 0;
-     int earlySubmission = 0;
-     int totalBreaks = 0;
- 
-     for (Student &s : students) {
-         if (s.getAttendance()) {
-             totalPresent++;
-         }
- 
-         QString submissionTimeStr = QString::fromStdString(s.getSubmissionTime());
-         QDateTime submissionDT = QDateTime::fromString(submissionTimeStr, "yyyy-MM-dd hh:mm:ss");
- 
-         if (s.getSubmissionStatus() && submissionDT < examEndDT) {
-             earlySubmission++;
-         }
- 
-         std::vector<Break> *breaksList = s.getBreaksList();
-         totalBreaks += breaksList->size();
-     }
- 
-     ui->totalPresentValueLabel->setText(QString::number(totalPresent));
-     ui->earlySubmissionsValueLabel->setText(QString::number(earlySubmission));
-     ui->breaksValueLabel->setText(QString::number(totalBreaks));
+     // Live counters kept by the exam; the roster is not walked
+     ExamStats stats = examPtr->getStats();
+     ui->totalPresentValueLabel->setText(QString::number(stats.checkedIn));
+     ui->earlySubmissionsValueLabel->setText(QString::number(stats.earlySubmitted));
+     ui->breaksValueLabel->setText(QString::number(stats.totalBreaks));
  }
  
  /**
@@ -126,7 +105,8 @@
   * 
   */
  void GenerateReport::populateIncidentReport() {
-     std::vector<std::string> incidents = examPtr->getIncidentReport();
+     // Copied under the incident lock; the command applier may still be logging incidents
+     std::vector<Incident> incidents = examPtr->copyIncidents();
  
      if (incidents.empty()) {
          std::cout << "None\n";
@@ -137,8 +117,8 @@
          ui->IncidentReport->addWidget(label);
      }
      else {
-         for (std::string &s : incidents) {
-             QLabel *label = new QLabel(QString::fromStdString(s));
+         for (const Incident &incident : incidents) {
+             QLabel *label = new QLabel(QString::fromStdString(incident.describe()));
              QFont font = label->font();
              font.setPointSize(12);
              label->setFont(font);
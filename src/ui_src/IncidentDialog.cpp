@@ -3,7 +3,7 @@
  * @brief Constructs the IncidentDialog.
  *
  * Initializes a dialog for logging exam-related incidents.
- * Allows the TA or instructor to enter a student ID, proctor ID, and a description of the incident.
+ * Allows the TA or instructor to enter a student ID, proctor ID, category, and a description of the incident.
  * Includes OK and Cancel buttons to confirm or discard the entry.
  *
  * @author Allen Pan
@@ -12,6 +12,7 @@
  * @date 2025-03-30
  */
 #include "../include/ui_header/IncidentDialog.h"
+#include <QComboBox>
 #include <QFormLayout>
 #include <QDialogButtonBox>
 #include <QLineEdit>
@@ -27,11 +28,16 @@ IncidentDialog::IncidentDialog(QWidget* parent) : QDialog(parent) {
 
     studentIDEdit = new QLineEdit(this);
     proctorIDEdit = new QLineEdit(this);
+    categoryBox = new QComboBox(this);
+    for (int code = 0; code < INCIDENT_CATEGORY_COUNT; ++code) {
+        categoryBox->addItem(incidentCategoryName(incidentCategoryFromCode(code)), code);
+    }
     messageEdit = new QTextEdit(this);
 
     QFormLayout* layout = new QFormLayout;
     layout->addRow("Student ID:", studentIDEdit);
     layout->addRow("Proctor ID:", proctorIDEdit);
+    layout->addRow("Category:", categoryBox);
     layout->addRow("Incident Message:", messageEdit);
 
     QDialogButtonBox* buttonBox = new QDialogButtonBox(QDialogButtonBox::Ok | QDialogButtonBox::Cancel);
@@ -60,6 +66,15 @@ int IncidentDialog::getProctorID() const {
     return proctorIDEdit->text().toInt();
 }
 
+/**
+ * @brief Gets the selected incident category
+ * 
+ * @return IncidentCategory The category
+ */
+IncidentCategory IncidentDialog::getCategory() const {
+    return incidentCategoryFromCode(categoryBox->currentData().toInt());
+}
+
 /**
  * @brief Gets the incident message
  * 
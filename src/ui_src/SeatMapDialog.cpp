@@ -53,28 +53,16 @@ SeatMapDialog::SeatMapDialog(Exam* exam, QWidget* parent)
     for (int row = 0; row < exam->getMaxRow(); ++row) {
         for (int col = 0; col < exam->getMaxCol(); ++col) {
 
-            QString seatLabel = QString("Row: %1\nColum: %2")
-                                    .arg(row + 1)
-                                    .arg(col + 1);
-
             QPushButton* seatBtn = new QPushButton(
                 QString::number(row + 1) + "-" + QString::number(col + 1)
             );
-            seatBtn->setProperty("seatString", seatLabel);
+            seatBtn->setProperty("seatRow", row);
+            seatBtn->setProperty("seatCol", col);
 
-            bool seatIsFree = true;
-            bool seatOnBreak = false;
-
-            
-            for (Student &s : exam->getStudents()) {
-                if (QString::fromStdString(s.getSeatNum()) == seatLabel) {
-                    seatIsFree = false;
-                    if (exam->isOnBreak(s.getID())) {
-                        seatOnBreak = true;
-                    }
-                    break;
-                }
-            }
+            // The command applier may be changing the exam, so read a locked copy of the occupant
+            StudentStatus occupant;
+            bool seatIsFree = !exam->readStudentAtSeat(row, col, occupant);
+            bool seatOnBreak = !seatIsFree && occupant.onBreak;
 
             if (seatOnBreak) {
                 seatBtn->setStyleSheet("background-color: yellow;");
@@ -124,20 +112,20 @@ SeatMapDialog::SeatMapDialog(Exam* exam, QWidget* parent)
  */
 void SeatMapDialog::handleSeatClick() {
     QPushButton* btn = qobject_cast<QPushButton*>(sender());
-    QString seatStr = btn->property("seatString").toString();
-
-    for (Student& s : exam->getStudents()) {
-        if (QString::fromStdString(s.getSeatNum()) == seatStr) {
-            QString info = QString("Student ID: %1\nName: %2\nDOB: %3\nAttended: %4\nSubmitted: %5")
-                           .arg(s.getID())
-                           .arg(QString::fromStdString(s.getName()))
-                           .arg(QString::fromStdString(s.getDOB()))
-                           .arg(s.getAttendance() ? "Yes" : "No")
-                           .arg(s.getSubmissionStatus() ? "Yes" : "No");
-
-            QMessageBox::information(this, "Student Info", info);
-            return;
-        }
+    int row = btn->property("seatRow").toInt();
+    int col = btn->property("seatCol").toInt();
+
+    StudentStatus s;
+    if (exam->readStudentAtSeat(row, col, s)) {
+        QString info = QString("Student ID: %1\nName: %2\nDOB: %3\nAttended: %4\nSubmitted: %5")
+                       .arg(s.studentID)
+                       .arg(QString::fromStdString(s.name))
+                       .arg(QString::fromStdString(s.DOB))
+                       .arg(s.attended ? "Yes" : "No")
+                       .arg(s.submitted ? "Yes" : "No");
+
+        QMessageBox::information(this, "Student Info", info);
+        return;
     }
 
     QMessageBox::warning(this, "No Student", "No student assigned to this seat.");
@@ -152,33 +140,26 @@ void SeatMapDialog::onSearchClicked() {
     }
 
     
-    Student* foundStudent = exam->getStudentByID(studentID);
-    if (!foundStudent) {
+    StudentStatus foundStudent;
+    if (!exam->readStudent(studentID, foundStudent)) {
         QMessageBox::information(this, "Not Found", "No such student ID in the exam.");
         return;
     }
 
     
-    QString seatLabel = QString::fromStdString(foundStudent->getSeatNum());
-    if (seatLabel.isEmpty()) {
+    if (foundStudent.seatRow < 0) {
         QMessageBox::information(this, "No Seat", "This student has no seat assigned yet.");
         return;
     }
 
-    
-    QPushButton* targetBtn = nullptr;
-    for (auto btn : seatButtons) {
-        QString btnSeatStr = btn->property("seatString").toString();
-        if (btnSeatStr == seatLabel) {
-            targetBtn = btn;
-            break;
-        }
-    }
-
-    if (!targetBtn) {
+    // Buttons are created row by row, so the seat maps straight to its button
+    std::size_t buttonIndex = static_cast<std::size_t>(foundStudent.seatRow) * exam->getMaxCol()
+                              + foundStudent.seatCol;
+    if (buttonIndex >= seatButtons.size()) {
         QMessageBox::warning(this, "Not Found", "Couldn't find a seat button for this student.");
         return;
     }
+    QPushButton* targetBtn = seatButtons[buttonIndex];
 
     
     QString originalStyle = targetBtn->styleSheet();
@@ -55,7 +55,9 @@ SubmissionDialog::SubmissionDialog(Exam* exam, QWidget* parent)
  * @brief Handles the student's exam submission.
  *
  * Validates the input student number, checks if the student exists and has not already submitted,
- * and records the submission via the Student object. Displays appropriate messages based on the result.
+ * and records the submission via the Student object. A student whose own deadline, including any
+ * extra time, has passed is submitted at that deadline instead. Displays appropriate messages based
+ * on the result.
  */
 void SubmissionDialog::onSubmitExam() {
     // Get the current time and validate it's within the exam period
@@ -66,12 +68,6 @@ void SubmissionDialog::onSubmitExam() {
         return;
     }
 
-    if (now > examPtr->getEndTime()) {
-        QMessageBox::warning(this, "Exam has Ended", "All exams has been marked as submitted. ");
-        examPtr->endOfTimeSubmission();
-        return;
-    }
-
     // Read and validate student number input
     QString studentNumberStr = studentNumberLineEdit->text().trimmed();
     if (studentNumberStr.isEmpty()) {
@@ -86,24 +82,35 @@ void SubmissionDialog::onSubmitExam() {
         return;
     }
 
-    // Look up student using Exam::getStudentByID
-    Student* student = examPtr->getStudentByID(studentNumber);
-
-    if (!student) {
+    // Look up a locked copy of the student; the command applier may be changing the exam
+    StudentStatus student;
+    if (!examPtr->readStudent(studentNumber, student)) {
         QMessageBox::information(this, "Submission Failed",
             QString("Student %1 does not exist.").arg(studentNumber));
         return;
     }
 
-    if (student->getAttendance() && !student->getSubmissionStatus()) {
-        student->submitExam();
+    // Students with extra time may still hand in after the common end time, until their own deadline
+    if (now > examPtr->getDeadline(studentNumber)) {
+        if (examPtr->submitAtDeadline(studentNumber)) {
+            QMessageBox::warning(this, "Time is Up",
+                QString("Time is up for student %1. The exam has been marked as submitted at their deadline.")
+                    .arg(studentNumber));
+        } else {
+            QMessageBox::warning(this, "Time is Up",
+                QString("Time is up for student %1. No further submission can be recorded.").arg(studentNumber));
+        }
+        return;
+    }
+
+    if (examPtr->earlySubmission(studentNumber)) {
 
         QString timestamp = QDateTime::currentDateTime().toString("yyyy-MM-dd hh:mm:ss");
         QMessageBox::information(this, "Submission Confirmed",
             QString("Exam submission logged for student %1 at %2.")
                 .arg(studentNumber)
                 .arg(timestamp));
-    } else if (student->getSubmissionStatus()) {
+    } else if (examPtr->readStudent(studentNumber, student) && student.submitted) {
         QMessageBox::information(this, "Submission Failed",
             QString("Exam has already been submitted for student %1.").arg(studentNumber));
     } else {
@@ -8,7 +8,7 @@
  *
  * @author Andy Dai
  * @author Allen Pan
- * @version 1.6
+ * @version 1.7
  * @date 2025-04-2
  */
 
@@ -23,6 +23,10 @@
 #include "Utils.h"
 #include <QFileDialog>
 #include <QMessageBox>
+#include <QStatusBar>
+#include <QComboBox>
+#include <QPushButton>
+#include <QTimer>
 #include "ui_header/SeatMapDialog.h"
 #include "ui_header/IncidentDialog.h"
 #include "ui_header/SubmissionDialog.h"
@@ -34,26 +38,129 @@
  *
  * Initializes the UI and sets the initial view.
  *
- * @param exam Pointer to the active Exam object containing exam session data.
+ * @param sessions The session manager that owns every exam opened at this desk.
  * @param parent Parent widget, default is nullptr.
  */
-MainWindow::MainWindow(Exam *exam, QWidget *parent)
+MainWindow::MainWindow(SessionManager *sessions, QWidget *parent)
     : QMainWindow(parent)
       , ui(new Ui::MainWindow)
-      , examPtr(exam) {
+      , sessionManager(sessions)
+      , examPtr(nullptr)
+      , commandQueue(1024)
+      , applier(new ExamCommandApplier(sessions, &commandQueue, this))
+      , queueLabel(new QLabel(this))
+      , sessionBox(new QComboBox(this))
+      , addExamButton(new QPushButton(tr("Add Exam"), this))
+      , snapshotTimer(new QTimer(this))
+      , deadlineTimer(new QTimer(this)) {
     ui->setupUi(this);
     ui->stackedWidget->setCurrentIndex(0);
+    statusBar()->addWidget(sessionBox);
+    statusBar()->addWidget(addExamButton);
+    statusBar()->addPermanentWidget(queueLabel);
+    addExamButton->setEnabled(false);
+
+    connect(applier, &ExamCommandApplier::commandApplied, this, &MainWindow::onCommandApplied);
+    connect(applier, &ExamCommandApplier::queueStats, this, &MainWindow::onQueueStats);
+    connect(sessionBox, QOverload<int>::of(&QComboBox::activated), this, &MainWindow::onSessionSelected);
+    connect(addExamButton, &QPushButton::clicked, this, &MainWindow::onAddExamClicked);
+
+    // Snapshots run on the session manager's pool; the timer only queues them
+    connect(snapshotTimer, &QTimer::timeout, this, [this] { sessionManager->snapshotAll(); });
+    snapshotTimer->start(60 * 1000);
+
+    // Break alerts come from advanceDeadlines() below, so they already run on the UI thread
+    sessionManager->getBreakMonitor().addAlertHandler([this](const BreakAlert &alert) {
+        QString text = QString("Student %1 in %2 has been on a break since %3, longer than %4 minutes.")
+                           .arg(alert.studentID)
+                           .arg(QString::fromStdString(alert.examKey))
+                           .arg(QString::fromStdString(timePointToString(alert.leftAt)))
+                           .arg(alert.limit.count());
+        // Not modal: the desk keeps checking students in while the alert is up
+        auto *box = new QMessageBox(QMessageBox::Warning, "Overdue Break", text, QMessageBox::Ok, this);
+        box->setAttribute(Qt::WA_DeleteOnClose);
+        box->setModal(false);
+        box->show();
+    });
+
+    // Exams submit themselves at their end time, and extra-time students at their own deadlines
+    connect(deadlineTimer, &QTimer::timeout, this, [this] {
+        if (sessionManager->advanceDeadlines(std::chrono::system_clock::now()) > 0) {
+            statusBar()->showMessage(tr("Time is up: exams submitted automatically"), 5000);
+        }
+    });
+    deadlineTimer->start(1000);
+
+    // Journals that were never closed mean the last run ended in a crash
+    unfinishedJournals = sessionManager->findUnfinishedJournals();
 }
 
 
 /**
  * @brief Destructor for MainWindow.
+ *
+ * Stops the command applier before the queue it drains is destroyed. The
+ * session manager closes the exams and their journals.
  */
 MainWindow::~MainWindow() {
+    applier->stop();
+    applier->wait();
     delete ui;
 }
 
 
+CommandQueue &MainWindow::getCommandQueue() {
+    return commandQueue;
+}
+
+
+/**
+ * @brief Slot triggered for every command applied from the queue.
+ *
+ * @param examKey The session the command went to.
+ * @param type The kind of command.
+ * @param studentID The student the command was for.
+ * @param status The outcome.
+ */
+void MainWindow::onCommandApplied(const QString &examKey, ExamCommandType type, int studentID, BatchStatus status) {
+    QString action;
+    switch (type) {
+        case ExamCommandType::CheckIn:     action = "Check-in"; break;
+        case ExamCommandType::ToggleBreak: action = "Break"; break;
+        case ExamCommandType::Submit:      action = "Submission"; break;
+        case ExamCommandType::Incident:    action = "Incident"; break;
+    }
+
+    QString result;
+    switch (status) {
+        case BatchStatus::CheckedIn:          result = "checked in"; break;
+        case BatchStatus::Submitted:          result = "submitted"; break;
+        case BatchStatus::BreakStarted:       result = "left for break"; break;
+        case BatchStatus::BreakEnded:         result = "returned from break"; break;
+        case BatchStatus::NotFound:           result = "not found"; break;
+        case BatchStatus::AlreadyDone:        result = "already done"; break;
+        case BatchStatus::Ineligible:         result = "not eligible"; break;
+        case BatchStatus::NoSeat:             result = "no seat available"; break;
+        case BatchStatus::OutsideBreakWindow: result = "outside the break window"; break;
+        case BatchStatus::Logged:             result = "logged"; break;
+    }
+
+    statusBar()->showMessage(examKey + " " + action + ": student " + QString::number(studentID) + " " + result, 5000);
+}
+
+
+/**
+ * @brief Slot triggered after each batch drained from the command queue.
+ *
+ * @param depth Commands still waiting.
+ * @param highWater Deepest the queue has been.
+ * @param rejected Commands refused because the queue was full.
+ */
+void MainWindow::onQueueStats(qulonglong depth, qulonglong highWater, qulonglong rejected) {
+    queueLabel->setText(QString("Queue: %1 waiting, peak %2, dropped %3").arg(depth).arg(highWater).arg(rejected));
+}
+
+
 /**
  * @brief Populates the exam detail labels with values from the Exam object.
  */
@@ -80,7 +187,7 @@ void MainWindow::populateExamDetails() {
  * @brief Slot triggered when the Check-In dialog button is clicked.
  */
 void MainWindow::on_openCheckInDialog_clicked() {
-    CheckInDialog dialog(examPtr, this);
+    CheckInDialog dialog(examPtr, this, &sessionManager->getPhotoCache(), &sessionManager->getRouter());
     dialog.exec();
 }
 
@@ -100,27 +207,129 @@ void MainWindow::on_loginButton_clicked() {
     QString password = ui->passwordLineEdit->text();
 
     if (username == "Administrator" && password == "cs3307") {
-        QString fileName = QFileDialog::getOpenFileName(this, "Select Exam Data File", "", "Text Files (*.txt)");
+        addExamButton->setEnabled(true);
+        if (offerRecovery()) return;
 
-        if (fileName.isEmpty()) {
-            QMessageBox::warning(this, "No File Selected", "Please select a valid exam data file.");
+        // Logging back in returns to the exams that are already open
+        if (sessionManager->getSessionCount() > 0) {
+            activateSession(sessionManager->getActiveIndex());
             return;
         }
-
-        // Load new data into the Exam object
-        if (!examPtr->loadFromFile(fileName.toStdString())) {
-            QMessageBox::critical(this, "Load Failed", "Failed to load the exam data file.");
-            return;
-        }
-
-        ui->stackedWidget->setCurrentIndex(1);
-        populateExamDetails(); // Cleanly sets all labels
+        openExamFile();
     } else {
         QMessageBox::warning(this, "Login Failed", "Invalid username or password");
     }
 }
 
 
+/**
+ * @brief Asks for an exam data file and opens it as a new session.
+ *
+ * @return true if the exam was loaded and is now the active one.
+ */
+bool MainWindow::openExamFile() {
+    QString fileName = QFileDialog::getOpenFileName(this, "Select Exam Data File", "", "Text Files (*.txt)");
+
+    if (fileName.isEmpty()) {
+        QMessageBox::warning(this, "No File Selected", "Please select a valid exam data file.");
+        return false;
+    }
+
+    ExamSession *session = sessionManager->openExam(fileName.toStdString());
+    if (!session) {
+        QMessageBox::critical(this, "Load Failed",
+                              "Failed to load the exam data file, or an exam for the same course and room is already open.");
+        return false;
+    }
+    if (!session->journal->isOpen()) {
+        QMessageBox::warning(this, "Journal Unavailable",
+                             "The exam journal could not be opened. Changes will not survive a crash.");
+    }
+
+    activateSession(sessionManager->getActiveIndex());
+    return true;
+}
+
+
+/**
+ * @brief Makes a session the one the dashboard works on.
+ *
+ * Input stations are not affected: every queued command names its own exam.
+ *
+ * @param index Position of the session in the session manager.
+ */
+void MainWindow::activateSession(std::size_t index) {
+    sessionManager->setActiveSession(index);
+    examPtr = sessionManager->getActiveSession()->exam.get();
+
+    sessionBox->clear();
+    for (std::size_t i = 0; i < sessionManager->getSessionCount(); ++i) {
+        sessionBox->addItem(QString::fromStdString(sessionManager->getSession(i)->key));
+    }
+    sessionBox->setCurrentIndex(static_cast<int>(sessionManager->getActiveIndex()));
+
+    ui->stackedWidget->setCurrentIndex(1);
+    populateExamDetails(); // Cleanly sets all labels
+
+    // Input stations can be served once the first roster is in place; does nothing if already running
+    applier->startApplying();
+}
+
+
+/**
+ * @brief Slot triggered when another exam is picked in the session list.
+ *
+ * @param index Position of the picked session.
+ */
+void MainWindow::onSessionSelected(int index) {
+    if (index < 0 || static_cast<std::size_t>(index) == sessionManager->getActiveIndex()) return;
+    activateSession(static_cast<std::size_t>(index));
+}
+
+
+/**
+ * @brief Slot triggered when the Add Exam button is clicked.
+ */
+void MainWindow::onAddExamClicked() {
+    openExamFile();
+}
+
+
+/**
+ * @brief Offers to rebuild the exams left open by a crash.
+ *
+ * Each exam is restored from its latest snapshot plus the journal records
+ * written after it, or from its data file and the whole journal when there is
+ * no usable snapshot. Each keeps appending to its own journal.
+ *
+ * @return true if at least one exam was recovered and the dashboard is shown.
+ */
+bool MainWindow::offerRecovery() {
+    if (unfinishedJournals.empty()) return false;
+    std::vector<std::string> found;
+    found.swap(unfinishedJournals);   // Only ask once
+
+    QMessageBox::StandardButton reply = QMessageBox::question(
+        this, tr("Recover Exams"),
+        tr("%1 unfinished exam session(s) were found.\nRecover them?").arg(found.size()),
+        QMessageBox::Yes | QMessageBox::No, QMessageBox::Yes);
+    if (reply == QMessageBox::No) return false;
+
+    int recovered = 0;
+    for (const std::string &journalPath : found) {
+        if (sessionManager->recoverExam(journalPath)) recovered++;
+    }
+    if (recovered == 0) {
+        QMessageBox::critical(this, "Recovery Failed", "Failed to rebuild the exams recorded in the journals.");
+        return false;
+    }
+
+    activateSession(sessionManager->getActiveIndex());
+    statusBar()->showMessage(QString("Recovered %1 of %2 exam sessions").arg(recovered).arg(found.size()), 5000);
+    return true;
+}
+
+
 /**
  * @brief Slot triggered when the Washroom Break button is clicked.
  *
@@ -186,7 +395,7 @@ void MainWindow::on_openIncidentDialog_clicked() {
             continue;
         }
 
-        examPtr->writeIncident(studentID, proctorID, message.toStdString());
+        examPtr->writeIncident(studentID, proctorID, message.toStdString(), dialog.getCategory());
         QMessageBox::information(this, "Incident Logged", "Incident recorded successfully.");
         break;
     }
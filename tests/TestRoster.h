@@ -0,0 +1,142 @@
+/**
+ * @file TestRoster.h
+ * @brief Shared exam builder for the unit tests.
+ *
+ * RosterBuilder sets up an Exam with a numbered roster, a seat map, version
+ * codes and a proctor, running from an hour ago to an hour from now unless a
+ * test asks otherwise. Students are numbered from the first ID, named
+ * "Student <ID>" and have the photo "pic<ID>.jpg"; the proctor has ID 90.
+ * snapshotWithMovedSeat() damages a snapshot image in a way its checksums
+ * do not catch, for the recovery tests.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#ifndef TESTROSTER_H
+#define TESTROSTER_H
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "BinaryIO.h"
+#include "Exam.h"
+
+class RosterBuilder {
+private:
+    int firstID = 1;
+    int numStudents = 8;
+    int rows = 4;
+    int cols = 5;
+    std::vector<int> codes{201, 202};
+    std::string course = "CS3307";
+    std::string room = "MC110";
+    std::chrono::system_clock::time_point start = std::chrono::system_clock::now() - std::chrono::hours(1);
+    std::chrono::system_clock::time_point end = start + std::chrono::hours(2);
+    bool checkIn = false;
+
+public:
+    // Students firstID to firstID + count - 1
+    RosterBuilder &students(int count, int first = 1) {
+        numStudents = count;
+        firstID = first;
+        return *this;
+    }
+
+    RosterBuilder &seats(int numRows, int numCols) {
+        rows = numRows;
+        cols = numCols;
+        return *this;
+    }
+
+    RosterBuilder &versions(std::vector<int> versionCodes) {
+        codes = std::move(versionCodes);
+        return *this;
+    }
+
+    RosterBuilder &sitting(const std::string &courseNum, const std::string &rmNum) {
+        course = courseNum;
+        room = rmNum;
+        return *this;
+    }
+
+    RosterBuilder &schedule(std::chrono::system_clock::time_point startTime, std::chrono::system_clock::duration length) {
+        start = startTime;
+        end = startTime + length;
+        return *this;
+    }
+
+    // Every student checked in, in ID order, when the exam is built
+    RosterBuilder &checkedIn() {
+        checkIn = true;
+        return *this;
+    }
+
+    std::unique_ptr<Exam> build() const {
+        auto exam = std::make_unique<Exam>();
+        exam->setTermNum(1251);
+        exam->setTermName("Winter 2026");
+        exam->setCourseNum(course);
+        exam->setRmNum(room);
+        exam->setCapacity(rows * cols);
+        exam->setStartTime(start);
+        exam->setEndTime(end);
+        exam->setMaxRow(rows);
+        exam->setMaxCol(cols);
+        exam->setNumVersions(static_cast<int>(codes.size()));
+        exam->setVersionsCode(codes);
+        exam->initializeSeatMap();
+        exam->reserveRoster(numStudents, 1);
+
+        std::vector<int> ids;
+        for (int id = firstID; id < firstID + numStudents; ++id) {
+            exam->addStudent(Student(id, "Student " + std::to_string(id), "2002-01-01",
+                                     "pic" + std::to_string(id) + ".jpg", exam->getStringPool()));
+            ids.push_back(id);
+        }
+        exam->addProctor(Proctor(90, "Proctor", "1980-01-01", "p.jpg", "TA"));
+        if (checkIn) exam->checkInBatch(ids, std::chrono::system_clock::now());
+        return exam;
+    }
+};
+
+/**
+ * @brief Rewrites one student's seat in a snapshot image.
+ *
+ * The image keeps valid checksums, so a seat that clashes with another
+ * student or a reserved seat makes loading fail part-way rather than up front.
+ *
+ * @param image A snapshot from ExamSnapshot::capture().
+ * @param moved A seated student from the captured exam.
+ * @param row The seat row to record for them.
+ * @param col The seat column to record for them.
+ * @return The damaged image, or an empty string if the student's record was not found.
+ */
+inline std::string snapshotWithMovedSeat(const std::string &image, const Student &moved, int row, int col) {
+    const std::size_t headerSize = 64, bodyCrcOffset = 56, headerCrcOffset = 60;
+    std::string record, seat;
+    putLE<std::int32_t>(record, moved.getID());
+    putLE<std::int32_t>(record, moved.getSeatRow());
+    putLE<std::int32_t>(record, moved.getSeatCol());
+    putLE<std::int32_t>(seat, row);
+    putLE<std::int32_t>(seat, col);
+
+    std::size_t at = image.find(record, headerSize);
+    if (at == std::string::npos) return std::string();
+    std::string damaged = image;
+    damaged.replace(at + 4, seat.size(), seat);
+
+    std::string crc;
+    putLE<std::uint32_t>(crc, crc32(damaged.data() + headerSize, damaged.size() - headerSize));
+    damaged.replace(bodyCrcOffset, 4, crc);
+    crc.clear();
+    putLE<std::uint32_t>(crc, crc32(damaged.data(), headerCrcOffset));
+    damaged.replace(headerCrcOffset, 4, crc);
+    return damaged;
+}
+
+#endif // TESTROSTER_H
@@ -0,0 +1,98 @@
+/**
+ * @file bench_RosterScan.cpp
+ * @brief Benchmark comparing summary scans over Student objects and RosterColumns.
+ *
+ * Builds a 100,000 student roster, then times the totals used by the report
+ * (present, submitted, breaks) computed by walking the Student objects and by
+ * scanning the columnar mirror. Not part of the unit test run.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-16
+ */
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+#include "RosterColumns.h"
+#include "Student.h"
+
+namespace {
+    const int NUM_STUDENTS = 100000;
+    const int ROUNDS = 50;
+
+    struct Totals {
+        int present = 0;
+        int submitted = 0;
+        int breaks = 0;
+    };
+
+    Totals scanStudents(const std::vector<Student> &students) {
+        Totals t;
+        for (const Student &s : students) {
+            t.present += s.getAttendance();
+            t.submitted += s.getSubmissionStatus();
+            t.breaks += static_cast<int>(s.getBreakCount());
+        }
+        return t;
+    }
+
+    Totals scanColumns(const RosterColumns &columns) {
+        Totals t;
+        t.present = columns.countAttended();
+        t.submitted = columns.countSubmitted();
+        t.breaks = columns.countBreaks();
+        return t;
+    }
+
+    template <typename Scan>
+    double timeScan(Scan scan, Totals &result) {
+        auto start = std::chrono::steady_clock::now();
+        for (int round = 0; round < ROUNDS; ++round) {
+            result = scan();
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::micro>(elapsed).count() / ROUNDS;
+    }
+}
+
+int main() {
+    std::vector<Student> students;
+    students.reserve(NUM_STUDENTS);
+    for (int i = 0; i < NUM_STUDENTS; ++i) {
+        Student s(250000000 + i, "Student " + std::to_string(i), "2003-01-01",
+                  "/home/exam/photos/" + std::to_string(i) + ".png");
+        if (i % 10 != 0) {
+            s.setAttendance(true);
+            s.setSeat(i / 100, i % 100);
+            s.setExamVersion(100 + i % 4);
+        }
+        if (i % 5 == 0) {
+            s.leaveForBreak();
+            s.returnFromBreak();
+        }
+        if (i % 2 == 0) s.submitExam();
+        students.push_back(s);
+    }
+
+    RosterColumns columns;
+    columns.assign(students);
+
+    Totals objectTotals, columnTotals;
+    double objectUs = timeScan([&] { return scanStudents(students); }, objectTotals);
+    double columnUs = timeScan([&] { return scanColumns(columns); }, columnTotals);
+
+    std::cout << "Roster size: " << NUM_STUDENTS << " students\n"
+              << "Student objects: " << objectUs << " us per summary scan\n"
+              << "Roster columns:  " << columnUs << " us per summary scan\n"
+              << "Speedup:         " << (columnUs > 0 ? objectUs / columnUs : 0) << "x\n";
+
+    bool match = objectTotals.present == columnTotals.present &&
+                 objectTotals.submitted == columnTotals.submitted &&
+                 objectTotals.breaks == columnTotals.breaks;
+    if (!match) {
+        std::cerr << "Totals differ between the two layouts\n";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,181 @@
+/**
+ * @file bench_StudentLayout.cpp
+ * @brief Benchmark comparing the memory and scan time of the old and packed Student layouts.
+ *
+ * Builds a 100,000 student roster twice: once with a record laid out the way
+ * Student used to be (four owned strings, two bools, int seat and version
+ * fields and a full time_point) and once with the packed Student, whose text
+ * sits in the exam's string pool and whose breaks sit in the exam's break
+ * log. Reports the bytes per student, heap included, and the time of a full
+ * scan that reads every lifecycle field. Not part of the unit test run.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Break.h"
+#include "BreakLog.h"
+#include "Student.h"
+#include "StringPool.h"
+
+namespace {
+    const int NUM_STUDENTS = 100000;
+    const int ROUNDS = 50;
+
+    // Student as it was laid out before its text moved to a pool and its fields were packed
+    struct LegacyStudent {
+        int ID;
+        std::string name;
+        std::string DOB;
+        std::string picURL;
+        std::string seatNum;
+        int seatRow;
+        int seatCol;
+        int examVersion;
+        int extraMinutes;
+        bool isAttend;
+        bool isSubmit;
+        std::vector<Break> breaks;
+        std::chrono::system_clock::time_point submissionTime;
+    };
+
+    struct Totals {
+        int present = 0;
+        int submitted = 0;
+        int submittedEarly = 0;
+        int seated = 0;
+        int extraTime = 0;
+        int breaks = 0;
+        long long versions = 0;
+    };
+
+    // Heap bytes behind a string, zero when it fits in the short string buffer
+    std::size_t heapBytes(const std::string &s) {
+        return s.capacity() > std::string().capacity() ? s.capacity() + 1 : 0;
+    }
+
+    Totals scanLegacy(const std::vector<LegacyStudent> &students, std::chrono::system_clock::time_point end) {
+        Totals t;
+        for (const LegacyStudent &s : students) {
+            t.present += s.isAttend;
+            t.submitted += s.isSubmit;
+            t.submittedEarly += s.isSubmit && s.submissionTime < end;
+            t.seated += s.seatRow >= 0;
+            t.extraTime += s.extraMinutes > 0;
+            t.breaks += static_cast<int>(s.breaks.size());
+            t.versions += s.examVersion;
+        }
+        return t;
+    }
+
+    Totals scanPacked(const std::vector<Student> &students, std::chrono::system_clock::time_point end) {
+        Totals t;
+        for (const Student &s : students) {
+            t.present += s.getAttendance();
+            t.submitted += s.getSubmissionStatus();
+            t.submittedEarly += s.getSubmissionStatus() && s.getSubmissionTimePoint() < end;
+            t.seated += s.hasSeat();
+            t.extraTime += s.getExtraTime().count() > 0;
+            t.breaks += static_cast<int>(s.getBreakCount());
+            t.versions += s.getExamVersion();
+        }
+        return t;
+    }
+
+    template <typename Scan>
+    double timeScan(Scan scan, Totals &result) {
+        auto start = std::chrono::steady_clock::now();
+        for (int round = 0; round < ROUNDS; ++round) {
+            result = scan();
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::micro>(elapsed).count() / ROUNDS;
+    }
+}
+
+int main() {
+    auto start = std::chrono::system_clock::now();
+    auto end = start + std::chrono::hours(3);
+    auto pool = std::make_shared<StringPool>();
+    auto breakLog = std::make_shared<BreakLog>();
+
+    std::vector<LegacyStudent> legacy;
+    std::vector<Student> packed;
+    legacy.reserve(NUM_STUDENTS);
+    packed.reserve(NUM_STUDENTS);
+    for (int i = 0; i < NUM_STUDENTS; ++i) {
+        std::string name = "Student Number " + std::to_string(i);
+        std::string dob = "200" + std::to_string(i % 5) + "-0" + std::to_string(1 + i % 9) + "-1" + std::to_string(i % 10);
+        std::string pic = "/home/exam/photos/" + std::to_string(250000000 + i) + ".png";
+        LegacyStudent l{250000000 + i, name, dob, pic, "", -1, -1, 0, 0, false, false, {}, {}};
+        Student s(250000000 + i, name, dob, pic, pool);
+        s.useBreakLog(breakLog);
+        if (i % 10 != 0) {
+            l.isAttend = true;
+            l.seatRow = i / 100;
+            l.seatCol = i % 100;
+            l.seatNum = "Row: " + std::to_string(l.seatRow + 1) + "\nColum: " + std::to_string(l.seatCol + 1);
+            l.examVersion = 100 + i % 4;
+            s.setAttendance(true);
+            s.setSeat(i / 100, i % 100);
+            s.setExamVersion(100 + i % 4);
+        }
+        if (i % 20 == 0) {
+            l.extraMinutes = 30;
+            s.setExtraTime(std::chrono::minutes(30));
+        }
+        if (i % 5 == 0) {
+            l.breaks.push_back(Break(start + std::chrono::minutes(30)));
+            l.breaks.back().endBreak(start + std::chrono::minutes(35));
+            s.leaveForBreak(start + std::chrono::minutes(30));
+            s.returnFromBreak(start + std::chrono::minutes(35));
+        }
+        if (i % 2 == 0) {
+            auto at = start + std::chrono::minutes(60 + i % 150);
+            l.isSubmit = true;
+            l.submissionTime = at;
+            s.submitExam(at);
+        }
+        legacy.push_back(std::move(l));
+        packed.push_back(std::move(s));
+    }
+
+    std::size_t legacyBytes = sizeof(LegacyStudent) * legacy.size();
+    for (const LegacyStudent &l : legacy) {
+        legacyBytes += heapBytes(l.name) + heapBytes(l.DOB) + heapBytes(l.picURL) + heapBytes(l.seatNum) +
+                       l.breaks.capacity() * sizeof(Break);
+    }
+    std::size_t packedBytes = sizeof(Student) * packed.size() + pool->getByteCount() +
+                              breakLog->size() * sizeof(BreakRecord);
+
+    Totals legacyTotals, packedTotals;
+    double legacyUs = timeScan([&] { return scanLegacy(legacy, end); }, legacyTotals);
+    double packedUs = timeScan([&] { return scanPacked(packed, end); }, packedTotals);
+
+    std::cout << "Roster size: " << NUM_STUDENTS << " students\n"
+              << "Old layout:    " << sizeof(LegacyStudent) << " bytes per record, "
+              << legacyBytes / NUM_STUDENTS << " bytes per student with heap, " << legacyUs << " us per scan\n"
+              << "Packed layout: " << sizeof(Student) << " bytes per record, "
+              << packedBytes / NUM_STUDENTS << " bytes per student with pool and break log, " << packedUs << " us per scan\n"
+              << "Speedup:       " << (packedUs > 0 ? legacyUs / packedUs : 0) << "x\n";
+
+    bool match = legacyTotals.present == packedTotals.present &&
+                 legacyTotals.submitted == packedTotals.submitted &&
+                 legacyTotals.submittedEarly == packedTotals.submittedEarly &&
+                 legacyTotals.seated == packedTotals.seated &&
+                 legacyTotals.extraTime == packedTotals.extraTime &&
+                 legacyTotals.breaks == packedTotals.breaks &&
+                 legacyTotals.versions == packedTotals.versions;
+    if (!match) {
+        std::cerr << "Totals differ between the two layouts\n";
+        return 1;
+    }
+    return 0;
+}
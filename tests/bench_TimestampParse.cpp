@@ -0,0 +1,86 @@
+/**
+ * @file bench_TimestampParse.cpp
+ * @brief Benchmark comparing the stream-based and hand-written ISO 8601 parsers.
+ *
+ * Parses 200,000 local timestamps spread over an exam day, first with the
+ * parser stringToTimePoint used to have (an istringstream, std::get_time and
+ * std::mktime per call) and then with parseIsoTimestamp. Also times
+ * timestamps that carry a UTC offset, which the old parser could not read.
+ * Not part of the unit test run.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include <chrono>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "Utils.h"
+
+namespace {
+    const int NUM_TIMESTAMPS = 200000;
+
+    // stringToTimePoint as it was before the hand-written parser
+    std::chrono::system_clock::time_point streamParse(const std::string &isoString) {
+        std::tm t = {};
+        std::istringstream ss(isoString);
+        ss >> std::get_time(&t, "%Y-%m-%dT%H:%M:%S");
+        if (ss.fail()) {
+            throw std::runtime_error("Failed to parse time: " + isoString);
+        }
+        std::time_t time_c = std::mktime(&t);
+        return std::chrono::system_clock::from_time_t(time_c);
+    }
+
+    template <typename Parse>
+    double timeParse(const std::vector<std::string> &texts, Parse parse, long long &checksum) {
+        auto start = std::chrono::steady_clock::now();
+        for (const std::string &text : texts) {
+            checksum += std::chrono::duration_cast<std::chrono::seconds>(parse(text).time_since_epoch()).count();
+        }
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::nano>(elapsed).count() / texts.size();
+    }
+}
+
+int main() {
+    // A winter exam day, so the old parser's standard-time assumption does not skew the checksum
+    auto day = std::chrono::system_clock::from_time_t(1768489200);   // 2026-01-15 15:00 UTC
+    std::vector<std::string> local, offset;
+    local.reserve(NUM_TIMESTAMPS);
+    offset.reserve(NUM_TIMESTAMPS);
+    char stamp[TIMESTAMP_TEXT_SIZE];
+    for (int i = 0; i < NUM_TIMESTAMPS; ++i) {
+        auto tp = day + std::chrono::seconds(i % 10800);
+        local.emplace_back(stamp, formatTimestamp(tp, stamp, 'T'));
+        std::time_t t = std::chrono::system_clock::to_time_t(tp);
+        char utc[32];
+        std::tm tm{};
+        gmtime_r(&t, &tm);
+        std::strftime(utc, sizeof(utc), "%Y-%m-%dT%H:%M:%S.250+00:00", &tm);
+        offset.emplace_back(utc);
+    }
+
+    long long streamSum = 0, handSum = 0, offsetSum = 0;
+    double streamNs = timeParse(local, streamParse, streamSum);
+    double handNs = timeParse(local, stringToTimePoint, handSum);
+    double offsetNs = timeParse(offset, stringToTimePoint, offsetSum);
+
+    std::cout << "Timestamps: " << NUM_TIMESTAMPS << "\n"
+              << "get_time and mktime: " << streamNs << " ns per local timestamp\n"
+              << "parseIsoTimestamp:   " << handNs << " ns per local timestamp\n"
+              << "parseIsoTimestamp:   " << offsetNs << " ns per timestamp with a UTC offset\n"
+              << "Speedup:             " << (handNs > 0 ? streamNs / handNs : 0) << "x\n";
+
+    if (streamSum != handSum || handSum != offsetSum) {
+        std::cerr << "The parsers disagree\n";
+        return 1;
+    }
+    return 0;
+}
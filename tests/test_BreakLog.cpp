@@ -0,0 +1,101 @@
+/**
+ * @file BreakLogTest.cpp
+ * @brief Unit tests for the BreakLog and BreakView classes and the breaks of an exam.
+ *
+ * This file contains Google Test cases for the exam-wide break log, verifying
+ * that breaks are appended in the order they start and linked per student,
+ * that a student's view lists only their breaks in the order they were taken,
+ * that breaks taken before joining an exam move into its log, and that every
+ * student of an exam records breaks in the one log.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include "BreakLog.h"
+#include "Exam.h"
+
+using std::chrono::minutes;
+
+// Test case: Breaks are appended in start order and each student's breaks are linked
+TEST(BreakLogTest, LinksBreaksPerStudent) {
+    BreakLog log;
+    auto t = std::chrono::system_clock::now();
+    std::uint32_t a1 = log.start(1, t, BreakLog::NONE);
+    std::uint32_t b1 = log.start(2, t + minutes(1), BreakLog::NONE);
+    log.end(a1, t + minutes(5));
+    std::uint32_t a2 = log.start(1, t + minutes(10), a1);
+
+    EXPECT_EQ(log.size(), 3u);
+    EXPECT_EQ(log.record(a1).next, a2);
+    EXPECT_EQ(log.record(b1).next, BreakLog::NONE);
+    EXPECT_TRUE(log.record(a1).span.hasEnded());
+    EXPECT_FALSE(log.record(a2).span.hasEnded());
+
+    BreakView view(&log, a1, a2, 2);
+    std::vector<std::chrono::system_clock::time_point> starts;
+    for (const Break &b : view) starts.push_back(b.getStartTimePoint());
+    EXPECT_EQ(starts, (std::vector<std::chrono::system_clock::time_point>{t, t + minutes(10)}));
+    EXPECT_EQ(view.front().getStartTimePoint(), t);
+    EXPECT_EQ(view.back().getStartTimePoint(), t + minutes(10));
+    EXPECT_TRUE(BreakView().empty());
+    EXPECT_EQ(BreakView().begin(), BreakView().end());
+
+    std::vector<int> order;
+    log.forEach([&](const BreakRecord &r) { order.push_back(r.studentID); });
+    EXPECT_EQ(order, (std::vector<int>{1, 2, 1}));
+}
+
+// Test case: Breaks taken before joining an exam move into the exam's log
+TEST(BreakLogTest, StudentJoinsExamLog) {
+    auto t = std::chrono::system_clock::now();
+    Student student(7, "Student", "2002-01-01", "pic.jpg");
+    student.leaveForBreak(t);
+    student.returnFromBreak(t + minutes(4));
+    student.leaveForBreak(t + minutes(20));
+    ASSERT_EQ(student.getBreakCount(), 2u);
+
+    auto log = std::make_shared<BreakLog>();
+    log->start(99, t, BreakLog::NONE);   // Someone else's break first
+    student.useBreakLog(log);
+
+    EXPECT_EQ(log->size(), 3u);
+    BreakView breaks = student.getBreaksList();
+    ASSERT_EQ(breaks.size(), 2u);
+    EXPECT_EQ(breaks.front().getEndTimePoint(), t + minutes(4));
+    EXPECT_FALSE(breaks.back().hasEnded());
+
+    student.returnFromBreak(t + minutes(25));
+    EXPECT_EQ(log->record(2).span.getEndTimePoint(), t + minutes(25));
+}
+
+// Test case: Every student of an exam records breaks in the exam's one log
+TEST(BreakLogTest, ExamKeepsOneLog) {
+    auto now = std::chrono::system_clock::now();
+    Exam exam;
+    exam.setStartTime(now - std::chrono::hours(2));
+    exam.setEndTime(now + std::chrono::hours(1));
+    exam.setMaxRow(5);
+    exam.setMaxCol(5);
+    exam.initializeSeatMap();
+    for (int id = 1; id <= 10; ++id) exam.addStudent(Student(id, "Student", "2002-01-01", "pic.jpg"));
+    for (int id = 1; id <= 10; ++id) exam.checkIn(id);
+
+    for (int id = 1; id <= 10; id += 2) exam.toggleBreak(id, now);
+    for (int id = 1; id <= 10; id += 2) exam.toggleBreak(id, now + minutes(5));
+    exam.toggleBreak(3, now + minutes(10));
+
+    EXPECT_EQ(exam.getBreakLog()->size(), 6u);
+    EXPECT_EQ(exam.countBreaks(), 6);
+    EXPECT_EQ(exam.getStudentByID(3)->getBreaksList().size(), 2u);
+    // Exam events keep microseconds
+    EXPECT_EQ(exam.getStudentByID(3)->getBreaksList().back().getStartTimePoint(),
+              std::chrono::time_point_cast<std::chrono::microseconds>(now + minutes(10)));
+    EXPECT_TRUE(exam.getStudentByID(2)->getBreaksList().empty());
+    EXPECT_NE(exam.describeBreak(3, BatchStatus::BreakStarted, now).find("Leaving for break"), std::string::npos);
+}
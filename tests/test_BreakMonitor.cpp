@@ -0,0 +1,250 @@
+/**
+ * @file BreakMonitorTest.cpp
+ * @brief Unit tests for the BreakMonitor class.
+ *
+ * This file contains Google Test cases for overdue break alerts, verifying
+ * that a break arms one timer and raises an alert only after the limit, that
+ * students who return in time raise none, that breaks still open when time is
+ * up or when the student hands in early end as the student is submitted,
+ * that breaks already in progress are armed when an exam is first watched,
+ * even while a station is toggling breaks, that unwatching disarms every
+ * timer, and that many breaks across several exams are tracked independently.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "BreakMonitor.h"
+#include "TestRoster.h"
+
+using std::chrono::hours;
+using std::chrono::minutes;
+using std::chrono::seconds;
+
+// Test fixture for BreakMonitor class
+class BreakMonitorTest : public ::testing::Test {
+protected:
+    TimerWheel::Clock::time_point origin;
+    std::unique_ptr<TimerWheel> wheel;
+    std::vector<BreakAlert> alerts;
+
+    void SetUp() override {
+        origin = TimerWheel::Clock::now();
+        wheel = std::make_unique<TimerWheel>(seconds(1), origin);
+    }
+
+    // An exam two hours in, so breaks are allowed, with every student checked in
+    static std::unique_ptr<Exam> runningExam(int numStudents, int firstID = 1) {
+        return RosterBuilder().students(numStudents, firstID).seats(20, 20)
+            .schedule(std::chrono::system_clock::now() - hours(2), hours(3)).checkedIn().build();
+    }
+
+    void listen(BreakMonitor &monitor) {
+        monitor.addAlertHandler([this](const BreakAlert &alert) { alerts.push_back(alert); });
+    }
+};
+
+// Test case: A break raises one alert once it passes the limit, and returning clears it
+TEST_F(BreakMonitorTest, AlertsAfterLimit) {
+    auto exam = runningExam(3);
+    BreakMonitor monitor(*wheel, minutes(10));
+    listen(monitor);
+    monitor.watch("CS3307-MC110", *exam);
+
+    exam->washroomBreak(1);
+    EXPECT_EQ(monitor.getArmedCount(), 1u);
+    wheel->advance(origin + minutes(9));
+    EXPECT_TRUE(alerts.empty()) << "Alert raised before the limit";
+
+    wheel->advance(origin + minutes(11));
+    ASSERT_EQ(alerts.size(), 1u);
+    EXPECT_EQ(alerts[0].examKey, "CS3307-MC110");
+    EXPECT_EQ(alerts[0].studentID, 1);
+    EXPECT_EQ(alerts[0].limit, minutes(10));
+    EXPECT_EQ(monitor.getArmedCount(), 0u);
+    ASSERT_EQ(monitor.getOverdue().size(), 1u);
+    EXPECT_EQ(monitor.getOverdue()[0].studentID, 1);
+
+    // Returning late clears the overdue list without raising anything more
+    exam->washroomBreak(1);
+    EXPECT_TRUE(monitor.getOverdue().empty());
+    wheel->advance(origin + hours(1));
+    EXPECT_EQ(alerts.size(), 1u);
+}
+
+// Test case: Students who return within the limit raise no alert
+TEST_F(BreakMonitorTest, ReturnInTimeRaisesNothing) {
+    auto exam = runningExam(3);
+    BreakMonitor monitor(*wheel, minutes(10));
+    listen(monitor);
+    monitor.watch("CS3307-MC110", *exam);
+
+    exam->washroomBreak(2);
+    exam->washroomBreak(3);
+    EXPECT_EQ(monitor.getArmedCount(), 2u);
+    exam->washroomBreak(2);
+    exam->washroomBreak(3);
+    EXPECT_EQ(monitor.getArmedCount(), 0u);
+    EXPECT_EQ(wheel->size(), 0u) << "Returning must cancel the timer";
+
+    wheel->advance(origin + hours(1));
+    EXPECT_TRUE(alerts.empty());
+    EXPECT_TRUE(monitor.getOverdue().empty());
+}
+
+// Test case: Students still out when time is up are brought back as they are submitted
+TEST_F(BreakMonitorTest, DeadlineEndsOpenBreaks) {
+    auto exam = runningExam(3);
+    BreakMonitor monitor(*wheel, minutes(10));
+    listen(monitor);
+    monitor.watch("CS3307-MC110", *exam);
+
+    exam->washroomBreak(1);
+    exam->washroomBreak(2);
+    EXPECT_EQ(monitor.getArmedCount(), 2u);
+    EXPECT_EQ(exam->submitDue(exam->getEndTime()), 3u);
+    EXPECT_FALSE(exam->submitAtDeadline(1)) << "Already submitted";
+
+    EXPECT_EQ(exam->getStats().onBreak, 0);
+    EXPECT_EQ(exam->getStats().submitted, 3);
+    EXPECT_TRUE(exam->getStudentsOnBreak().empty());
+    for (int id : {1, 2}) {
+        Student *s = exam->getStudentByID(id);
+        Break last = *s->getBreaksList().begin();
+        ASSERT_TRUE(last.hasEnded()) << "Student " << id;
+        EXPECT_EQ(last.getEndTimePoint(), s->getSubmissionTimePoint());
+    }
+    EXPECT_EQ(monitor.getArmedCount(), 0u);
+    wheel->advance(origin + hours(1));
+    EXPECT_TRUE(alerts.empty());
+    EXPECT_TRUE(monitor.getOverdue().empty());
+}
+
+// Test case: A student on a break at their own deadline is brought back too
+TEST_F(BreakMonitorTest, OwnDeadlineEndsOpenBreak) {
+    auto exam = runningExam(2);
+    BreakMonitor monitor(*wheel, minutes(10));
+    listen(monitor);
+    monitor.watch("CS3307-MC110", *exam);
+
+    exam->washroomBreak(2);
+    EXPECT_TRUE(exam->submitAtDeadline(2));
+    EXPECT_FALSE(exam->isOnBreak(2));
+    EXPECT_EQ(exam->getStats().onBreak, 0);
+    EXPECT_EQ(monitor.getArmedCount(), 0u);
+    wheel->advance(origin + hours(1));
+    EXPECT_TRUE(alerts.empty());
+}
+
+// Test case: A student who hands in early while out on a break is brought back, alone or in a batch
+TEST_F(BreakMonitorTest, EarlySubmissionEndsOpenBreak) {
+    auto exam = runningExam(3);
+    BreakMonitor monitor(*wheel, minutes(10));
+    listen(monitor);
+    monitor.watch("CS3307-MC110", *exam);
+
+    exam->washroomBreak(1);
+    exam->washroomBreak(2);
+    EXPECT_EQ(monitor.getArmedCount(), 2u);
+    EXPECT_TRUE(exam->earlySubmission(1));
+    auto results = exam->submitBatch({2}, std::chrono::system_clock::now());
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_EQ(results[0].status, BatchStatus::Submitted);
+
+    EXPECT_EQ(exam->getStats().onBreak, 0);
+    EXPECT_EQ(exam->getStats().submitted, 2);
+    for (int id : {1, 2}) {
+        EXPECT_FALSE(exam->isOnBreak(id)) << "Student " << id;
+        Student *s = exam->getStudentByID(id);
+        ASSERT_TRUE(s->getBreaksList().begin()->hasEnded()) << "Student " << id;
+    }
+    EXPECT_EQ(monitor.getArmedCount(), 0u);
+    wheel->advance(origin + minutes(11));
+    EXPECT_TRUE(alerts.empty());
+    EXPECT_TRUE(monitor.getOverdue().empty());
+}
+
+// Test case: Breaks in progress when an exam is watched are armed, and unwatching disarms them
+TEST_F(BreakMonitorTest, RecoveredBreaksAndUnwatch) {
+    auto exam = runningExam(3);
+    exam->washroomBreak(1);
+    exam->washroomBreak(2);
+
+    BreakMonitor monitor(*wheel, minutes(10));
+    listen(monitor);
+    monitor.watch("CS3307-MC110", *exam);
+    EXPECT_EQ(monitor.getArmedCount(), 2u);
+    wheel->advance(origin + minutes(11));
+    EXPECT_EQ(alerts.size(), 2u);
+
+    exam->washroomBreak(3);
+    monitor.unwatch("CS3307-MC110");
+    EXPECT_EQ(monitor.getArmedCount(), 0u);
+    EXPECT_EQ(wheel->size(), 0u);
+    EXPECT_TRUE(monitor.getOverdue().empty());
+
+    // The exam is no longer listened to
+    exam->washroomBreak(3);
+    exam->washroomBreak(3);
+    wheel->advance(origin + hours(1));
+    EXPECT_EQ(alerts.size(), 2u);
+    EXPECT_EQ(wheel->size(), 0u);
+}
+
+// Test case: Watching an exam while a station toggles breaks misses none of them
+TEST_F(BreakMonitorTest, WatchWhileStationsRun) {
+    auto exam = runningExam(200);
+    BreakMonitor monitor(*wheel, minutes(10));
+
+    std::atomic<bool> stop{false};
+    std::thread station([&] {
+        for (int round = 0; !stop; ++round) {
+            for (int id = 1; id <= 200; ++id) exam->toggleBreak(id, std::chrono::system_clock::now());
+        }
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    monitor.watch("CS3307-MC110", *exam);
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    stop = true;
+    station.join();
+
+    EXPECT_EQ(monitor.getArmedCount(), static_cast<std::size_t>(exam->getStats().onBreak))
+        << "Every break in progress has exactly one timer";
+}
+
+// Test case: Many breaks across several exams, with the limit changed part way
+TEST_F(BreakMonitorTest, ManyBreaksAcrossExams) {
+    auto first = runningExam(300);
+    auto second = runningExam(300, 1001);
+    BreakMonitor monitor(*wheel, minutes(10));
+    listen(monitor);
+    monitor.watch("CS3307-MC110", *first);
+    monitor.watch("CS3307-MC105", *second);
+
+    for (int id = 1; id <= 300; ++id) first->washroomBreak(id);
+    monitor.setLimit(minutes(30));
+    for (int id = 1001; id <= 1300; ++id) second->washroomBreak(id);
+    EXPECT_EQ(monitor.getArmedCount(), 600u);
+
+    // Half of each room comes back in time
+    for (int id = 1; id <= 300; id += 2) first->washroomBreak(id);
+    for (int id = 1001; id <= 1300; id += 2) second->washroomBreak(id);
+    EXPECT_EQ(monitor.getArmedCount(), 300u);
+
+    // Only the first room uses the old limit
+    wheel->advance(origin + minutes(11));
+    EXPECT_EQ(alerts.size(), 150u);
+    for (const BreakAlert &alert : alerts) EXPECT_EQ(alert.examKey, "CS3307-MC110");
+
+    wheel->advance(origin + minutes(31));
+    EXPECT_EQ(alerts.size(), 300u);
+    EXPECT_EQ(monitor.getOverdue().size(), 300u);
+    EXPECT_EQ(monitor.getArmedCount(), 0u);
+}
@@ -0,0 +1,154 @@
+/**
+ * @file CommandQueueTest.cpp
+ * @brief Unit tests for the CommandQueue class.
+ *
+ * This file contains Google Test cases for the CommandQueue class, verifying
+ * FIFO order, backpressure when full, the depth statistics, stamping of
+ * commands pushed without a receive time and that commands from several
+ * producer threads all arrive exactly once and in order.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include "CommandQueue.h"
+
+namespace {
+ExamCommand makeCommand(ExamCommandType type, int studentID) {
+    ExamCommand c;
+    c.type = type;
+    c.studentID = studentID;
+    c.at = std::chrono::system_clock::now();
+    return c;
+}
+}
+
+// Test fixture for CommandQueue class
+class CommandQueueTest : public ::testing::Test {
+protected:
+    CommandQueue queue{8};
+    std::vector<ExamCommand> out;
+};
+
+// Test case: Commands come out in the order they went in
+TEST_F(CommandQueueTest, PopsInFifoOrder) {
+    ASSERT_TRUE(queue.tryPush(makeCommand(ExamCommandType::CheckIn, 1)));
+    ASSERT_TRUE(queue.tryPush(makeCommand(ExamCommandType::ToggleBreak, 2)));
+    ExamCommand incident = makeCommand(ExamCommandType::Incident, 3);
+    incident.proctorID = 9;
+    incident.message = "Phone on desk";
+    ASSERT_TRUE(queue.tryPush(incident));
+
+    EXPECT_EQ(queue.depth(), 3u);
+    EXPECT_EQ(queue.popBatch(out, 10), 3u);
+    ASSERT_EQ(out.size(), 3u);
+    EXPECT_EQ(out[0].studentID, 1);
+    EXPECT_EQ(out[1].type, ExamCommandType::ToggleBreak);
+    EXPECT_EQ(out[2].message, "Phone on desk");
+    EXPECT_EQ(out[2].proctorID, 9);
+    EXPECT_EQ(queue.depth(), 0u);
+}
+
+// Test case: A full queue refuses commands and counts them
+TEST_F(CommandQueueTest, FullQueueAppliesBackpressure) {
+    EXPECT_EQ(queue.capacity(), 8u);
+    for (int i = 0; i < 8; ++i) {
+        ASSERT_TRUE(queue.tryPush(makeCommand(ExamCommandType::Submit, i)));
+    }
+    EXPECT_FALSE(queue.tryPush(makeCommand(ExamCommandType::Submit, 8)));
+    EXPECT_EQ(queue.getRejectedCount(), 1u);
+    EXPECT_EQ(queue.getHighWater(), 8u);
+
+    EXPECT_EQ(queue.popBatch(out, 3), 3u) << "popBatch takes at most maxCount commands";
+    EXPECT_TRUE(queue.tryPush(makeCommand(ExamCommandType::Submit, 9)));
+    EXPECT_EQ(queue.depth(), 6u);
+    EXPECT_EQ(queue.getPushedCount(), 9u);
+}
+
+// Test case: A command pushed without a receive time is stamped, not left at the epoch
+TEST_F(CommandQueueTest, StampsUnsetReceiveTime) {
+    ExamCommand unset;
+    unset.studentID = 1;
+    auto before = std::chrono::system_clock::now();
+    ASSERT_TRUE(queue.tryPush(unset));
+    ExamCommand stamped = makeCommand(ExamCommandType::CheckIn, 2);
+    stamped.at = before - std::chrono::minutes(5);
+    ASSERT_TRUE(queue.tryPush(stamped));
+
+    ASSERT_EQ(queue.popBatch(out, 10), 2u);
+    EXPECT_GE(out[0].at, before);
+    EXPECT_LE(out[0].at, std::chrono::system_clock::now());
+    EXPECT_EQ(out[1].at, stamped.at) << "A time set by the station is kept";
+}
+
+// Test case: Capacity is rounded up to a power of two
+TEST(CommandQueueCapacityTest, RoundsUpToPowerOfTwo) {
+    CommandQueue queue(1000);
+    EXPECT_EQ(queue.capacity(), 1024u);
+}
+
+// Test case: Waiting on an empty queue times out; a push or wake() ends the wait
+TEST_F(CommandQueueTest, WaitEndsOnPushOrWake) {
+    EXPECT_FALSE(queue.waitForCommands(std::chrono::milliseconds(1)));
+
+    std::thread producer([this] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        queue.tryPush(makeCommand(ExamCommandType::CheckIn, 42));
+    });
+    EXPECT_TRUE(queue.waitForCommands(std::chrono::seconds(10)));
+    producer.join();
+
+    queue.popBatch(out, 10);
+    std::thread waker([this] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        queue.wake();
+    });
+    auto before = std::chrono::steady_clock::now();
+    EXPECT_FALSE(queue.waitForCommands(std::chrono::seconds(10)));
+    EXPECT_LT(std::chrono::steady_clock::now() - before, std::chrono::seconds(5));
+    waker.join();
+}
+
+// Test case: Four producers and one consumer; nothing is lost, duplicated or reordered per producer
+TEST(CommandQueueStressTest, ManyProducersOneConsumer) {
+    const int producers = 4;
+    const int perProducer = 50000;
+    CommandQueue queue(256);
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; ++p) {
+        threads.emplace_back([&queue, p] {
+            for (int i = 0; i < perProducer; ++i) {
+                // Encode producer and sequence in the ID; spin while the consumer catches up
+                ExamCommand c = makeCommand(ExamCommandType::CheckIn, p * perProducer + i);
+                while (!queue.tryPush(c)) std::this_thread::yield();
+            }
+        });
+    }
+
+    std::vector<int> nextExpected(producers, 0);
+    std::vector<ExamCommand> out;
+    int received = 0;
+    while (received < producers * perProducer) {
+        out.clear();
+        if (queue.popBatch(out, 64) == 0) {
+            queue.waitForCommands(std::chrono::milliseconds(1));
+            continue;
+        }
+        for (const ExamCommand &c : out) {
+            int p = c.studentID / perProducer;
+            ASSERT_EQ(c.studentID % perProducer, nextExpected[p]) << "Producer " << p << " out of order";
+            nextExpected[p]++;
+        }
+        received += static_cast<int>(out.size());
+    }
+    for (std::thread &t : threads) t.join();
+
+    EXPECT_EQ(queue.depth(), 0u);
+    EXPECT_EQ(queue.getPushedCount(), static_cast<std::uint64_t>(producers * perProducer));
+    EXPECT_LE(queue.getHighWater(), queue.capacity());
+}
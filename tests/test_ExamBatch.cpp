@@ -0,0 +1,176 @@
+/**
+ * @file ExamBatchTest.cpp
+ * @brief Unit tests for the batch entry points of the Exam class.
+ *
+ * This file contains Google Test cases for checkInBatch, toggleBreakBatch and
+ * submitBatch, verifying that every ID gets its own result in the order given:
+ * unknown IDs, IDs repeated in one batch, students who cannot take the action,
+ * and students left without a seat when the room fills part-way through. The
+ * per-ID time overloads are checked to record each ID at its own time, and a
+ * batch of breaks is checked to reach the event log in one unbroken run while
+ * another station is toggling breaks.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <set>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "TestRoster.h"
+
+namespace {
+std::vector<BatchStatus> statuses(const std::vector<BatchResult> &results) {
+    std::vector<BatchStatus> out;
+    for (const BatchResult &r : results) out.push_back(r.status);
+    return out;
+}
+
+std::vector<int> ids(const std::vector<BatchResult> &results) {
+    std::vector<int> out;
+    for (const BatchResult &r : results) out.push_back(r.studentID);
+    return out;
+}
+}
+
+// Test case: A repeated ID is checked in once and its spare seat is handed back
+TEST(ExamBatchTest, CheckInReportsEveryID) {
+    auto exam = RosterBuilder().students(8).seats(2, 3).build();
+    auto now = std::chrono::system_clock::now();
+
+    std::vector<BatchResult> results = exam->checkInBatch({1, 99, 1, 2}, now);
+    EXPECT_EQ(ids(results), (std::vector<int>{1, 99, 1, 2}));
+    EXPECT_EQ(statuses(results), (std::vector<BatchStatus>{BatchStatus::CheckedIn, BatchStatus::NotFound,
+                                                           BatchStatus::AlreadyDone, BatchStatus::CheckedIn}));
+    EXPECT_EQ(exam->getStats().checkedIn, 2);
+    EXPECT_EQ(exam->getSeatAllocator().getFreeCount(), 4) << "The duplicate's seat was not released";
+
+    // The room fills after four more; the last student is left standing
+    results = exam->checkInBatch({1, 3, 4, 5, 6, 7}, now);
+    EXPECT_EQ(statuses(results),
+              (std::vector<BatchStatus>{BatchStatus::AlreadyDone, BatchStatus::CheckedIn, BatchStatus::CheckedIn,
+                                        BatchStatus::CheckedIn, BatchStatus::CheckedIn, BatchStatus::NoSeat}));
+    EXPECT_EQ(exam->getStats().checkedIn, 6);
+    EXPECT_EQ(exam->getSeatAllocator().getFreeCount(), 0);
+    EXPECT_FALSE(exam->getStudentByID(7)->getAttendance());
+    EXPECT_FALSE(exam->getStudentByID(7)->hasSeat());
+
+    // Every seat holds exactly the student who was given it
+    std::set<std::pair<int, int>> seats;
+    for (int id = 1; id <= 6; ++id) {
+        StudentStatus status;
+        ASSERT_TRUE(exam->readStudent(id, status));
+        ASSERT_TRUE(status.attended);
+        EXPECT_TRUE(seats.insert({status.seatRow, status.seatCol}).second) << "Seat shared by student " << id;
+
+        StudentStatus atSeat;
+        ASSERT_TRUE(exam->readStudentAtSeat(status.seatRow, status.seatCol, atSeat));
+        EXPECT_EQ(atSeat.studentID, id);
+    }
+}
+
+// Test case: Breaks toggle per ID and refuse students who cannot take one
+TEST(ExamBatchTest, ToggleBreakReportsEveryID) {
+    auto exam = RosterBuilder().students(4).build();
+    auto now = std::chrono::system_clock::now();
+    exam->checkInBatch({1, 2, 3}, now);
+    exam->submitBatch({3}, now);
+
+    std::vector<BatchResult> results = exam->toggleBreakBatch({1, 4, 99, 3, 1, 2}, now);
+    EXPECT_EQ(ids(results), (std::vector<int>{1, 4, 99, 3, 1, 2}));
+    EXPECT_EQ(statuses(results),
+              (std::vector<BatchStatus>{BatchStatus::BreakStarted, BatchStatus::Ineligible, BatchStatus::NotFound,
+                                        BatchStatus::Ineligible, BatchStatus::BreakEnded,
+                                        BatchStatus::BreakStarted}));
+    EXPECT_FALSE(exam->isOnBreak(1));
+    EXPECT_TRUE(exam->isOnBreak(2));
+    EXPECT_EQ(exam->getStats().onBreak, 1);
+
+    // In the last 15 minutes nobody may leave
+    results = exam->toggleBreakBatch({1}, exam->getEndTime() - std::chrono::minutes(5));
+    EXPECT_EQ(statuses(results), (std::vector<BatchStatus>{BatchStatus::OutsideBreakWindow}));
+    EXPECT_FALSE(exam->isOnBreak(1));
+}
+
+// Test case: Submissions are recorded once, and only for students who came
+TEST(ExamBatchTest, SubmitReportsEveryID) {
+    auto exam = RosterBuilder().students(4).build();
+    auto now = std::chrono::system_clock::now();
+    exam->checkInBatch({1, 2}, now);
+
+    std::vector<BatchResult> results = exam->submitBatch({2, 99, 2, 3, 1}, now);
+    EXPECT_EQ(ids(results), (std::vector<int>{2, 99, 2, 3, 1}));
+    EXPECT_EQ(statuses(results), (std::vector<BatchStatus>{BatchStatus::Submitted, BatchStatus::NotFound,
+                                                           BatchStatus::AlreadyDone, BatchStatus::Ineligible,
+                                                           BatchStatus::Submitted}));
+    EXPECT_EQ(exam->getStats().submitted, 2);
+    EXPECT_EQ(exam->getStats().earlySubmitted, 2);
+    EXPECT_FALSE(exam->getStudentByID(3)->getSubmissionStatus());
+}
+
+// Test case: Each ID of a batch is recorded at its own time
+TEST(ExamBatchTest, RecordsEachIDAtItsOwnTime) {
+    auto exam = RosterBuilder().students(3).build();
+    auto now = std::chrono::system_clock::now();
+    auto early = exam->getStartTime() + std::chrono::minutes(10);
+    std::vector<std::chrono::system_clock::time_point> times{early, now, now + std::chrono::seconds(3)};
+
+    exam->checkInBatch({1, 2, 3}, times);
+    ASSERT_EQ(exam->getEventLog().size(), 3u);
+    for (std::size_t i = 0; i < 3; ++i) {
+        EXPECT_EQ(exam->getEventLog().at(i).at(), std::chrono::time_point_cast<std::chrono::microseconds>(times[i]));
+    }
+
+    // The break window is checked against each ID's own time
+    std::vector<BatchResult> results = exam->toggleBreakBatch({1, 2, 3}, times);
+    EXPECT_EQ(statuses(results), (std::vector<BatchStatus>{BatchStatus::OutsideBreakWindow,
+                                                           BatchStatus::BreakStarted, BatchStatus::BreakStarted}));
+
+    results = exam->submitBatch({3, 1}, {now + std::chrono::minutes(1), now + std::chrono::minutes(2)});
+    EXPECT_EQ(statuses(results), (std::vector<BatchStatus>{BatchStatus::Submitted, BatchStatus::Submitted}));
+    EXPECT_EQ(exam->getEventLog().at(exam->getEventLog().size() - 1).at(),
+              std::chrono::time_point_cast<std::chrono::microseconds>(now + std::chrono::minutes(2)));
+}
+
+// Test case: A batch reaches the log in one run and counts once, while another station toggles breaks
+TEST(ExamBatchTest, BatchReachesLogInOneRun) {
+    const int batchSize = 50;
+    const int rounds = 40;
+    auto exam = RosterBuilder().students(batchSize + 10).seats(10, 10).checkedIn().build();
+    auto now = std::chrono::system_clock::now();
+    std::size_t from = exam->getEventLog().size();
+
+    std::vector<int> batch;
+    for (int id = 1; id <= batchSize; ++id) batch.push_back(id);
+    std::thread station([&exam, now] {
+        for (int round = 0; round < 2000; ++round) exam->toggleBreak(batchSize + 1 + round % 10, now);
+    });
+    for (int round = 0; round < rounds; ++round) exam->toggleBreakBatch(batch, now);
+    station.join();
+
+    // Every event of a batch student sits in a run of the whole batch, in ID order
+    std::vector<ExamEvent> events = exam->getEventLog().snapshot(from);
+    int runs = 0;
+    for (std::size_t i = 0; i < events.size();) {
+        if (events[i].studentID > batchSize) {
+            ++i;
+            continue;
+        }
+        ASSERT_LE(i + batchSize, events.size());
+        for (int k = 0; k < batchSize; ++k) {
+            ASSERT_EQ(events[i + k].studentID, k + 1) << "Batch split at event " << from + i + k;
+        }
+        i += batchSize;
+        runs++;
+    }
+    EXPECT_EQ(runs, rounds);
+
+    // Both sides toggled everyone an even number of times
+    EXPECT_EQ(exam->getStats().onBreak, 0);
+    EXPECT_EQ(exam->getStats().totalBreaks, batchSize * rounds / 2 + 1000);
+    EXPECT_TRUE(exam->getStudentsOnBreak().empty());
+}
@@ -0,0 +1,236 @@
+/**
+ * @file ExamConcurrencyTest.cpp
+ * @brief Stress tests for running several check-in stations on one Exam.
+ *
+ * This file contains Google Test cases that drive one Exam from four threads at
+ * once with overlapping check-ins, breaks and submissions, and verify that no
+ * update is lost, no seat is handed out twice and readers beside the stations
+ * only ever see a student in the seat they hold.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-16
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <numeric>
+#include <atomic>
+#include <set>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "Exam.h"
+
+namespace {
+const int STATIONS = 4;
+}
+
+// Test fixture for concurrent use of the Exam class
+class ExamConcurrencyTest : public ::testing::Test {
+protected:
+    Exam exam;
+    std::vector<int> ids;
+
+    void setUpRoom(int numStudents, int rows, int cols) {
+        auto now = std::chrono::system_clock::now();
+        exam.setStartTime(now - std::chrono::hours(1));
+        exam.setEndTime(now + std::chrono::hours(1));
+        exam.setMaxRow(rows);
+        exam.setMaxCol(cols);
+        exam.setNumVersions(3);
+        exam.setVersionsCode({101, 102, 103});
+        exam.initializeSeatMap();
+
+        exam.reserveRoster(numStudents);
+        for (int i = 0; i < numStudents; ++i) {
+            int id = 300000000 + i;
+            exam.addStudent(Student(id, "Student " + std::to_string(i), "2002-01-01", "pic.jpg"));
+            ids.push_back(id);
+        }
+    }
+
+    // Runs body(station) on every station at the same time
+    template <typename Body>
+    void runStations(Body body) {
+        std::vector<std::thread> threads;
+        for (int station = 0; station < STATIONS; ++station) {
+            threads.emplace_back(body, station);
+        }
+        for (std::thread &t : threads) t.join();
+    }
+
+    // Checks that seats held by students are unique and match the seat map
+    void expectUniqueSeats(int expectedSeated) {
+        std::set<std::pair<int, int>> seats;
+        for (Student &s : exam.getStudents()) {
+            if (!s.getAttendance()) {
+                EXPECT_FALSE(s.hasSeat());
+                continue;
+            }
+            ASSERT_TRUE(s.hasSeat()) << "Student " << s.getID() << " is present without a seat";
+            EXPECT_TRUE(seats.insert({s.getSeatRow(), s.getSeatCol()}).second)
+                << "Seat handed out twice: " << s.getSeatCode();
+            EXPECT_EQ(exam.getStudentAtSeat(s.getSeatRow(), s.getSeatCol()), &s);
+        }
+        EXPECT_EQ(static_cast<int>(seats.size()), expectedSeated);
+        const SeatAllocator &map = exam.getSeatAllocator();
+        EXPECT_EQ(map.getFreeCount(), map.getRows() * map.getCols() - expectedSeated);
+    }
+};
+
+// Test case: Every station tries to check in every student; each student is seated exactly once
+TEST_F(ExamConcurrencyTest, OverlappingCheckInsSeatEveryoneOnce) {
+    setUpRoom(2000, 50, 50);
+
+    runStations([this](int station) {
+        // Each station walks the roster from a different starting point
+        std::vector<int> batch;
+        for (std::size_t k = 0; k < ids.size(); ++k) {
+            int id = ids[(k + station * ids.size() / STATIONS) % ids.size()];
+            if (station % 2 == 0) {
+                exam.checkIn(id);
+            } else {
+                batch.push_back(id);
+                if (batch.size() == 16) {
+                    exam.checkInBatch(batch, std::chrono::system_clock::now());
+                    batch.clear();
+                }
+            }
+        }
+        if (!batch.empty()) exam.checkInBatch(batch, std::chrono::system_clock::now());
+    });
+
+    EXPECT_EQ(exam.getStats().checkedIn, 2000);
+    EXPECT_EQ(exam.countPresent(), 2000);
+    expectUniqueSeats(2000);
+}
+
+// Test case: More students than seats; the room fills exactly and nobody shares a seat
+TEST_F(ExamConcurrencyTest, FullRoomNeverDoubleAssigns) {
+    setUpRoom(1000, 20, 25);
+
+    runStations([this](int station) {
+        for (std::size_t k = station; k < ids.size(); k += 2) {
+            exam.checkIn(ids[k]);
+        }
+    });
+
+    EXPECT_EQ(exam.getStats().checkedIn, 500);
+    expectUniqueSeats(500);
+}
+
+// Test case: Concurrent breaks and submissions keep every counter exact
+TEST_F(ExamConcurrencyTest, BreaksAndSubmissionsLoseNoUpdates) {
+    setUpRoom(2000, 50, 50);
+    exam.checkInBatch(ids, std::chrono::system_clock::now());
+
+    runStations([this](int station) {
+        std::vector<int> mine;
+        for (std::size_t k = station; k < ids.size(); k += STATIONS) mine.push_back(ids[k]);
+
+        // Two breaks per student: one through the single-student call, one through a batch
+        for (int id : mine) {
+            exam.washroomBreak(id);
+            exam.washroomBreak(id);
+        }
+        auto now = std::chrono::system_clock::now();
+        exam.toggleBreakBatch(mine, now);
+        exam.toggleBreakBatch(mine, now);
+    });
+
+    // Once everyone is back, every station tries to submit everyone
+    runStations([this](int station) {
+        for (std::size_t k = 0; k < ids.size(); ++k) {
+            int id = ids[(k + station * 500) % ids.size()];
+            if (k % 2 == 0) {
+                exam.earlySubmission(id);
+            } else {
+                exam.submitBatch({id}, std::chrono::system_clock::now());
+            }
+        }
+    });
+
+    ExamStats stats = exam.getStats();
+    EXPECT_EQ(stats.totalBreaks, 4000);
+    EXPECT_EQ(stats.onBreak, 0);
+    EXPECT_TRUE(exam.getStudentsOnBreak().empty());
+    EXPECT_EQ(std::accumulate(stats.breaksPerVersion.begin(), stats.breaksPerVersion.end(), 0), 4000);
+    EXPECT_EQ(stats.submitted, 2000);
+    EXPECT_EQ(stats.earlySubmitted, 2000);
+    EXPECT_EQ(exam.countSubmitted(), 2000);
+    EXPECT_EQ(exam.countBreaks(), 4000);
+    for (Student &s : exam.getStudents()) {
+        EXPECT_EQ(s.getBreakCount(), 2u) << "Student " << s.getID();
+    }
+}
+
+// Test case: Undo and move race against check-ins without leaking or sharing seats
+TEST_F(ExamConcurrencyTest, UndoAndMoveKeepSeatMapConsistent) {
+    setUpRoom(800, 40, 40);
+
+    runStations([this](int station) {
+        for (std::size_t k = station; k < ids.size(); k += STATIONS) {
+            exam.checkIn(ids[k]);
+        }
+        // Half of each station's students are sent home, the other half move to the back rows
+        for (std::size_t k = station; k < ids.size(); k += STATIONS) {
+            if (k % 8 < 4) {
+                exam.undoCheckIn(ids[k]);
+            } else {
+                for (int seat = static_cast<int>(k); seat < 1600; seat += 7) {
+                    if (exam.moveStudent(ids[k], 20 + seat / 40 % 20, seat % 40)) break;
+                }
+            }
+        }
+    });
+
+    EXPECT_EQ(exam.getStats().checkedIn, 400);
+    expectUniqueSeats(400);
+}
+
+// Test case: A reader beside the stations only sees students in the seat they hold
+TEST_F(ExamConcurrencyTest, LockedReadsSeeConsistentSeats) {
+    setUpRoom(400, 10, 10);
+    std::atomic<bool> stationsDone(false);
+    std::atomic<int> inconsistent(0);
+
+    std::thread reader([&] {
+        while (!stationsDone.load()) {
+            for (int row = 0; row < 10; ++row) {
+                for (int col = 0; col < 10; ++col) {
+                    StudentStatus s;
+                    if (!exam.readStudentAtSeat(row, col, s)) continue;
+                    if (s.seatRow != row || s.seatCol != col || !s.attended) inconsistent++;
+                    StudentStatus again;
+                    if (!exam.readStudent(s.studentID, again) || again.studentID != s.studentID) inconsistent++;
+                }
+            }
+        }
+    });
+
+    // 400 students churn through 100 seats
+    runStations([this](int station) {
+        for (int round = 0; round < 5; ++round) {
+            for (std::size_t k = station; k < ids.size(); k += STATIONS) exam.checkIn(ids[k]);
+            for (std::size_t k = station; k < ids.size(); k += STATIONS) {
+                if (k % 3 == 0) exam.moveStudent(ids[k], static_cast<int>(k / 10 % 10), static_cast<int>(k % 10));
+                exam.undoCheckIn(ids[k]);
+            }
+        }
+    });
+    stationsDone = true;
+    reader.join();
+
+    EXPECT_EQ(inconsistent.load(), 0);
+    StudentStatus status;
+    EXPECT_FALSE(exam.readStudent(1, status)) << "Not on the roster";
+    EXPECT_FALSE(exam.readStudentAtSeat(10, 0, status)) << "Outside the room";
+    ASSERT_NE(exam.checkIn(ids[0]), nullptr);
+    ASSERT_TRUE(exam.readStudent(ids[0], status));
+    EXPECT_TRUE(status.attended);
+    EXPECT_EQ(status.name, "Student 0");
+    StudentStatus atSeat;
+    ASSERT_TRUE(exam.readStudentAtSeat(status.seatRow, status.seatCol, atSeat));
+    EXPECT_EQ(atSeat.studentID, ids[0]);
+}
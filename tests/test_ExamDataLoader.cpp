@@ -0,0 +1,114 @@
+/**
+ * @file ExamDataLoaderTest.cpp
+ * @brief Unit tests for the ExamDataLoader class.
+ *
+ * This file contains Google Test cases for loading exam data files, verifying
+ * that the header, proctors and students are read from the mapped file with
+ * Windows line endings, comments and a missing final newline, that roster text
+ * lands in the exam's string pool, that malformed rows are skipped, and that
+ * files with a bad header are rejected.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include "Exam.h"
+#include "ExamDataLoader.h"
+#include "Utils.h"
+
+// Test fixture for ExamDataLoader class
+class ExamDataLoaderTest : public ::testing::Test {
+protected:
+    std::filesystem::path dir;
+
+    void SetUp() override {
+        std::cerr.setstate(std::ios::failbit);
+        dir = std::filesystem::temp_directory_path() /
+              ("exam_loader_test_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) + "_" +
+               ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(dir);
+        std::cerr.clear();
+    }
+
+    std::string write(const std::string &contents) {
+        std::string path = (dir / "examData.txt").string();
+        std::ofstream(path, std::ios::binary) << contents;
+        return path;
+    }
+
+    static std::string header(const std::string &start = "2026-01-01T09:00:00") {
+        return "1251 ;; Term number\r\nWinter 26 ;; Term name\r\nCS3307 ;; Course number\r\nMC110 ;; Exam Rm\r\n"
+               "100 ;; Max seat\r\n10 ;; Rows\r\n12 ;; Colum\r\n3 ;; number of versions\r\n"
+               " 11, 22 ,33 ;; code of versions\r\n" + start + " ;; Start time\r\n"
+               "2026-01-01T12:00:00 ;; End time\r\n";
+    }
+};
+
+// Test case: Header, proctors and students are read, with text in the exam's pool
+TEST_F(ExamDataLoaderTest, LoadsEverySection) {
+    std::string path = write(header() +
+                             "Proctor ;; List of Proctor\r\n"
+                             "900, Ada Proctor, 1980-01-01, photos/p.jpg, TA\r\n"
+                             "Student ;; List of Student\r\n"
+                             "251000001, Grace Hopper, 2002-01-01, photos/1.jpg\r\n"
+                             "\r\n"
+                             "  251000002 ,Alan Turing,2002-01-01 , photos/2.jpg, 30  \r\n"
+                             "251000003, Only three, fields\r\n"
+                             "not a number, Bad ID, 2002-01-01, photos/3.jpg\r\n"
+                             "251000004, Last Row, 2003-05-05, photos/4.jpg");
+    Exam exam;
+    ASSERT_TRUE(ExamDataLoader::loadExamData(path, exam));
+
+    EXPECT_EQ(exam.getTermNum(), 1251);
+    EXPECT_EQ(exam.getTermName(), "Winter 26");
+    EXPECT_EQ(exam.getCourseNum(), "CS3307");
+    EXPECT_EQ(exam.getRmNum(), "MC110");
+    EXPECT_EQ(exam.getCapacity(), 100);
+    EXPECT_EQ(exam.getMaxRow(), 10);
+    EXPECT_EQ(exam.getMaxCol(), 12);
+    EXPECT_EQ(exam.getVersionsCode(), (std::vector<int>{11, 22, 33}));
+    EXPECT_EQ(exam.getStartTime(), stringToTimePoint("2026-01-01T09:00:00"));
+
+    ASSERT_EQ(exam.getProctors().size(), 1u);
+    EXPECT_EQ(exam.getProctors()[0].getRole(), "TA");
+    EXPECT_EQ(exam.getProctors()[0].getStringPool(), exam.getStringPool());
+
+    ASSERT_EQ(exam.getStudents().size(), 3u) << "Rows with the wrong field count or a bad ID are skipped";
+    const Student *turing = exam.getStudentByID(251000002);
+    ASSERT_NE(turing, nullptr);
+    EXPECT_EQ(turing->getName(), "Alan Turing");
+    EXPECT_EQ(turing->getPicURL(), "photos/2.jpg");
+    EXPECT_EQ(turing->getExtraTime(), std::chrono::minutes(30));
+    EXPECT_EQ(turing->getStringPool(), exam.getStringPool());
+    EXPECT_EQ(exam.getStudentByID(251000004)->getDOB(), "2003-05-05");
+}
+
+// Test case: A bad header or a missing file fails the load
+TEST_F(ExamDataLoaderTest, RejectsBadFiles) {
+    Exam missing;
+    EXPECT_FALSE(ExamDataLoader::loadExamData((dir / "nope.txt").string(), missing));
+
+    Exam badTime;
+    EXPECT_FALSE(ExamDataLoader::loadExamData(write(header("2026-01-01 nine") + "Proctor\nStudent\n"), badTime));
+
+    Exam badNumber;
+    EXPECT_FALSE(ExamDataLoader::loadExamData(write("Term ;; Term number\n"), badNumber));
+
+    Exam noProctors;
+    EXPECT_FALSE(ExamDataLoader::loadExamData(write(header() + "Student ;; List of Student\n"), noProctors));
+
+    Exam empty;
+    EXPECT_TRUE(ExamDataLoader::loadExamData(write(header() + "Proctor\nStudent\n"), empty));
+    EXPECT_TRUE(empty.getStudents().empty());
+}
@@ -0,0 +1,178 @@
+/**
+ * @file ExamEventLogTest.cpp
+ * @brief Unit tests for the ExamEventLog class and Exam replay.
+ *
+ * This file contains Google Test cases for the ExamEventLog class, verifying
+ * append order, batches, incident messages and listeners, and that replaying
+ * the log of one exam into a freshly loaded copy rebuilds the same state,
+ * including seats that several stations freed and took at the same time.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "Exam.h"
+#include "TestRoster.h"
+
+// Test case: Events keep their order and incident messages are stored beside them
+TEST(ExamEventLogTest, AppendKeepsOrderAndMessages) {
+    ExamEventLog log;
+    auto now = std::chrono::system_clock::now();
+    log.append(ExamEvent::make(ExamEventType::CheckedIn, now, 7, 1, 2, 201));
+    log.append(ExamEvent::make(ExamEventType::IncidentLogged, now, 7, 90), "Talking");
+    log.append(ExamEvent::make(ExamEventType::Submitted, now, 7));
+
+    ASSERT_EQ(log.size(), 3u);
+    EXPECT_EQ(log.at(0).type, ExamEventType::CheckedIn);
+    EXPECT_EQ(log.at(0).arg2, 201);
+    EXPECT_EQ(log.messageFor(log.at(1)), "Talking");
+    EXPECT_EQ(log.messageFor(log.at(2)), "") << "Only incidents carry a message";
+    EXPECT_EQ(log.snapshot(2).size(), 1u);
+
+    auto micros = std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch());
+    EXPECT_EQ(log.at(0).atMicros, micros.count());
+}
+
+// Test case: Listeners see every appended event with its message
+TEST(ExamEventLogTest, ListenersSeeEveryEvent) {
+    auto exam = RosterBuilder().build();
+    std::vector<ExamEventType> seen;
+    std::string lastMessage;
+    exam->getEventLog().addListener([&](const ExamEvent &e, const std::string &message) {
+        seen.push_back(e.type);
+        if (!message.empty()) lastMessage = message;
+    });
+
+    exam->checkIn(1);
+    exam->washroomBreak(1);
+    exam->washroomBreak(1);
+    exam->writeIncident(1, 90, "Left without asking");
+    exam->earlySubmission(1);
+    exam->checkIn(99);   // Not on the roster: no event
+
+    EXPECT_EQ(seen, (std::vector<ExamEventType>{ExamEventType::CheckedIn, ExamEventType::BreakStarted,
+                                                ExamEventType::BreakEnded, ExamEventType::IncidentLogged,
+                                                ExamEventType::Submitted}));
+    EXPECT_EQ(lastMessage, "Left without asking");
+}
+
+// Test case: A batch is appended in order after what came before, and listeners see each event of it
+TEST(ExamEventLogTest, AppendBatchKeepsOrder) {
+    ExamEventLog log;
+    auto now = std::chrono::system_clock::now();
+    std::vector<int> seen;
+    log.addListener([&](const ExamEvent &e, const std::string &) { seen.push_back(e.studentID); });
+
+    log.append(ExamEvent::make(ExamEventType::CheckedIn, now, 7, 1, 2, 201));
+    EXPECT_EQ(log.appendBatch({ExamEvent::make(ExamEventType::BreakStarted, now, 8),
+                               ExamEvent::make(ExamEventType::BreakStarted, now, 9),
+                               ExamEvent::make(ExamEventType::Submitted, now, 7)}), 1u);
+    EXPECT_EQ(log.appendBatch({}), 4u);
+
+    ASSERT_EQ(log.size(), 4u);
+    EXPECT_EQ(log.at(3).type, ExamEventType::Submitted);
+    EXPECT_EQ(log.nextSequence(), 4u);
+    EXPECT_EQ(seen, (std::vector<int>{7, 8, 9, 7}));
+}
+
+// Test case: Replaying a log into a fresh exam rebuilds the same state
+TEST(ExamEventLogTest, ReplayRebuildsState) {
+    auto original = RosterBuilder().build();
+    original->checkInBatch({1, 2, 3, 4, 5}, std::chrono::system_clock::now());
+    original->checkIn(6);
+    original->undoCheckIn(2);
+    original->moveStudent(3, 3, 4);
+    original->washroomBreak(4);
+    original->washroomBreak(4);
+    original->washroomBreak(5);
+    original->writeIncident(6, 90, "Phone");
+    original->earlySubmission(1);
+    original->checkIn(7);
+
+    auto rebuilt = RosterBuilder().build();
+    ASSERT_TRUE(rebuilt->replay(original->getEventLog()));
+    EXPECT_EQ(rebuilt->getEventLog().size(), original->getEventLog().size());
+
+    for (int id = 1; id <= 8; ++id) {
+        Student *a = original->getStudentByID(id);
+        Student *b = rebuilt->getStudentByID(id);
+        EXPECT_EQ(a->getAttendance(), b->getAttendance()) << "Student " << id;
+        EXPECT_EQ(a->getSeatRow(), b->getSeatRow()) << "Student " << id;
+        EXPECT_EQ(a->getSeatCol(), b->getSeatCol()) << "Student " << id;
+        EXPECT_EQ(a->getExamVersion(), b->getExamVersion()) << "Student " << id;
+        EXPECT_EQ(a->getSubmissionStatus(), b->getSubmissionStatus()) << "Student " << id;
+        EXPECT_EQ(a->getSubmissionTimePoint(), b->getSubmissionTimePoint()) << "Student " << id;
+        EXPECT_EQ(a->getBreakCount(), b->getBreakCount()) << "Student " << id;
+        EXPECT_EQ(original->isOnBreak(id), rebuilt->isOnBreak(id)) << "Student " << id;
+    }
+
+    ExamStats before = original->getStats();
+    ExamStats after = rebuilt->getStats();
+    EXPECT_EQ(after.checkedIn, before.checkedIn);
+    EXPECT_EQ(after.submitted, before.submitted);
+    EXPECT_EQ(after.onBreak, before.onBreak);
+    EXPECT_EQ(after.totalBreaks, before.totalBreaks);
+    EXPECT_EQ(after.breaksPerVersion, before.breaksPerVersion);
+    EXPECT_EQ(rebuilt->getIncidents().all(), original->getIncidents().all());
+    EXPECT_EQ(rebuilt->getSeatAllocator().getFreeCount(), original->getSeatAllocator().getFreeCount());
+    EXPECT_EQ(rebuilt->getStudentAtSeat(3, 4), rebuilt->getStudentByID(3));
+}
+
+// Test case: Events that do not fit the current state are skipped
+TEST(ExamEventLogTest, ReplaySkipsInconsistentEvents) {
+    ExamEventLog log;
+    auto now = std::chrono::system_clock::now();
+    log.append(ExamEvent::make(ExamEventType::CheckedIn, now, 1, 0, 0, 201));
+    log.append(ExamEvent::make(ExamEventType::CheckedIn, now, 2, 0, 0, 202));   // Seat already taken
+    log.append(ExamEvent::make(ExamEventType::BreakEnded, now, 1));            // Never left
+    log.append(ExamEvent::make(ExamEventType::Submitted, now, 42));            // Not on the roster
+
+    auto exam = RosterBuilder().build();
+    EXPECT_FALSE(exam->replay(log));
+    EXPECT_TRUE(exam->getStudentByID(1)->getAttendance());
+    EXPECT_FALSE(exam->getStudentByID(2)->getAttendance());
+    EXPECT_EQ(exam->getEventLog().size(), 1u);
+}
+
+// Test case: Seats freed by undos and moves while other stations check in replay to the same occupancy
+TEST(ExamEventLogTest, ReplayKeepsConcurrentSeatChanges) {
+    const int perStation = 40;
+    const int stations = 4;
+    // 100 seats for 160 students, so a freed seat is taken again straight away
+    auto original = RosterBuilder().students(perStation * stations).seats(10, 10).build();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < stations; ++t) {
+        threads.emplace_back([&original, t, perStation] {
+            int firstID = 1 + t * perStation;
+            for (int round = 0; round < 10000; ++round) {
+                int id = firstID + round % perStation;
+                original->undoCheckIn(id);
+                original->checkIn(id);
+                original->moveStudent(firstID + (round * 7) % perStation, round % 10, (round * 3) % 10);
+            }
+        });
+    }
+    for (std::thread &thread : threads) thread.join();
+
+    auto rebuilt = RosterBuilder().students(perStation * stations).seats(10, 10).build();
+    ASSERT_TRUE(rebuilt->replay(original->getEventLog())) << "Every logged seat change fits when replayed in order";
+    EXPECT_EQ(rebuilt->getStats().checkedIn, original->getStats().checkedIn);
+    EXPECT_EQ(rebuilt->getSeatAllocator().getFreeCount(), original->getSeatAllocator().getFreeCount());
+    for (int row = 0; row < 10; ++row) {
+        for (int col = 0; col < 10; ++col) {
+            Student *want = original->getStudentAtSeat(row, col);
+            Student *got = rebuilt->getStudentAtSeat(row, col);
+            ASSERT_EQ(got == nullptr, want == nullptr) << "Seat " << row << "," << col;
+            if (want) {
+                EXPECT_EQ(got->getID(), want->getID()) << "Seat " << row << "," << col;
+            }
+        }
+    }
+}
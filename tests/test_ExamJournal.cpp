@@ -0,0 +1,169 @@
+/**
+ * @file ExamJournalTest.cpp
+ * @brief Unit tests for the ExamJournal class.
+ *
+ * This file contains Google Test cases for the ExamJournal class, verifying
+ * that a journal rebuilds an exam after a simulated crash, that group commit
+ * batches fsyncs, that a torn last record is dropped and that a 1,000-student
+ * exam recovers in well under a second.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <vector>
+#include "Exam.h"
+#include "ExamJournal.h"
+#include "TestRoster.h"
+
+// Test fixture for ExamJournal class
+class ExamJournalTest : public ::testing::Test {
+protected:
+    std::string path;
+
+    void SetUp() override {
+        path = (std::filesystem::temp_directory_path() /
+                ("exam_journal_test_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) + "_" +
+                 ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".journal")).string();
+        std::filesystem::remove(path);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(path);
+    }
+};
+
+// Test case: A journal left behind by a crash rebuilds the exam
+TEST_F(ExamJournalTest, RecoverAfterCrash) {
+    auto original = RosterBuilder().students(10).seats(40, 30).versions({301, 302, 303}).build();
+    {
+        ExamJournal journal(path, std::chrono::milliseconds(5));
+        ASSERT_TRUE(journal.open("examData.txt"));
+        journal.attach(*original);
+
+        original->checkInBatch({1, 2, 3, 4}, std::chrono::system_clock::now());
+        original->washroomBreak(2);
+        original->writeIncident(3, 90, "Notes under the desk", IncidentCategory::AcademicMisconduct);
+        original->earlySubmission(4);
+        EXPECT_TRUE(journal.flush());
+        // Going out of scope without close(true) is what a crash leaves behind
+    }
+
+    JournalInfo info = ExamJournal::inspect(path);
+    EXPECT_TRUE(info.found);
+    EXPECT_FALSE(info.finished);
+    EXPECT_FALSE(info.truncated);
+    EXPECT_EQ(info.examDataPath, "examData.txt");
+    EXPECT_EQ(info.events, 7u);
+
+    auto rebuilt = RosterBuilder().students(10).seats(40, 30).versions({301, 302, 303}).build();
+    ExamJournal::recover(path, *rebuilt);
+    for (int id = 1; id <= 4; ++id) {
+        EXPECT_TRUE(rebuilt->getStudentByID(id)->getAttendance());
+        EXPECT_EQ(rebuilt->getStudentByID(id)->getSeatCode(), original->getStudentByID(id)->getSeatCode());
+    }
+    EXPECT_TRUE(rebuilt->isOnBreak(2));
+    EXPECT_TRUE(rebuilt->getStudentByID(4)->getSubmissionStatus());
+    EXPECT_EQ(rebuilt->getIncidents().all(), original->getIncidents().all());
+}
+
+// Test case: Events arriving inside one commit interval share a single fsync
+TEST_F(ExamJournalTest, GroupCommitBatchesSyncs) {
+    ExamJournal journal(path, std::chrono::milliseconds(200), 1 << 20);
+    ASSERT_TRUE(journal.open("examData.txt"));
+    auto now = std::chrono::system_clock::now();
+    for (int i = 0; i < 1000; ++i) {
+        journal.record(ExamEvent::make(ExamEventType::CheckedIn, now, i, i / 30, i % 30, 301), "");
+    }
+    ASSERT_TRUE(journal.flush());
+    EXPECT_EQ(journal.getRecordCount(), 1000u);
+    EXPECT_LE(journal.getSyncCount(), 2u);
+    EXPECT_EQ(ExamJournal::inspect(path).events, 1000u);
+}
+
+// Test case: A record cut short by power loss is dropped and the journal resumes after the last good one
+TEST_F(ExamJournalTest, TornRecordIsDropped) {
+    auto now = std::chrono::system_clock::now();
+    {
+        ExamJournal journal(path, std::chrono::milliseconds(1));
+        ASSERT_TRUE(journal.open("examData.txt"));
+        for (int id = 1; id <= 3; ++id) {
+            journal.record(ExamEvent::make(ExamEventType::CheckedIn, now, id, 0, id, 301), "");
+        }
+        journal.flush();
+    }
+    std::uintmax_t fullSize = std::filesystem::file_size(path);
+    std::filesystem::resize_file(path, fullSize - 5);
+
+    JournalInfo info = ExamJournal::inspect(path);
+    EXPECT_TRUE(info.truncated);
+    EXPECT_EQ(info.events, 2u);
+
+    // Resume: the torn bytes are cut off before new records are appended
+    {
+        ExamJournal journal(path, std::chrono::milliseconds(1));
+        ASSERT_TRUE(journal.open("examData.txt", info.validBytes));
+        journal.record(ExamEvent::make(ExamEventType::CheckedIn, now, 5, 1, 0, 302), "");
+        journal.close(false);
+    }
+    info = ExamJournal::inspect(path);
+    EXPECT_FALSE(info.truncated);
+    EXPECT_EQ(info.events, 3u);
+
+    auto exam = RosterBuilder().students(10).seats(40, 30).versions({301, 302, 303}).build();
+    ExamJournal::recover(path, *exam);
+    EXPECT_TRUE(exam->getStudentByID(2)->getAttendance());
+    EXPECT_FALSE(exam->getStudentByID(3)->getAttendance());
+    EXPECT_TRUE(exam->getStudentByID(5)->getAttendance());
+}
+
+// Test case: A journal closed at the end of the exam is not offered for recovery
+TEST_F(ExamJournalTest, FinishedJournalIsMarked) {
+    auto exam = RosterBuilder().students(5).seats(40, 30).versions({301, 302, 303}).build();
+    ExamJournal journal(path, std::chrono::milliseconds(1));
+    ASSERT_TRUE(journal.open("examData.txt"));
+    journal.attach(*exam);
+    exam->checkIn(1);
+    journal.close(true);
+
+    exam->checkIn(2);   // Detached: not journaled
+    JournalInfo info = ExamJournal::inspect(path);
+    EXPECT_TRUE(info.finished);
+    EXPECT_EQ(info.events, 1u);
+    EXPECT_FALSE(ExamJournal::inspect(path + ".missing").found);
+}
+
+// Test case: A full 1,000-student exam day recovers in well under a second
+TEST_F(ExamJournalTest, ThousandStudentRecoveryIsFast) {
+    auto original = RosterBuilder().students(1000).seats(40, 30).versions({301, 302, 303}).build();
+    std::vector<int> ids;
+    for (int i = 1; i <= 1000; ++i) ids.push_back(i);
+    {
+        ExamJournal journal(path, std::chrono::milliseconds(10));
+        ASSERT_TRUE(journal.open("examData.txt"));
+        journal.attach(*original);
+        auto now = std::chrono::system_clock::now();
+        original->checkInBatch(ids, now);
+        original->toggleBreakBatch(ids, now);
+        original->toggleBreakBatch(ids, now);
+        original->submitBatch(ids, now);
+        journal.flush();
+    }
+
+    auto rebuilt = RosterBuilder().students(1000).seats(40, 30).versions({301, 302, 303}).build();
+    auto start = std::chrono::steady_clock::now();
+    JournalInfo info = ExamJournal::recover(path, *rebuilt);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(info.events, 4000u);
+    EXPECT_EQ(rebuilt->getStats().submitted, 1000);
+    EXPECT_EQ(rebuilt->getStats().totalBreaks, 1000);
+    EXPECT_LT(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count(), 500);
+}
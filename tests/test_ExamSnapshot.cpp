@@ -0,0 +1,253 @@
+/**
+ * @file ExamSnapshotTest.cpp
+ * @brief Unit tests for the ExamSnapshot class.
+ *
+ * This file contains Google Test cases for exam snapshots, verifying that a
+ * snapshot restores the full exam state and the order of the break log, that
+ * a snapshot plus the journal tail rebuilds an exam after a crash and that
+ * corrupt files are rejected.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <vector>
+#include "Exam.h"
+#include "ExamJournal.h"
+#include "ExamSnapshot.h"
+#include "TestRoster.h"
+
+namespace {
+// Compares everything a snapshot is meant to carry
+void expectSameState(Exam &expected, Exam &actual) {
+    EXPECT_EQ(actual.getCourseNum(), expected.getCourseNum());
+    EXPECT_EQ(actual.getTermName(), expected.getTermName());
+    EXPECT_EQ(actual.getRmNum(), expected.getRmNum());
+    EXPECT_EQ(actual.getTermNum(), expected.getTermNum());
+    EXPECT_EQ(actual.getVersionsCode(), expected.getVersionsCode());
+    // Times are stored to the microsecond
+    EXPECT_LT(std::chrono::abs(actual.getEndTime() - expected.getEndTime()), std::chrono::microseconds(1));
+
+    ExamStats a = actual.getStats(), e = expected.getStats();
+    EXPECT_EQ(a.checkedIn, e.checkedIn);
+    EXPECT_EQ(a.submitted, e.submitted);
+    EXPECT_EQ(a.earlySubmitted, e.earlySubmitted);
+    EXPECT_EQ(a.onBreak, e.onBreak);
+    EXPECT_EQ(a.totalBreaks, e.totalBreaks);
+    EXPECT_EQ(a.incidents, e.incidents);
+    EXPECT_EQ(a.breaksPerVersion, e.breaksPerVersion);
+    EXPECT_EQ(actual.getIncidents().all(), expected.getIncidents().all());
+    EXPECT_EQ(actual.getSeatAllocator().getFreeCount(), expected.getSeatAllocator().getFreeCount());
+    EXPECT_EQ(actual.getStudentsOnBreak().size(), expected.getStudentsOnBreak().size());
+    EXPECT_EQ(actual.getEventLog().nextSequence(), expected.getEventLog().nextSequence());
+    EXPECT_EQ(actual.countBreaks(), expected.countBreaks());
+    ASSERT_EQ(actual.getProctors().size(), expected.getProctors().size());
+    EXPECT_EQ(actual.getProctors()[0].getRole(), expected.getProctors()[0].getRole());
+
+    ASSERT_EQ(actual.getStudents().size(), expected.getStudents().size());
+    for (std::size_t i = 0; i < expected.getStudents().size(); ++i) {
+        Student &want = expected.getStudents()[i];
+        Student &got = actual.getStudents()[i];
+        EXPECT_EQ(got.getID(), want.getID());
+        EXPECT_EQ(got.getPicURL(), want.getPicURL());
+        EXPECT_EQ(got.getAttendance(), want.getAttendance());
+        EXPECT_EQ(got.getSeatCode(), want.getSeatCode());
+        EXPECT_EQ(got.getExamVersion(), want.getExamVersion());
+        EXPECT_EQ(got.getSubmissionStatus(), want.getSubmissionStatus());
+        EXPECT_EQ(got.getBreakCount(), want.getBreakCount());
+        EXPECT_EQ(got.getExtraTime(), want.getExtraTime());
+        EXPECT_EQ(actual.isOnBreak(got.getID()), expected.isOnBreak(want.getID()));
+        if (want.hasSeat()) {
+            EXPECT_EQ(actual.getStudentAtSeat(got.getSeatRow(), got.getSeatCol()), &got);
+        }
+    }
+}
+}
+
+// Test fixture for ExamSnapshot class
+class ExamSnapshotTest : public ::testing::Test {
+protected:
+    std::string path;
+    std::string journalPath;
+
+    void SetUp() override {
+        std::string base = (std::filesystem::temp_directory_path() /
+                            ("exam_snapshot_test_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) +
+                             "_" + ::testing::UnitTest::GetInstance()->current_test_info()->name())).string();
+        path = base + ".snapshot";
+        journalPath = base + ".journal";
+        std::filesystem::remove(path);
+        std::filesystem::remove(journalPath);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(path);
+        std::filesystem::remove(journalPath);
+    }
+};
+
+// Test case: Seats, versions, extra time, breaks, submissions, incidents and reserved seats survive a round trip
+TEST_F(ExamSnapshotTest, RoundTripRestoresFullState) {
+    auto original = RosterBuilder().students(50).seats(40, 30).versions({301, 302, 303}).build();
+    int blockRow, blockCol;
+    ASSERT_TRUE(original->reserveSeatBlock(3, blockRow, blockCol));
+    original->getStudentByID(9)->setExtraTime(std::chrono::minutes(30));
+    original->checkInBatch({1, 2, 3, 4, 5, 6, 7, 8}, std::chrono::system_clock::now());
+    original->moveStudent(3, 30, 10);
+    original->washroomBreak(4);
+    original->washroomBreak(4);
+    original->washroomBreak(5);   // Still out when the snapshot is taken
+    original->earlySubmission(6);
+    original->writeIncident(7, 90, "Phone on desk", IncidentCategory::UnauthorizedMaterial);
+
+    ASSERT_TRUE(ExamSnapshot::write(path, ExamSnapshot::capture(*original, "examData.txt")));
+
+    SnapshotInfo header = ExamSnapshot::inspect(path);
+    EXPECT_TRUE(header.found);
+    EXPECT_EQ(header.examDataPath, "examData.txt");
+    EXPECT_EQ(header.students, 50u);
+    EXPECT_EQ(header.eventSequence, original->getEventLog().nextSequence());
+
+    Exam restored;
+    SnapshotInfo info = ExamSnapshot::load(path, restored);
+    ASSERT_TRUE(info.found);
+    expectSameState(*original, restored);
+    EXPECT_TRUE(restored.isOnBreak(5));
+    EXPECT_TRUE(restored.getSeatAllocator().isTaken(blockRow, blockCol)) << "Reserved seats stay reserved";
+    EXPECT_EQ(restored.getStudentAtSeat(blockRow, blockCol), nullptr);
+
+    // The restored exam keeps working
+    restored.washroomBreak(5);
+    EXPECT_FALSE(restored.isOnBreak(5));
+    ASSERT_NE(restored.checkIn(9), nullptr);
+    EXPECT_EQ(restored.getStats().checkedIn, 9);
+}
+
+// Test case: Breaks come back in the order they started, not in roster order
+TEST_F(ExamSnapshotTest, RoundTripKeepsBreakLogOrder) {
+    auto original = RosterBuilder().students(5).build();
+    original->checkInBatch({1, 2, 3, 4, 5}, std::chrono::system_clock::now());
+    auto at = original->getStartTime() + std::chrono::minutes(40);
+    original->toggleBreak(4, at);
+    original->toggleBreak(2, at + std::chrono::minutes(1));
+    original->toggleBreak(4, at + std::chrono::minutes(2));
+    original->toggleBreak(5, at + std::chrono::minutes(3));
+    original->toggleBreak(4, at + std::chrono::minutes(4));   // Second break, still out
+    original->toggleBreak(1, at + std::chrono::minutes(5));
+
+    ASSERT_TRUE(ExamSnapshot::write(path, ExamSnapshot::capture(*original, "examData.txt")));
+    Exam restored;
+    ASSERT_TRUE(ExamSnapshot::load(path, restored).found);
+    expectSameState(*original, restored);
+
+    auto records = [](const Exam &exam) {
+        std::vector<std::pair<int, std::chrono::system_clock::time_point>> out;
+        exam.getBreakLog()->forEach([&out](const BreakRecord &r) {
+            out.emplace_back(r.studentID, std::chrono::time_point_cast<std::chrono::microseconds>(
+                                              r.span.getStartTimePoint()));
+        });
+        return out;
+    };
+    auto restoredRecords = records(restored);
+    EXPECT_EQ(restoredRecords, records(*original));
+    ASSERT_EQ(restoredRecords.size(), 5u);
+    EXPECT_EQ(restoredRecords[0].first, 4);
+    EXPECT_EQ(restoredRecords[1].first, 2);
+
+    // Each student's own breaks still link up in order
+    Student *twice = restored.getStudentByID(4);
+    ASSERT_EQ(twice->getBreakCount(), 2u);
+    EXPECT_TRUE(twice->getBreaksList().front().hasEnded());
+    EXPECT_FALSE(twice->getBreaksList().back().hasEnded());
+    EXPECT_TRUE(restored.isOnBreak(4));
+    EXPECT_EQ(restored.toggleBreak(4, at + std::chrono::minutes(6)), BatchStatus::BreakEnded);
+}
+
+// Test case: Snapshot plus the journal records written after it rebuild the exam
+TEST_F(ExamSnapshotTest, SnapshotPlusJournalTail) {
+    auto original = RosterBuilder().students(30).seats(40, 30).versions({301, 302, 303}).build();
+    {
+        ExamJournal journal(journalPath, std::chrono::milliseconds(5));
+        ASSERT_TRUE(journal.open("examData.txt"));
+        journal.attach(*original);
+
+        original->checkInBatch({1, 2, 3, 4, 5}, std::chrono::system_clock::now());
+        original->washroomBreak(1);
+        ASSERT_TRUE(journal.flush());
+        ASSERT_TRUE(ExamSnapshot::write(path, ExamSnapshot::capture(*original, "examData.txt")));
+
+        // Changes after the snapshot are only in the journal
+        original->washroomBreak(1);
+        original->washroomBreak(2);
+        original->earlySubmission(3);
+        original->writeIncident(4, 90, "Talking");
+        original->checkIn(6);
+        EXPECT_TRUE(journal.flush());
+    }
+
+    Exam restored;
+    SnapshotInfo snapshot = ExamSnapshot::load(path, restored);
+    ASSERT_TRUE(snapshot.found);
+    EXPECT_EQ(snapshot.eventSequence, 6u);
+    JournalInfo journal = ExamJournal::recover(journalPath, restored);
+    ASSERT_TRUE(journal.found);
+    EXPECT_EQ(journal.events, 11u);
+    expectSameState(*original, restored);
+}
+
+// Test case: Corrupt or cut short snapshots are rejected
+TEST_F(ExamSnapshotTest, CorruptSnapshotIsRejected) {
+    auto original = RosterBuilder().students(20).seats(40, 30).versions({301, 302, 303}).build();
+    original->checkInBatch({1, 2, 3}, std::chrono::system_clock::now());
+    std::string image = ExamSnapshot::capture(*original, "examData.txt");
+
+    std::string damaged = image;
+    damaged[damaged.size() / 2] ^= 0x5A;
+    {
+        std::ofstream out(path, std::ios::binary);
+        out.write(damaged.data(), static_cast<std::streamsize>(damaged.size()));
+    }
+    Exam fromDamaged;
+    EXPECT_FALSE(ExamSnapshot::load(path, fromDamaged).found) << "The body CRC catches damaged records";
+
+    {
+        std::ofstream out(path, std::ios::binary);
+        out.write(image.data(), 40);
+    }
+    EXPECT_FALSE(ExamSnapshot::inspect(path).found);
+    Exam fromShort;
+    EXPECT_FALSE(ExamSnapshot::load(path, fromShort).found);
+
+    EXPECT_FALSE(ExamSnapshot::inspect(path + ".missing").found);
+
+    // Checksums intact, but two students in one seat: rejected part-way through the roster
+    Student *first = original->getStudentByID(1);
+    std::string shared =
+        snapshotWithMovedSeat(image, *original->getStudentByID(2), first->getSeatRow(), first->getSeatCol());
+    ASSERT_FALSE(shared.empty());
+    ASSERT_TRUE(ExamSnapshot::write(path, shared));
+    EXPECT_TRUE(ExamSnapshot::inspect(path).found);
+    Exam fromShared;
+    EXPECT_FALSE(ExamSnapshot::load(path, fromShared).found);
+
+    // A reserved seat that a student also holds is rejected the same way
+    int blockRow, blockCol;
+    ASSERT_TRUE(original->reserveSeatBlock(1, blockRow, blockCol));
+    std::string withBlock = ExamSnapshot::capture(*original, "examData.txt");
+    std::string reservedTwice = snapshotWithMovedSeat(withBlock, *original->getStudentByID(3), blockRow, blockCol);
+    ASSERT_FALSE(reservedTwice.empty());
+    ASSERT_TRUE(ExamSnapshot::write(path, reservedTwice));
+    Exam fromReservedTwice;
+    EXPECT_FALSE(ExamSnapshot::load(path, fromReservedTwice).found);
+
+    // A good snapshot is never loaded on top of a roster that is already there
+    ASSERT_TRUE(ExamSnapshot::write(path, image));
+    auto loaded = RosterBuilder().students(20).seats(40, 30).versions({301, 302, 303}).build();
+    EXPECT_FALSE(ExamSnapshot::load(path, *loaded).found);
+}
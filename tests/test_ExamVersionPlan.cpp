@@ -0,0 +1,96 @@
+/**
+ * @file ExamVersionPlanTest.cpp
+ * @brief Unit tests for the per-seat exam version plan of the Exam class.
+ *
+ * This file contains Google Test cases for the version plan computed when the
+ * seat map is initialized, verifying that neighbouring seats never share a
+ * version, that check-in hands out the version of the seat, and that the plan
+ * for a large hall is computed quickly.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <numeric>
+#include <vector>
+#include "Exam.h"
+
+namespace {
+void setUpRoom(Exam &exam, int rows, int cols, int versions) {
+    std::vector<int> codes(versions);
+    std::iota(codes.begin(), codes.end(), 101);
+    exam.setMaxRow(rows);
+    exam.setMaxCol(cols);
+    exam.setNumVersions(versions);
+    exam.setVersionsCode(codes);
+    exam.initializeSeatMap();
+}
+}
+
+// Test case: No seat shares a version with the seat in front, behind, left or right
+TEST(ExamVersionPlanTest, NeighboursGetDifferentVersions) {
+    for (int versions = 2; versions <= 6; ++versions) {
+        Exam exam;
+        setUpRoom(exam, 17, 23, versions);
+        for (int r = 0; r < 17; ++r) {
+            for (int c = 0; c < 23; ++c) {
+                int v = exam.getSeatVersion(r, c);
+                ASSERT_GE(v, 101);
+                ASSERT_LT(v, 101 + versions);
+                if (c + 1 < 23) {
+                    EXPECT_NE(v, exam.getSeatVersion(r, c + 1)) << versions << " versions";
+                }
+                if (r + 1 < 17) {
+                    EXPECT_NE(v, exam.getSeatVersion(r + 1, c)) << versions << " versions";
+                }
+                // With four or more versions, diagonal neighbours differ too
+                if (versions >= 4 && r + 1 < 17 && c + 1 < 23) {
+                    EXPECT_NE(v, exam.getSeatVersion(r + 1, c + 1));
+                }
+                if (versions >= 4 && r + 1 < 17 && c > 0) {
+                    EXPECT_NE(v, exam.getSeatVersion(r + 1, c - 1));
+                }
+            }
+        }
+    }
+
+    Exam single;
+    setUpRoom(single, 3, 3, 1);
+    EXPECT_EQ(single.getSeatVersion(2, 2), 101);
+    EXPECT_EQ(single.getSeatVersion(3, 0), 0) << "Seats outside the room have no version";
+}
+
+// Test case: Check-in hands out the version planned for the assigned seat
+TEST(ExamVersionPlanTest, CheckInUsesSeatVersion) {
+    Exam exam;
+    auto now = std::chrono::system_clock::now();
+    exam.setStartTime(now - std::chrono::hours(1));
+    exam.setEndTime(now + std::chrono::hours(1));
+    setUpRoom(exam, 4, 5, 3);
+    for (int id = 1; id <= 20; ++id) {
+        exam.addStudent(Student(id, "Student", "2002-01-01", "pic.jpg"));
+    }
+
+    // Same ID remainders, so the old ID-based rule would have handed out one version
+    ASSERT_NE(exam.checkIn(3), nullptr);
+    exam.checkInBatch({6, 9, 12}, now);
+    for (int id : {3, 6, 9, 12}) {
+        Student *s = exam.getStudentByID(id);
+        ASSERT_TRUE(s->hasSeat());
+        EXPECT_EQ(s->getExamVersion(), exam.getSeatVersion(s->getSeatRow(), s->getSeatCol()));
+    }
+    EXPECT_NE(exam.getStudentByID(3)->getExamVersion(), exam.getStudentByID(6)->getExamVersion());
+}
+
+// Test case: The plan for a hall of several thousand seats takes milliseconds
+TEST(ExamVersionPlanTest, LargeHallPlansQuickly) {
+    Exam exam;
+    auto start = std::chrono::steady_clock::now();
+    setUpRoom(exam, 100, 80, 5);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_LT(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count(), 50);
+    EXPECT_NE(exam.getSeatVersion(99, 79), exam.getSeatVersion(99, 78));
+}
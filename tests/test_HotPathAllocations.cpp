@@ -0,0 +1,257 @@
+/**
+ * @file HotPathAllocationsTest.cpp
+ * @brief Allocation tests for the check-in, break and submission paths of the Exam class.
+ *
+ * This file replaces the global operator new with one that counts the
+ * allocations made by the calling thread while counting is switched on. It
+ * verifies that once an exam is loaded, checking students in, toggling breaks,
+ * submitting and reading names, codes and incidents allocate nothing, also in
+ * an exam opened through the session manager with its journal and desk log
+ * listening, that allocations are left to the functions that format messages
+ * for the desk,
+ * that times formatted into caller buffers allocate nothing, and that loading
+ * a roster file allocates nothing per row beyond the roster index.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <new>
+#include <string>
+#include "Exam.h"
+#include "ExamDataLoader.h"
+#include "SessionManager.h"
+#include "Utils.h"
+
+namespace {
+thread_local bool counting = false;
+thread_local std::size_t allocations = 0;
+
+// Counts the allocations made by this thread while it is alive
+class AllocationCounter {
+public:
+    AllocationCounter() {
+        allocations = 0;
+        counting = true;
+    }
+    ~AllocationCounter() { counting = false; }
+    std::size_t count() const { return allocations; }
+};
+}
+
+void *operator new(std::size_t size) {
+    if (counting) allocations++;
+    if (void *p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+// Not inlined, so the compiler does not pair malloc with operator new at call sites
+[[gnu::noinline]] void operator delete(void *p) noexcept {
+    std::free(p);
+}
+
+[[gnu::noinline]] void operator delete(void *p, std::size_t) noexcept {
+    std::free(p);
+}
+
+// Test fixture for the allocation tests
+class HotPathAllocationsTest : public ::testing::Test {
+protected:
+    static const int NUM_STUDENTS = 300;
+    Exam exam;
+
+    void SetUp() override {
+        auto now = std::chrono::system_clock::now();
+        exam.setStartTime(now - std::chrono::hours(2));
+        exam.setEndTime(now + std::chrono::hours(1));
+        exam.setCourseNum("CS3307");
+        exam.setMaxRow(20);
+        exam.setMaxCol(20);
+        exam.setNumVersions(4);
+        exam.setVersionsCode({11, 22, 33, 44});
+        exam.initializeSeatMap();
+        exam.reserveRoster(NUM_STUDENTS);
+        // Room for every event the tests make, incident included, so the log never has to grow
+        exam.getEventLog().reserve(4 * NUM_STUDENTS + 1);
+        for (int id = 1; id <= NUM_STUDENTS; ++id) {
+            exam.addStudent(Student(id, "Student with a name too long for short string storage", "2002-01-01",
+                                    "photos/student.jpg"));
+        }
+        exam.addProctor(Proctor(90, "Ada Proctor", "1980-01-01", "p.jpg", "TA"));
+        exam.writeIncident(7, 90, "Phone on desk", IncidentCategory::UnauthorizedMaterial);
+    }
+};
+
+// Test case: State changes and getters allocate nothing once the exam is loaded
+TEST_F(HotPathAllocationsTest, StateChangesDoNotAllocate) {
+    auto at = std::chrono::system_clock::now();
+    std::size_t nameBytes = 0, checkedIn = 0, toggled = 0, submitted = 0;
+    std::size_t count;
+    {
+        AllocationCounter counter;
+        for (int id = 1; id <= NUM_STUDENTS; ++id) {
+            if (exam.checkIn(id)) checkedIn++;
+        }
+        for (int id = 1; id <= NUM_STUDENTS; ++id) {
+            if (exam.toggleBreak(id, at) == BatchStatus::BreakStarted) toggled++;
+        }
+        for (int id = 1; id <= NUM_STUDENTS; ++id) {
+            if (exam.toggleBreak(id, at + std::chrono::minutes(5)) == BatchStatus::BreakEnded) toggled++;
+        }
+        for (int id = 1; id <= NUM_STUDENTS; ++id) {
+            if (exam.earlySubmission(id)) submitted++;
+            nameBytes += exam.getStudentByID(id)->getName().size();
+        }
+        nameBytes += exam.getCourseNum().size() + exam.getVersionsCode().size() +
+                     exam.getIncidents().forStudent(7).size() + exam.getProctorByID(90)->getRole().size();
+        count = counter.count();
+    }
+
+    EXPECT_EQ(count, 0u);
+    EXPECT_EQ(checkedIn, static_cast<std::size_t>(NUM_STUDENTS));
+    EXPECT_EQ(toggled, static_cast<std::size_t>(2 * NUM_STUDENTS));
+    EXPECT_EQ(submitted, static_cast<std::size_t>(NUM_STUDENTS));
+    EXPECT_GT(nameBytes, 0u);
+}
+
+// Test case: The journal and desk log listeners of a desk session allocate nothing either
+TEST_F(HotPathAllocationsTest, SessionListenersDoNotAllocate) {
+    std::filesystem::path dir = std::filesystem::temp_directory_path() /
+                                ("exam_alloc_session_" +
+                                 std::to_string(::testing::UnitTest::GetInstance()->random_seed()));
+    std::filesystem::create_directories(dir);
+    std::string dataPath = (dir / "exam.txt").string();
+    {
+        std::ofstream out(dataPath);
+        out << "1251\nWinter 26\nCS3307\nMC110\n" << NUM_STUDENTS << "\n20\n20\n2\n11,22\n"
+            << "2026-01-01T09:00:00\n2099-01-01T12:00:00\nProctor\n900, Ada Proctor, 1980-01-01, p.jpg, TA\nStudent\n";
+        for (int id = 1; id <= NUM_STUDENTS; ++id) {
+            out << id << ", Student with a name too long for short string storage, 2002-01-01, p.jpg\n";
+        }
+    }
+
+    std::size_t checkedIn = 0, submitted = 0, count;
+    {
+        SessionManager manager(dir.string());
+        ExamSession *session = manager.openExam(dataPath);
+        ASSERT_NE(session, nullptr);
+        ASSERT_TRUE(session->journal->isOpen());
+        Exam &desk = *session->exam;
+        desk.getEventLog().reserve(2 * NUM_STUDENTS);
+
+        // Breaks are left out: the break monitor arms a timer for each one
+        {
+            AllocationCounter counter;
+            for (int id = 1; id <= NUM_STUDENTS; ++id) {
+                if (desk.checkIn(id)) checkedIn++;
+            }
+            for (int id = 1; id <= NUM_STUDENTS; ++id) {
+                if (desk.earlySubmission(id)) submitted++;
+            }
+            count = counter.count();
+        }
+        EXPECT_TRUE(session->journal->flush());
+    }
+
+    // Both listeners still saw every event once the writers caught up
+    JournalInfo journal = ExamJournal::inspect((dir / "exam-CS3307-MC110.journal").string());
+    std::ifstream deskLog(dir / "exam-desk.log");
+    std::string line;
+    std::size_t deskLines = 0;
+    while (std::getline(deskLog, line)) deskLines += line.find("[CS3307-MC110] student") != std::string::npos;
+    std::filesystem::remove_all(dir);
+
+    EXPECT_EQ(count, 0u);
+    EXPECT_EQ(checkedIn, static_cast<std::size_t>(NUM_STUDENTS));
+    EXPECT_EQ(submitted, static_cast<std::size_t>(NUM_STUDENTS));
+    EXPECT_EQ(journal.events, static_cast<std::size_t>(2 * NUM_STUDENTS));
+    EXPECT_EQ(deskLines, static_cast<std::size_t>(2 * NUM_STUDENTS));
+}
+
+// Test case: Messages for the desk are formatted apart from the state change
+TEST_F(HotPathAllocationsTest, FormattingIsSeparate) {
+    auto at = std::chrono::system_clock::now();
+    exam.checkIn(1);
+
+    BatchStatus status;
+    std::size_t toggleCount, formatCount;
+    std::string message;
+    {
+        AllocationCounter counter;
+        status = exam.toggleBreak(1, at);
+        toggleCount = counter.count();
+    }
+    {
+        AllocationCounter counter;
+        message = exam.describeBreak(1, status, at);
+        formatCount = counter.count();
+    }
+
+    EXPECT_EQ(status, BatchStatus::BreakStarted);
+    EXPECT_EQ(toggleCount, 0u);
+    EXPECT_GT(formatCount, 0u) << "The counting hook is not installed";
+    EXPECT_NE(message.find("Leaving for break"), std::string::npos);
+
+    // The desk wrapper still toggles and describes in one call
+    EXPECT_NE(exam.washroomBreak(1).find("Returned from break"), std::string::npos);
+    EXPECT_EQ(exam.describeBreak(999, exam.toggleBreak(999, at), at),
+              "Invalid student number or student is ineligible for a break.");
+}
+
+// Test case: Times are formatted into caller buffers without allocating
+TEST_F(HotPathAllocationsTest, TimeFormattingDoesNotAllocate) {
+    auto at = std::chrono::system_clock::now();
+    char clock[CLOCK_TEXT_SIZE];
+    char stamp[TIMESTAMP_TEXT_SIZE];
+    formatTimestamp(at, stamp);   // Loads the time zone and caches today's offset
+
+    std::size_t length = 0, count;
+    {
+        AllocationCounter counter;
+        for (int i = 0; i < NUM_STUDENTS; ++i) {
+            length += formatClockTime(at + std::chrono::seconds(i), clock);
+            length += formatTimestamp(at + std::chrono::seconds(i), stamp);
+        }
+        count = counter.count();
+    }
+    EXPECT_EQ(count, 0u);
+    EXPECT_EQ(length, static_cast<std::size_t>(NUM_STUDENTS) * 27);
+}
+
+// Test case: Loading a roster file allocates nothing per row beyond the student index
+TEST_F(HotPathAllocationsTest, LoadingAllocatesOnlyForTheIndex) {
+    const int rows = 2000;
+    std::filesystem::path path = std::filesystem::temp_directory_path() /
+                                 ("exam_alloc_test_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) +
+                                  ".txt");
+    {
+        std::ofstream out(path);
+        out << "1251\nWinter 26\nCS3307\nMC110\n" << rows << "\n50\n50\n2\n11,22\n"
+            << "2026-01-01T09:00:00\n2026-01-01T12:00:00\nProctor\n900, Ada Proctor, 1980-01-01, p.jpg, TA\nStudent\n";
+        for (int i = 0; i < rows; ++i) {
+            out << 251000000 + i << ", Student with a long name " << i << ", 2002-01-0" << 1 + i % 9
+                << ", /mnt/exports/photos/" << 251000000 + i << ".jpg\n";
+        }
+    }
+
+    Exam loaded;
+    bool ok;
+    std::size_t count;
+    {
+        AllocationCounter counter;
+        ok = ExamDataLoader::loadExamData(path.string(), loaded);
+        count = counter.count();
+    }
+    std::filesystem::remove(path);
+
+    ASSERT_TRUE(ok);
+    EXPECT_EQ(loaded.getStudents().size(), static_cast<std::size_t>(rows));
+    // One node per row for the ID index, plus a fixed number for the header, reservations and pool blocks
+    EXPECT_LT(count, static_cast<std::size_t>(rows) + 100);
+}
@@ -0,0 +1,116 @@
+/**
+ * @file IncidentStoreTest.cpp
+ * @brief Unit tests for the IncidentStore class and the incidents of an exam.
+ *
+ * This file contains Google Test cases for typed incident records, verifying
+ * that incidents are indexed by student and by proctor and returned as views
+ * in the order they were logged, that categories are counted and named, that
+ * an exam keeps the category and time of every incident it logs, and that
+ * incidents can be copied while a station is still logging them.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "Exam.h"
+#include "IncidentStore.h"
+#include "TestRoster.h"
+
+// Test case: Incidents are indexed by student and by proctor, in the order they were logged
+TEST(IncidentStoreTest, IndexesByStudentAndProctor) {
+    IncidentStore store;
+    auto now = std::chrono::system_clock::now();
+    store.add(Incident{7, 90, now, IncidentCategory::AcademicMisconduct, "Talking"});
+    store.add(Incident{8, 91, now, IncidentCategory::General, "Late"});
+    store.add(Incident{7, 91, now, IncidentCategory::UnauthorizedMaterial, "Phone"});
+
+    EXPECT_EQ(store.size(), 3u);
+    ASSERT_EQ(store.forStudent(7).size(), 2u);
+    EXPECT_EQ(store.forStudent(7)[0].message, "Talking");
+    EXPECT_EQ(store.forStudent(7)[1].message, "Phone");
+    EXPECT_TRUE(store.forStudent(9).empty());
+
+    std::vector<std::string> messages;
+    for (const Incident &incident : store.forProctor(91)) messages.push_back(incident.message);
+    EXPECT_EQ(messages, (std::vector<std::string>{"Late", "Phone"}));
+
+    // Views refer to the store instead of copying it
+    EXPECT_EQ(&store.forStudent(8)[0], &store.all()[1]);
+
+    store.clear();
+    EXPECT_TRUE(store.empty());
+    EXPECT_TRUE(store.forStudent(7).empty());
+}
+
+// Test case: Categories are counted, named and read back safely from stored codes
+TEST(IncidentStoreTest, CountsAndNamesCategories) {
+    IncidentStore store;
+    auto now = std::chrono::system_clock::now();
+    for (int i = 0; i < 1000; ++i) {
+        store.add(Incident{i % 50, 90 + i % 3, now, incidentCategoryFromCode(i % INCIDENT_CATEGORY_COUNT), "Note"});
+    }
+    for (int code = 0; code < INCIDENT_CATEGORY_COUNT; ++code) {
+        EXPECT_EQ(store.countOf(incidentCategoryFromCode(code)), 200u);
+    }
+    EXPECT_EQ(store.forStudent(3).size(), 20u);
+    EXPECT_EQ(store.forProctor(92).size(), 333u);
+
+    EXPECT_STREQ(incidentCategoryName(IncidentCategory::Medical), "Medical");
+    EXPECT_EQ(incidentCategoryFromCode(99), IncidentCategory::General) << "Unknown codes are read as General";
+    EXPECT_EQ(Incident({7, 90, now, IncidentCategory::Disruption, "Noise"}).describe(),
+              "Student: 7; Proctor: 90; Category: Disruption; Message: Noise");
+}
+
+// Test case: An exam stores typed incidents with their category and time
+TEST(IncidentStoreTest, ExamLogsTypedIncidents) {
+    Exam exam;
+    exam.setMaxRow(5);
+    exam.setMaxCol(5);
+    exam.initializeSeatMap();
+    exam.addStudent(Student(1, "Student", "2002-01-01", "pic.jpg"));
+    exam.addProctor(Proctor(90, "Ada Proctor", "1980-01-01", "p.jpg", "TA"));
+
+    auto before = std::chrono::system_clock::now();
+    exam.writeIncident(1, 90, "Phone rang", IncidentCategory::UnauthorizedMaterial);
+    exam.writeIncident(1, 90, "Left the room");
+
+    const IncidentStore &incidents = exam.getIncidents();
+    ASSERT_EQ(incidents.size(), 2u);
+    EXPECT_EQ(incidents.all()[0].category, IncidentCategory::UnauthorizedMaterial);
+    EXPECT_EQ(incidents.all()[1].category, IncidentCategory::General);
+    EXPECT_GE(incidents.all()[0].at, before - std::chrono::microseconds(1));
+    EXPECT_EQ(incidents.forStudent(1).size(), 2u);
+    EXPECT_EQ(incidents.forProctor(90).size(), 2u);
+    EXPECT_EQ(exam.getStats().incidents, 2);
+
+    // A station's report keeps the time the station received it
+    auto reported = before - std::chrono::minutes(3);
+    exam.writeIncident(1, 90, "Talking", IncidentCategory::AcademicMisconduct, reported);
+    ASSERT_EQ(incidents.size(), 3u);
+    EXPECT_EQ(std::chrono::time_point_cast<std::chrono::microseconds>(incidents.all()[2].at),
+              std::chrono::time_point_cast<std::chrono::microseconds>(reported));
+}
+
+// Test case: Incidents copied while a station logs more are a prefix of the final list
+TEST(IncidentStoreTest, CopyWhileLogging) {
+    auto exam = RosterBuilder().build();
+    std::thread station([&exam] {
+        for (int i = 0; i < 2000; ++i) exam->writeIncident(1 + i % 8, 90, "Incident " + std::to_string(i));
+    });
+    std::size_t lastSize = 0;
+    for (int read = 0; read < 200; ++read) {
+        std::vector<Incident> copy = exam->copyIncidents();
+        EXPECT_GE(copy.size(), lastSize);
+        if (!copy.empty()) {
+            EXPECT_EQ(copy.back().message, "Incident " + std::to_string(copy.size() - 1));
+        }
+        lastSize = copy.size();
+    }
+    station.join();
+    EXPECT_EQ(exam->copyIncidents().size(), 2000u);
+}
@@ -0,0 +1,100 @@
+/**
+ * @file IsoTimestampTest.cpp
+ * @brief Unit tests for the ISO 8601 parser in Utils.h.
+ *
+ * This file contains Google Test cases for parseIsoTimestamp and
+ * stringToTimePoint, verifying that UTC offsets and fractional seconds are
+ * applied, that local times round-trip through the formatters across the
+ * daylight saving changes of a zone that has them, and that malformed text is
+ * rejected.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <stdexcept>
+#include <string>
+#include "Utils.h"
+
+using std::chrono::system_clock;
+
+// Test fixture that switches to a zone with daylight saving time and back
+class IsoTimestampTest : public ::testing::Test {
+protected:
+    std::string savedTZ;
+    bool hadTZ = false;
+
+    void SetUp() override {
+        if (const char *tz = std::getenv("TZ")) {
+            hadTZ = true;
+            savedTZ = tz;
+        }
+        setenv("TZ", "America/Toronto", 1);
+        refreshLocalTimeZone();
+    }
+
+    void TearDown() override {
+        if (hadTZ) {
+            setenv("TZ", savedTZ.c_str(), 1);
+        } else {
+            unsetenv("TZ");
+        }
+        refreshLocalTimeZone();
+    }
+
+    static system_clock::time_point parse(const std::string &text) {
+        system_clock::time_point tp;
+        EXPECT_TRUE(parseIsoTimestamp(text, tp)) << text;
+        return tp;
+    }
+};
+
+// Test case: UTC offsets and fractional seconds are applied
+TEST_F(IsoTimestampTest, OffsetsAndFractions) {
+    system_clock::time_point utc = system_clock::from_time_t(1790000000);   // 2026-09-21 14:13:20 UTC
+    EXPECT_EQ(parse("2026-09-21T14:13:20Z"), utc);
+    EXPECT_EQ(parse("2026-09-21t14:13:20z"), utc);
+    EXPECT_EQ(parse("2026-09-21T19:43:20+05:30"), utc);
+    EXPECT_EQ(parse("2026-09-21T10:13:20-0400"), utc);
+    EXPECT_EQ(parse("2026-09-21 15:13:20+01"), utc);
+    EXPECT_EQ(parse("  2026-09-21T14:13Z  "), utc - std::chrono::seconds(20));
+    EXPECT_EQ(parse("2026-09-21T14:13:20.25Z"), utc + std::chrono::milliseconds(250));
+    EXPECT_EQ(parse("2026-09-21T14:13:20,000001Z"), utc + std::chrono::microseconds(1));
+    EXPECT_EQ(parse("2024-02-29T00:00:00Z"), system_clock::from_time_t(1709164800));
+}
+
+// Test case: Local times use the offset in effect then, daylight saving included
+TEST_F(IsoTimestampTest, LocalTimesRoundTrip) {
+    // 10:13:20 in September is daylight time, four hours behind UTC
+    EXPECT_EQ(parse("2026-09-21T10:13:20"), system_clock::from_time_t(1790000000));
+    EXPECT_EQ(stringToTimePoint("2026-01-15T09:00:00"), parse("2026-01-15T14:00:00Z"));
+
+    char stamp[TIMESTAMP_TEXT_SIZE];
+    for (std::time_t start : {std::time_t(1772928000), std::time_t(1793491200)}) {   // 2026-03-08, 2026-11-01
+        for (std::time_t t = start - 86400; t < start + 2 * 86400; t += 433) {
+            std::string local(stamp, formatTimestamp(system_clock::from_time_t(t), stamp, 'T'));
+            system_clock::time_point parsed = parse(local);
+            ASSERT_EQ(std::string(stamp, formatTimestamp(parsed, stamp, 'T')), local);
+        }
+    }
+}
+
+// Test case: Malformed or impossible times are rejected
+TEST_F(IsoTimestampTest, RejectsMalformedText) {
+    system_clock::time_point untouched = system_clock::from_time_t(42);
+    for (const char *text : {"", "2026-09-21", "2026-9-21T10:00:00", "2026-09-21X10:00:00", "2026-13-01T10:00:00",
+                             "2026-02-29T10:00:00", "2026-04-31T10:00:00", "2026-09-21T24:00:00",
+                             "2026-09-21T10:60:00", "2026-09-21T10:00:00.", "2026-09-21T10:00:00+5",
+                             "2026-09-21T10:00:00+05:3", "2026-09-21T10:00:00 extra", "2026-09-21T10:00:00Zulu",
+                             "2026-09-21T10:00:00Z+05:00", "2026-09-21T10:00:00z-0400"}) {
+        system_clock::time_point tp = untouched;
+        EXPECT_FALSE(parseIsoTimestamp(text, tp)) << text;
+        EXPECT_EQ(tp, untouched) << text;
+    }
+    EXPECT_THROW(stringToTimePoint("not a time"), std::runtime_error);
+}
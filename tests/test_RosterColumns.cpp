@@ -0,0 +1,122 @@
+/**
+ * @file RosterColumnsTest.cpp
+ * @brief Unit tests for the RosterColumns class.
+ *
+ * This file contains Google Test cases for the RosterColumns class, verifying
+ * that rows mirror Student state, that the aggregate counts are correct, and
+ * that an exam counts the same with its mirror on as with it off.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-16
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <vector>
+#include "RosterColumns.h"
+#include "TestRoster.h"
+
+// Test fixture for RosterColumns class
+class RosterColumnsTest : public ::testing::Test {
+protected:
+    std::vector<Student> students{
+        {1, "Alice", "2002-09-15", "alice.jpg"},
+        {2, "Bob", "2002-01-20", "bob.jpg"},
+        {3, "Carol", "2001-11-02", "carol.jpg"}
+    };
+    RosterColumns columns;
+};
+
+// Test case: Assign copies every field into its column
+TEST_F(RosterColumnsTest, AssignMirrorsStudents) {
+    students[1].setAttendance(true);
+    students[1].setSeat(2, 5);
+    students[1].setExamVersion(102);
+    columns.assign(students);
+
+    ASSERT_EQ(columns.size(), 3u);
+    EXPECT_EQ(columns.getIDs()[1], 2);
+    EXPECT_EQ(columns.getAttendance()[1], 1);
+    EXPECT_EQ(columns.getVersions()[1], 102);
+    EXPECT_EQ(columns.getSeats()[1], (2 << 16) | 5);
+    EXPECT_EQ(columns.getSeats()[0], -1) << "Students without a seat store -1";
+}
+
+// Test case: Counts follow updates to individual rows
+TEST_F(RosterColumnsTest, CountsFollowUpdates) {
+    columns.assign(students);
+    EXPECT_EQ(columns.countAttended(), 0);
+
+    students[0].setAttendance(true);
+    students[0].leaveForBreak();
+    students[0].returnFromBreak();
+    students[0].submitExam();
+    columns.update(0, students[0]);
+
+    students[2].setAttendance(true);
+    columns.update(2, students[2]);
+
+    EXPECT_EQ(columns.countAttended(), 2);
+    EXPECT_EQ(columns.countSubmitted(), 1);
+    EXPECT_EQ(columns.countBreaks(), 1);
+
+    auto later = std::chrono::system_clock::now() + std::chrono::hours(1);
+    auto earlier = std::chrono::system_clock::now() - std::chrono::hours(1);
+    EXPECT_EQ(columns.countSubmittedBefore(later), 1);
+    EXPECT_EQ(columns.countSubmittedBefore(earlier), 0);
+}
+
+// Test case: Submissions a fraction of a second before the deadline count as early
+TEST_F(RosterColumnsTest, SubmittedBeforeKeepsMicroseconds) {
+    using std::chrono::microseconds;
+    using std::chrono::milliseconds;
+    auto deadline = std::chrono::system_clock::time_point(std::chrono::seconds(1800000000) + milliseconds(700));
+    students[0].setAttendance(true);
+    students[0].submitExam(deadline - milliseconds(200));
+    students[1].setAttendance(true);
+    students[1].submitExam(deadline);
+    columns.assign(students);
+
+    EXPECT_EQ(columns.getSubmissionTimes()[0], 1800000000500000);
+    EXPECT_EQ(columns.countSubmittedBefore(deadline), 1) << "Same second as the deadline, but before it";
+    EXPECT_EQ(columns.countSubmittedBefore(deadline + microseconds(1)), 2);
+    EXPECT_EQ(columns.countSubmittedBefore(deadline - milliseconds(200)), 0);
+}
+
+// Test case: Append adds a row at the end
+TEST_F(RosterColumnsTest, AppendAddsRow) {
+    columns.assign(students);
+    columns.append(Student(4, "Dan", "2000-05-05", "dan.jpg", true, false));
+    ASSERT_EQ(columns.size(), 4u);
+    EXPECT_EQ(columns.getIDs().back(), 4);
+    EXPECT_EQ(columns.countAttended(), 1);
+}
+
+// Test case: The exam's counts agree with or without the mirror, which is off unless asked for
+TEST(ExamRosterColumnsTest, MirrorMatchesRowScan) {
+    auto exam = RosterBuilder().students(6).build();
+    EXPECT_FALSE(exam->isColumnarRoster());
+    EXPECT_EQ(exam->getRosterColumns().size(), 0u);
+
+    auto now = std::chrono::system_clock::now();
+    exam->checkInBatch({1, 2, 3, 4}, now);
+    exam->toggleBreakBatch({2, 3}, now);
+    exam->submitBatch({1, 2}, now);
+    exam->setColumnarRoster(true);
+    exam->toggleBreakBatch({3, 4}, now + std::chrono::minutes(5));
+    exam->submitBatch({4}, now + std::chrono::minutes(6));
+
+    int present = exam->countPresent(), submitted = exam->countSubmitted();
+    int early = exam->countEarlySubmissions(), breaks = exam->countBreaks();
+    EXPECT_EQ(exam->getRosterColumns().size(), 6u);
+    exam->setColumnarRoster(false);
+    EXPECT_EQ(exam->countPresent(), present);
+    EXPECT_EQ(exam->countSubmitted(), submitted);
+    EXPECT_EQ(exam->countEarlySubmissions(), early);
+    EXPECT_EQ(exam->countBreaks(), breaks);
+    EXPECT_EQ(present, 4);
+    EXPECT_EQ(submitted, 3);
+    EXPECT_EQ(early, exam->getStats().earlySubmitted);
+    EXPECT_EQ(breaks, 3);
+}
@@ -0,0 +1,115 @@
+/**
+ * @file SeatAllocatorTest.cpp
+ * @brief Unit tests for the SeatAllocator class.
+ *
+ * This file contains Google Test cases for the SeatAllocator class, verifying
+ * row-major allocation, seat release and reuse, block reservation, and rooms
+ * that span more than one 64-bit word per row.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-16
+ */
+
+#include <gtest/gtest.h>
+#include <set>
+#include <utility>
+#include <vector>
+#include "SeatAllocator.h"
+
+// Test fixture for SeatAllocator class
+class SeatAllocatorTest : public ::testing::Test {
+protected:
+    SeatAllocator seats{3, 4};
+};
+
+// Test case: Seats are handed out in row-major order
+TEST_F(SeatAllocatorTest, AllocatesInRowMajorOrder) {
+    int row = -1, col = -1;
+    for (int expected = 0; expected < 12; ++expected) {
+        ASSERT_TRUE(seats.allocate(row, col));
+        EXPECT_EQ(row, expected / 4);
+        EXPECT_EQ(col, expected % 4);
+    }
+    EXPECT_EQ(seats.getFreeCount(), 0);
+    EXPECT_FALSE(seats.allocate(row, col)) << "A full room should not hand out seats";
+}
+
+// Test case: A released seat is the next one handed out
+TEST_F(SeatAllocatorTest, ReleasedSeatIsReused) {
+    int row, col;
+    for (int i = 0; i < 12; ++i) seats.allocate(row, col);
+
+    EXPECT_TRUE(seats.release(1, 2));
+    EXPECT_FALSE(seats.release(1, 2)) << "Releasing a free seat should fail";
+    EXPECT_FALSE(seats.isTaken(1, 2));
+
+    ASSERT_TRUE(seats.allocate(row, col));
+    EXPECT_EQ(row, 1);
+    EXPECT_EQ(col, 2);
+}
+
+// Test case: A batch allocation fills seats in the same order as single calls
+TEST_F(SeatAllocatorTest, AllocateManyInOnePass) {
+    seats.reserve(0, 1);
+    std::vector<int> rows, cols;
+    EXPECT_EQ(seats.allocateMany(5, rows, cols), 5);
+    ASSERT_EQ(rows.size(), 5u);
+    EXPECT_EQ(rows, (std::vector<int>{0, 0, 0, 1, 1}));
+    EXPECT_EQ(cols, (std::vector<int>{0, 2, 3, 0, 1}));
+
+    rows.clear();
+    cols.clear();
+    EXPECT_EQ(seats.allocateMany(20, rows, cols), 6) << "Only the remaining seats can be taken";
+    EXPECT_EQ(seats.getFreeCount(), 0);
+}
+
+// Test case: Specific seats can be reserved only once
+TEST_F(SeatAllocatorTest, ReserveSpecificSeat) {
+    EXPECT_TRUE(seats.reserve(0, 0));
+    EXPECT_FALSE(seats.reserve(0, 0));
+    EXPECT_FALSE(seats.reserve(5, 0)) << "Out-of-range seats cannot be reserved";
+
+    int row, col;
+    ASSERT_TRUE(seats.allocate(row, col));
+    EXPECT_EQ(row, 0);
+    EXPECT_EQ(col, 1);
+}
+
+// Test case: Blocks must fit inside a single row
+TEST_F(SeatAllocatorTest, ReserveBlockSkipsFragmentedRows) {
+    seats.reserve(0, 1);   // Row 0 only has runs of 1 and 2
+    int row, col;
+    ASSERT_TRUE(seats.reserveBlock(3, row, col));
+    EXPECT_EQ(row, 1);
+    EXPECT_EQ(col, 0);
+
+    ASSERT_TRUE(seats.reserveBlock(2, row, col));
+    EXPECT_EQ(row, 0);
+    EXPECT_EQ(col, 2);
+
+    EXPECT_FALSE(seats.reserveBlock(5, row, col)) << "Blocks wider than a row cannot fit";
+    EXPECT_EQ(seats.getFreeCount(), 12 - 1 - 3 - 2);
+}
+
+// Test case: Rows wider than one word allocate and release past the word boundary
+TEST(SeatAllocatorLargeRoomTest, GymSizedRoom) {
+    SeatAllocator gym(50, 100);   // 5,000 seats, two words per row
+    std::set<std::pair<int, int>> assigned;
+    int row, col;
+    while (gym.allocate(row, col)) {
+        EXPECT_TRUE(assigned.insert({row, col}).second) << "Seat handed out twice";
+    }
+    EXPECT_EQ(assigned.size(), 5000u);
+
+    EXPECT_TRUE(gym.release(49, 99));
+    EXPECT_TRUE(gym.release(20, 63));
+    EXPECT_TRUE(gym.release(20, 64));
+    ASSERT_TRUE(gym.reserveBlock(2, row, col));
+    EXPECT_EQ(row, 20);
+    EXPECT_EQ(col, 63);
+
+    ASSERT_TRUE(gym.allocate(row, col));
+    EXPECT_EQ(row, 49);
+    EXPECT_EQ(col, 99);
+}
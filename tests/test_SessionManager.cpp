@@ -0,0 +1,385 @@
+/**
+ * @file SessionManagerTest.cpp
+ * @brief Unit tests for the SessionManager, PhotoCache and ThreadPool classes.
+ *
+ * This file contains Google Test cases for running several exams in one
+ * process, verifying that sessions are independent and can be switched, that
+ * station input reaches its own exam whichever session is shown, that a
+ * session is not closed under a station still using it, that desk log lines
+ * carry the time of their event, that they share one thread pool and photo
+ * cache, that snapshots skip sessions with nothing new, that unfinished
+ * sessions are recovered from their journals and snapshots, that exams submit
+ * themselves at their deadlines and stay recoverable until the last of them,
+ * and that the photo cache evicts least recently used photos.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <thread>
+#include "ExamSnapshot.h"
+#include "SessionManager.h"
+#include "TestRoster.h"
+#include "Utils.h"
+
+// Test fixture for SessionManager class
+class SessionManagerTest : public ::testing::Test {
+protected:
+    std::filesystem::path dir;
+
+    void SetUp() override {
+        dir = std::filesystem::temp_directory_path() /
+              ("exam_session_test_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) + "_" +
+               ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(dir);
+    }
+
+    // Writes an exam data file whose students have 100-byte photos in dir
+    std::string writeExam(const std::string &course, const std::string &room, int firstID, int numStudents,
+                          const std::string &endTime = "2099-01-01T12:00:00") {
+        std::string path = (dir / (course + room + ".txt")).string();
+        std::ofstream out(path);
+        out << "1251 ;; Term number\nWinter 26 ;; Term name\n" << course << " ;; Course number\n"
+            << room << " ;; Exam Rm\n100 ;; Max seat\n10 ;; Rows\n10 ;; Colum\n2 ;; number of versions\n"
+            << "11,22 ;; code of versions\n2026-01-01T09:00:00 ;; Start time\n" << endTime << " ;; End time\n"
+            << "Proctor ;; List of Proctor\n900, Ada Proctor, 1980-01-01, p.jpg, TA\nStudent ;; List of Student\n";
+        for (int i = 0; i < numStudents; ++i) {
+            std::string photo = (dir / (std::to_string(firstID + i) + ".jpg")).string();
+            std::ofstream(photo, std::ios::binary) << std::string(100, 'x');
+            // Every tenth student has 30 minutes of extra time
+            out << firstID + i << ", Student " << i << ", 2002-01-01, " << photo << (i % 10 == 9 ? ", 30" : "") << "\n";
+        }
+        return path;
+    }
+};
+
+// Test case: Exams open side by side, stay independent and can be switched
+TEST_F(SessionManagerTest, OpenSeveralExamsAndSwitch) {
+    SessionManager manager(dir.string());
+    ExamSession *first = manager.openExam(writeExam("CS3307", "MC110", 1000, 20));
+    ASSERT_NE(first, nullptr);
+    ExamSession *second = manager.openExam(writeExam("CS2212", "AH15", 2000, 30));
+    ASSERT_NE(second, nullptr);
+
+    EXPECT_EQ(manager.getSessionCount(), 2u);
+    EXPECT_EQ(manager.getActiveSession(), second) << "A newly opened exam becomes the active one";
+    EXPECT_EQ(first->key, "CS3307-MC110");
+    EXPECT_EQ(manager.openExam(writeExam("CS3307", "MC110", 3000, 5)), nullptr)
+        << "The same course and room cannot be opened twice";
+
+    StudentRoute route;
+    ASSERT_TRUE(manager.getRouter().route(2005, std::chrono::system_clock::now(), route));
+    EXPECT_EQ(route.examKey, "CS2212-AH15") << "The shared router spans every open exam";
+
+    ASSERT_TRUE(manager.setActiveSession(0));
+    EXPECT_EQ(manager.getActiveSession(), first);
+    EXPECT_FALSE(manager.setActiveSession(2));
+
+    ASSERT_NE(first->exam->checkIn(1000), nullptr);
+    EXPECT_EQ(first->exam->checkIn(2000), nullptr) << "Students belong to one exam only";
+    ASSERT_NE(second->exam->checkIn(2000), nullptr);
+    second->exam->checkIn(2001);
+    EXPECT_EQ(first->exam->getStats().checkedIn, 1);
+    EXPECT_EQ(second->exam->getStats().checkedIn, 2);
+
+    manager.closeSession(0, true);
+    EXPECT_EQ(manager.getSessionCount(), 1u);
+    EXPECT_EQ(manager.getActiveSession(), second);
+    EXPECT_FALSE(manager.getRouter().route(1000, std::chrono::system_clock::now(), route));
+    EXPECT_TRUE(ExamJournal::inspect(dir.string() + "/exam-CS3307-MC110.journal").finished);
+}
+
+// Test case: Station input finds its exam by key or by student, whichever session the desk shows
+TEST_F(SessionManagerTest, StationInputIgnoresActiveSession) {
+    SessionManager manager(dir.string());
+    ExamSession *first = manager.openExam(writeExam("CS3307", "MC110", 1000, 20));
+    ExamSession *second = manager.openExam(writeExam("CS2212", "AH15", 2000, 30));
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    auto now = std::chrono::system_clock::now();
+
+    for (std::size_t active : {0u, 1u}) {
+        ASSERT_TRUE(manager.setActiveSession(active));
+        EXPECT_EQ(manager.findExam("CS3307-MC110", 1000, now), first->exam.get());
+        EXPECT_EQ(manager.findExam("CS2212-AH15", 1000, now), second->exam.get())
+            << "A named session is used even if the student is not on its roster";
+        EXPECT_EQ(manager.findExam("", 2005, now), second->exam.get());
+        EXPECT_EQ(manager.findExam("", 1005, now), first->exam.get());
+    }
+    EXPECT_EQ(manager.findExam("CS1026-NS1", 1000, now), nullptr);
+    EXPECT_EQ(manager.findExam("", 9999, now), nullptr);
+
+    manager.closeSession(0, false);
+    EXPECT_EQ(manager.findExam("CS3307-MC110", 1000, now), nullptr) << "Closed sessions take no more input";
+}
+
+// Test case: Closing a session waits for a station thread still using its exam
+TEST_F(SessionManagerTest, CloseWaitsForStationUsingExam) {
+    SessionManager manager(dir.string());
+    ASSERT_NE(manager.openExam(writeExam("CS3307", "MC110", 1000, 20)), nullptr);
+    auto now = std::chrono::system_clock::now();
+
+    std::atomic<bool> found{false}, release{false}, closed{false};
+    std::thread station([&] {
+        auto inUse = manager.holdExams();
+        Exam *exam = manager.findExam("CS3307-MC110", 1000, now);
+        found = exam != nullptr;
+        while (!release) std::this_thread::yield();
+        // Still open: the close is waiting for this thread
+        EXPECT_FALSE(closed.load());
+        EXPECT_NE(exam->checkIn(1000), nullptr);
+    });
+    while (!found) std::this_thread::yield();
+
+    std::thread closer([&] {
+        manager.closeSession(0, false);
+        closed = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(closed.load()) << "The exam was closed while a station was using it";
+    EXPECT_EQ(manager.findExam("CS3307-MC110", 1000, now), nullptr) << "Already out of the router";
+    release = true;
+    station.join();
+    closer.join();
+    EXPECT_TRUE(closed.load());
+    EXPECT_EQ(manager.getSessionCount(), 0u);
+}
+
+// Test case: Desk log lines for events carry the time of the event, not the time it was applied
+TEST_F(SessionManagerTest, DeskLogStampsEventsWithTheirTime) {
+    auto received = std::chrono::system_clock::now() - std::chrono::hours(3);
+    {
+        SessionManager manager(dir.string());
+        ExamSession *session = manager.openExam(writeExam("CS3307", "MC110", 1000, 20));
+        ASSERT_NE(session, nullptr);
+        session->exam->checkInBatch({1000}, received);
+    }   // The desk log writes every queued line before it closes
+
+    std::ifstream in(dir / "exam-desk.log");
+    std::string line, checkIn;
+    while (std::getline(in, line)) {
+        if (line.find("student 1000: checked in") != std::string::npos) checkIn = line;
+    }
+    ASSERT_FALSE(checkIn.empty());
+    EXPECT_EQ(checkIn.rfind(timePointToString(received), 0), 0u) << checkIn;
+}
+
+// Test case: Every exam uses the same pool and photo cache
+TEST_F(SessionManagerTest, SessionsShareOnePoolAndCache) {
+    SessionManager manager(dir.string(), 2);
+    manager.openExam(writeExam("CS3307", "MC110", 1000, 20));
+    manager.openExam(writeExam("CS2212", "AH15", 2000, 30));
+    manager.getThreadPool().waitIdle();
+
+    EXPECT_EQ(manager.getThreadPool().size(), 2u);
+    PhotoCache &photos = manager.getPhotoCache();
+    EXPECT_EQ(photos.getBytesUsed(), 50u * 100u) << "Photos of both rosters are prefetched";
+
+    std::uint64_t hitsBefore = photos.getHitCount();
+    auto bytes = photos.get((dir / "2005.jpg").string());
+    ASSERT_NE(bytes, nullptr);
+    EXPECT_EQ(bytes->size(), 100u);
+    EXPECT_EQ(photos.getHitCount(), hitsBefore + 1);
+}
+
+// Test case: Sessions left open by a crash are found and rebuilt from snapshot plus journal
+TEST_F(SessionManagerTest, RecoverUnfinishedSessions) {
+    {
+        SessionManager manager(dir.string());
+        ExamSession *a = manager.openExam(writeExam("CS3307", "MC110", 1000, 20));
+        ExamSession *b = manager.openExam(writeExam("CS2212", "AH15", 2000, 30));
+        ASSERT_NE(a, nullptr);
+        ASSERT_NE(b, nullptr);
+        a->exam->checkInBatch({1000, 1001, 1002}, std::chrono::system_clock::now());
+        b->exam->checkIn(2000);
+
+        manager.snapshotAll();
+        manager.getThreadPool().waitIdle();
+        EXPECT_TRUE(std::filesystem::exists(a->snapshotPath));
+
+        // Only in the journals
+        a->exam->washroomBreak(1001);
+        b->exam->writeIncident(2000, 900, "Late arrival");
+        // The exams end in 2099, so the manager leaves both journals unfinished
+    }
+
+    SessionManager manager(dir.string());
+    std::vector<std::string> unfinished = manager.findUnfinishedJournals();
+    ASSERT_EQ(unfinished.size(), 2u);
+    for (const std::string &journal : unfinished) {
+        ASSERT_NE(manager.recoverExam(journal), nullptr) << journal;
+    }
+
+    ExamSession *a = manager.getSession(0)->key == "CS3307-MC110" ? manager.getSession(0) : manager.getSession(1);
+    ExamSession *b = a == manager.getSession(0) ? manager.getSession(1) : manager.getSession(0);
+    EXPECT_EQ(a->exam->getStats().checkedIn, 3);
+    EXPECT_TRUE(a->exam->isOnBreak(1001));
+    EXPECT_EQ(b->exam->getStats().checkedIn, 1);
+    EXPECT_EQ(b->exam->getIncidents().size(), 1u);
+
+    // Recovered sessions keep journaling where they left off
+    a->exam->washroomBreak(1001);
+    EXPECT_EQ(a->exam->getEventLog().nextSequence(), 5u);
+}
+
+// Test case: Snapshots are only written for sessions that changed since their last one
+TEST_F(SessionManagerTest, SnapshotAllSkipsUnchangedSessions) {
+    SessionManager manager(dir.string());
+    ExamSession *session = manager.openExam(writeExam("CS3307", "MC110", 1000, 20));
+    ASSERT_NE(session, nullptr);
+    session->exam->checkIn(1000);
+
+    manager.snapshotAll();
+    manager.getThreadPool().waitIdle();
+    SnapshotInfo first = ExamSnapshot::inspect(session->snapshotPath);
+    ASSERT_TRUE(first.found);
+    EXPECT_EQ(first.eventSequence, 1u);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    manager.snapshotAll();
+    manager.getThreadPool().waitIdle();
+    EXPECT_EQ(ExamSnapshot::inspect(session->snapshotPath).takenAt, first.takenAt) << "Nothing new, nothing written";
+
+    session->exam->checkIn(1001);
+    manager.snapshotAll();
+    manager.getThreadPool().waitIdle();
+    SnapshotInfo second = ExamSnapshot::inspect(session->snapshotPath);
+    EXPECT_EQ(second.eventSequence, 2u);
+    EXPECT_GT(second.takenAt, first.takenAt);
+}
+
+// Test case: A snapshot that fails part-way is dropped and the exam is rebuilt from its data file and journal
+TEST_F(SessionManagerTest, BrokenSnapshotFallsBackToDataFile) {
+    std::string snapshotPath, image;
+    std::vector<Student> seated;
+    {
+        SessionManager manager(dir.string());
+        ExamSession *session = manager.openExam(writeExam("CS3307", "MC110", 1000, 20));
+        ASSERT_NE(session, nullptr);
+        session->exam->checkInBatch({1000, 1001, 1002}, std::chrono::system_clock::now());
+        manager.snapshotAll();
+        manager.getThreadPool().waitIdle();
+        session->exam->washroomBreak(1001);
+
+        snapshotPath = session->snapshotPath;
+        std::ifstream in(snapshotPath, std::ios::binary);
+        image.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        seated = {*session->exam->getStudentByID(1000), *session->exam->getStudentByID(1001)};
+    }
+
+    // Student 1001 recorded in 1000's seat: the snapshot loads student 1000, then fails
+    std::string damaged = snapshotWithMovedSeat(image, seated[1], seated[0].getSeatRow(), seated[0].getSeatCol());
+    ASSERT_FALSE(damaged.empty());
+    ASSERT_TRUE(ExamSnapshot::write(snapshotPath, damaged));
+
+    SessionManager manager(dir.string());
+    std::vector<std::string> unfinished = manager.findUnfinishedJournals();
+    ASSERT_EQ(unfinished.size(), 1u);
+    ExamSession *session = manager.recoverExam(unfinished[0]);
+    ASSERT_NE(session, nullptr);
+    EXPECT_EQ(session->exam->getStudents().size(), 20u);
+    EXPECT_EQ(session->exam->getStats().checkedIn, 3) << "Every check-in replayed once, on a clean roster";
+    EXPECT_EQ(session->exam->getSeatAllocator().getFreeCount(), 97);
+    EXPECT_TRUE(session->exam->isOnBreak(1001));
+    EXPECT_EQ(session->exam->getEventLog().nextSequence(), 4u);
+}
+
+// Test case: Exams past their end time are submitted, except students with extra time left
+TEST_F(SessionManagerTest, DeadlinesSubmitExams) {
+    auto now = std::chrono::system_clock::now();
+    std::tm end = toLocalTm(std::chrono::system_clock::to_time_t(now - std::chrono::minutes(5)));
+    std::ostringstream endTime;
+    endTime << std::put_time(&end, "%Y-%m-%dT%H:%M:%S");
+
+    SessionManager manager(dir.string());
+    ExamSession *ended = manager.openExam(writeExam("CS3307", "MC110", 1000, 20, endTime.str()));
+    ExamSession *running = manager.openExam(writeExam("CS2212", "AH15", 2000, 20));
+    ASSERT_NE(ended, nullptr);
+    ASSERT_NE(running, nullptr);
+    EXPECT_EQ(ended->exam->getStudentByID(1009)->getExtraTime(), std::chrono::minutes(30));
+    ended->exam->checkInBatch({1000, 1001, 1009}, now);
+    running->exam->checkIn(2000);
+
+    EXPECT_EQ(manager.advanceDeadlines(now + std::chrono::seconds(1)), 2u);
+    EXPECT_EQ(ended->exam->getStats().submitted, 2);
+    EXPECT_FALSE(ended->exam->getStudentByID(1009)->getSubmissionStatus());
+    EXPECT_EQ(manager.advanceDeadlines(now + std::chrono::minutes(26)), 1u)
+        << "Both extra-time deadlines fire, but only one of those students came";
+    EXPECT_TRUE(ended->exam->getStudentByID(1009)->getSubmissionStatus());
+    EXPECT_EQ(running->exam->getStats().submitted, 0);
+}
+
+// Test case: Quitting while extra time is running leaves the journal open for recovery
+TEST_F(SessionManagerTest, ExtraTimeKeepsJournalUnfinished) {
+    auto now = std::chrono::system_clock::now();
+    std::tm end = toLocalTm(std::chrono::system_clock::to_time_t(now - std::chrono::minutes(5)));
+    std::ostringstream endTime;
+    endTime << std::put_time(&end, "%Y-%m-%dT%H:%M:%S");
+    {
+        SessionManager manager(dir.string());
+        ASSERT_NE(manager.openExam(writeExam("CS3307", "MC110", 1000, 20, endTime.str())), nullptr);
+        ASSERT_NE(manager.openExam(writeExam("CS2212", "AH15", 2000, 5, endTime.str())), nullptr);
+    }
+    EXPECT_FALSE(ExamJournal::inspect(dir.string() + "/exam-CS3307-MC110.journal").finished)
+        << "Student 1009 has 30 minutes of extra time left";
+    EXPECT_TRUE(ExamJournal::inspect(dir.string() + "/exam-CS2212-AH15.journal").finished)
+        << "Nobody in this exam has extra time";
+}
+
+// Test case: The cache keeps the most recently used photos within its byte budget
+TEST(PhotoCacheTest, EvictsLeastRecentlyUsed) {
+    std::filesystem::path dir = std::filesystem::temp_directory_path() / "exam_photo_cache_test";
+    std::filesystem::create_directories(dir);
+    for (int i = 0; i < 4; ++i) {
+        std::ofstream(dir / (std::to_string(i) + ".jpg"), std::ios::binary) << std::string(100, 'a' + i);
+    }
+    auto photo = [&dir](int i) { return (dir / (std::to_string(i) + ".jpg")).string(); };
+
+    PhotoCache cache(250);
+    cache.get(photo(0));
+    cache.get(photo(1));
+    cache.get(photo(0));   // 1 is now the least recently used
+    cache.get(photo(2));
+    EXPECT_EQ(cache.getBytesUsed(), 200u);
+    EXPECT_EQ(cache.getMissCount(), 3u);
+
+    cache.get(photo(0));
+    cache.get(photo(2));
+    EXPECT_EQ(cache.getHitCount(), 3u);
+    cache.get(photo(1));
+    EXPECT_EQ(cache.getMissCount(), 4u) << "Photo 1 was evicted";
+    EXPECT_EQ(cache.get(photo(9)), nullptr) << "Missing photos are not cached";
+
+    std::filesystem::remove_all(dir);
+}
+
+// Test case: Every submitted task runs, and waitIdle() returns once they have
+TEST(ThreadPoolTest, RunsEveryTask) {
+    std::atomic<int> done{0};
+    {
+        ThreadPool pool(3);
+        for (int i = 0; i < 1000; ++i) {
+            pool.submit([&done] { done++; });
+        }
+        pool.waitIdle();
+        EXPECT_EQ(done.load(), 1000);
+        for (int i = 0; i < 10; ++i) {
+            pool.submit([&done] { done++; });
+        }
+    }
+    EXPECT_EQ(done.load(), 1010) << "Queued tasks run before the pool shuts down";
+}
@@ -0,0 +1,95 @@
+/**
+ * @file StringPoolTest.cpp
+ * @brief Unit tests for the StringPool class and the roster text it holds.
+ *
+ * This file contains Google Test cases for the per-exam string pool,
+ * verifying that repeated values and photo directories are stored once, that
+ * users hand out views that survive copies and the end of their exam, that
+ * setters and students added from elsewhere use the exam's pool, and that a
+ * large roster takes far less memory than separately owned strings.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Exam.h"
+#include "StringPool.h"
+
+// Test case: Repeated values and directories are stored once, unique values are only copied
+TEST(StringPoolTest, SharesRepeatedValues) {
+    StringPool pool;
+    std::string_view a = pool.intern("2002-01-01");
+    std::string_view b = pool.intern(std::string("2002-01-01"));
+    EXPECT_EQ(a.data(), b.data());
+    EXPECT_EQ(pool.getSharedCount(), 1u);
+
+    PooledPath first = pool.storePath("/mnt/exports/winter26/photos/251000001.jpg");
+    PooledPath second = pool.storePath("/mnt/exports/winter26/photos/251000002.jpg");
+    EXPECT_EQ(first.directory.data(), second.directory.data());
+    EXPECT_EQ(first.directory, "/mnt/exports/winter26/photos/");
+    EXPECT_EQ(second.file, "251000002.jpg");
+    EXPECT_EQ(second.str(), "/mnt/exports/winter26/photos/251000002.jpg");
+
+    PooledPath bare = pool.storePath("pic.jpg");
+    EXPECT_TRUE(bare.directory.empty());
+    EXPECT_EQ(bare.str(), "pic.jpg");
+    EXPECT_TRUE(pool.store("").empty());
+
+    // Strings larger than a block still get one piece of storage
+    std::string longName(100000, 'x');
+    EXPECT_EQ(pool.store(longName), longName);
+}
+
+// Test case: Students share their exam's pool, and their text outlives the exam
+TEST(StringPoolTest, StudentsUseTheExamPool) {
+    Student copy(0, "", "", "");
+    {
+        Exam exam;
+        exam.addStudent(Student(1, "Ada Lovelace", "2002-01-01", "photos/1.jpg"));
+        exam.addStudent(Student(2, "Alan Turing", "2002-01-01", "photos/2.jpg", exam.getStringPool()));
+        std::vector<Student> &students = exam.getStudents();
+        EXPECT_EQ(students[0].getStringPool(), exam.getStringPool()) << "Added students move into the exam pool";
+        EXPECT_EQ(students[1].getStringPool(), exam.getStringPool());
+        EXPECT_EQ(students[0].getDOB().data(), students[1].getDOB().data());
+
+        students[1].setPicURL("photos/2b.jpg");
+        EXPECT_EQ(students[1].getPicURL(), "photos/2b.jpg");
+        EXPECT_EQ(students[0].getPicPath().directory.data(), students[1].getPicPath().directory.data());
+        copy = students[1];
+    }
+    EXPECT_EQ(copy.getName(), "Alan Turing");
+    EXPECT_EQ(copy.getPicURL(), "photos/2b.jpg");
+
+    Proctor proctor(90, "Grace Hopper", "1980-01-01", "p.jpg", "TA");
+    proctor.setRole("Course_Instructor");
+    EXPECT_EQ(proctor.getRole(), "Course_Instructor");
+}
+
+// Test case: A 60,000-student roster keeps its text in far fewer bytes than owned strings
+TEST(StringPoolTest, RosterMemory) {
+    const int count = 60000;
+    const std::string directory = "/mnt/registrar/exports/2026/winter/student-photos/";
+    auto pool = std::make_shared<StringPool>();
+    std::vector<Student> roster;
+    roster.reserve(count);
+    std::size_t ownedBytes = 0;
+    for (int i = 0; i < count; ++i) {
+        std::string name = "Student Number " + std::to_string(250000000 + i);
+        std::string dob = "200" + std::to_string(i % 6) + "-0" + std::to_string(1 + i % 9) + "-1" + std::to_string(i % 10);
+        std::string pic = directory + std::to_string(250000000 + i) + ".jpg";
+        roster.emplace_back(250000000 + i, name, dob, pic, pool);
+        // Each owned string past the short string buffer is a heap block of at least its length
+        for (const std::string *s : {&name, &dob, &pic}) ownedBytes += sizeof(std::string) + (s->size() > 15 ? s->size() + 1 : 0);
+    }
+
+    // Views instead of owned strings, plus the pool's text: at least a third smaller
+    std::size_t pooledBytes = count * (2 * sizeof(std::string_view) + sizeof(PooledPath)) + pool->getByteCount();
+    EXPECT_LT(pooledBytes * 3, ownedBytes * 2);
+    EXPECT_LT(pool->getSharedCount(), 100u) << "Dates of birth and the photo directory repeat";
+    EXPECT_EQ(roster[12345].getPicURL(), directory + "250012345.jpg");
+}
@@ -35,13 +35,23 @@ TEST_F(StudentTest, ConstructorInitialization) {
     EXPECT_EQ(student.getPicURL(), "https://example.com/alice.jpg");
     EXPECT_EQ(student.getAttendance(), false);
     EXPECT_EQ(student.getExamVersion(), 0); // Default value
-    EXPECT_EQ(student.getBreaksList()->size(), 0);
+    EXPECT_EQ(student.getBreaksList().size(), 0);
 }
 
-// Test case: Seat Number Getter and Setter
-TEST_F(StudentTest, SeatNumberGetterSetter) {
-    student.setSeatNum("R12C10");
-    EXPECT_EQ(student.getSeatNum(), "R12C10");
+// Test case: Seat Getter and Setter
+TEST_F(StudentTest, SeatGetterSetter) {
+    EXPECT_FALSE(student.hasSeat());
+    EXPECT_EQ(student.getSeatNum(), "");
+
+    student.setSeat(11, 9);
+    EXPECT_TRUE(student.hasSeat());
+    EXPECT_EQ(student.getSeatRow(), 11);
+    EXPECT_EQ(student.getSeatCol(), 9);
+    EXPECT_EQ(student.getSeatCode(), "R12C10");
+    EXPECT_EQ(student.getSeatNum(), "Row: 12\nColum: 10");
+
+    student.clearSeat();
+    EXPECT_FALSE(student.hasSeat());
 }
 
 // Test case: Exam Version Getter and Setter
@@ -50,6 +60,15 @@ TEST_F(StudentTest, ExamVersionGetterSetter) {
     EXPECT_EQ(student.getExamVersion(), 333);
 }
 
+// Test case: Extra Time Getter and Setter
+TEST_F(StudentTest, ExtraTimeGetterSetter) {
+    EXPECT_EQ(student.getExtraTime(), std::chrono::minutes(0)); // Default value
+    student.setExtraTime(std::chrono::minutes(45));
+    EXPECT_EQ(student.getExtraTime(), std::chrono::minutes(45));
+    student.setExtraTime(std::chrono::minutes(-10));
+    EXPECT_EQ(student.getExtraTime(), std::chrono::minutes(0));
+}
+
 // Test case: Attendance Getter and Setter
 TEST_F(StudentTest, AttendanceGetterSetter) {
     student.setAttendance(true);
@@ -59,7 +78,7 @@ TEST_F(StudentTest, AttendanceGetterSetter) {
 // Test case: Leave for Break (Start a new break)
 TEST_F(StudentTest, LeaveForBreak) {
     student.leaveForBreak();
-    EXPECT_EQ(student.getBreaksList()->size(), 1);
+    EXPECT_EQ(student.getBreaksList().size(), 1);
 }
 
 // Test case: Return from Break (End the last break)
@@ -68,8 +87,8 @@ TEST_F(StudentTest, ReturnFromBreak) {
     std::this_thread::sleep_for(std::chrono::seconds(1)); // Simulate break time
     student.returnFromBreak();
 
-    EXPECT_EQ(student.getBreaksList()->size(), 1);
-    EXPECT_FALSE(student.getBreaksList()->back().getEndTime().empty());
+    EXPECT_EQ(student.getBreaksList().size(), 1);
+    EXPECT_FALSE(student.getBreaksList().back().getEndTime().empty());
 }
 
 // Test case: Exam Submission Time Record
@@ -86,3 +105,23 @@ TEST_F(StudentTest, ExamSubmission) {
 }
 
 
+
+// Test case: Packed fields keep their values and the state flags stay independent
+TEST_F(StudentTest, PackedFields) {
+    student.setAttendance(true);
+    auto at = std::chrono::system_clock::now();
+    student.submitExam(at);
+    student.setAttendance(false);
+    EXPECT_FALSE(student.getAttendance());
+    EXPECT_TRUE(student.getSubmissionStatus());
+    EXPECT_EQ(student.getSubmissionTimePoint(), at) << "Submission time is kept to the clock tick";
+    student.submitExam(at + std::chrono::hours(1));
+    EXPECT_EQ(student.getSubmissionTimePoint(), at) << "A second submission does not move the time";
+
+    student.setSeat(Student::MAX_SEAT_INDEX, 0);
+    EXPECT_EQ(student.getSeatRow(), Student::MAX_SEAT_INDEX);
+    student.setExtraTime(std::chrono::hours(2000));
+    EXPECT_EQ(student.getExtraTime(), std::chrono::minutes(Student::MAX_EXTRA_MINUTES));
+    student.setExamVersion(-123456789);
+    EXPECT_EQ(student.getExamVersion(), -123456789);
+}
@@ -0,0 +1,114 @@
+/**
+ * @file StudentRouterTest.cpp
+ * @brief Unit tests for the StudentRouter and BloomFilter classes.
+ *
+ * This file contains Google Test cases for routing swiped IDs across every
+ * loaded exam, verifying that students are sent to the sitting that is running
+ * or comes next, that removed exams stop routing, and that the Bloom filter
+ * never rejects a registered student and rarely lets a foreign one through.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <memory>
+#include <string>
+#include "StudentRouter.h"
+#include "TestRoster.h"
+
+namespace {
+using Clock = std::chrono::system_clock;
+using std::chrono::hours;
+}
+
+// Test case: IDs are routed to the exam and room they are registered in
+TEST(StudentRouterTest, RoutesToRunningOrNextSitting) {
+    Clock::time_point morning = Clock::now();
+    auto cs = RosterBuilder().sitting("CS3307", "MC110").students(100, 1000).schedule(morning, hours(3)).build();
+    auto math = RosterBuilder().sitting("MATH1600", "NS1").students(100, 2000).schedule(morning, hours(2)).build();
+    // Students 1050-1099 also write an afternoon exam
+    auto afternoon = RosterBuilder().sitting("CS2212", "AH15")
+        .students(50, 1050).schedule(morning + hours(5), hours(2)).build();
+
+    StudentRouter router;
+    router.addExam("CS3307-MC110", *cs);
+    router.addExam("MATH1600-NS1", *math);
+    router.addExam("CS2212-AH15", *afternoon);
+    EXPECT_EQ(router.getExamCount(), 3u);
+    EXPECT_EQ(router.getStudentCount(), 200u);
+
+    StudentRoute found;
+    ASSERT_TRUE(router.route(2042, morning + std::chrono::minutes(10), found));
+    EXPECT_EQ(found.room, "NS1");
+    EXPECT_EQ(found.exam, math.get());
+
+    ASSERT_TRUE(router.route(1060, morning + std::chrono::minutes(10), found));
+    EXPECT_EQ(found.examKey, "CS3307-MC110") << "The running sitting wins";
+    ASSERT_TRUE(router.route(1060, morning + hours(4), found));
+    EXPECT_EQ(found.examKey, "CS2212-AH15") << "Between sittings, the next one wins";
+    ASSERT_TRUE(router.route(1060, morning + hours(9), found));
+    EXPECT_EQ(found.examKey, "CS2212-AH15") << "After the day, the last one wins";
+
+    std::vector<StudentRoute> sittings = router.lookup(1060);
+    ASSERT_EQ(sittings.size(), 2u);
+    EXPECT_EQ(sittings[0].courseNum, "CS3307");
+    EXPECT_EQ(sittings[1].courseNum, "CS2212");
+
+    EXPECT_FALSE(router.route(5000, morning, found));
+    EXPECT_TRUE(router.lookup(5000).empty());
+}
+
+// Test case: Removing an exam drops its students but keeps their other sittings
+TEST(StudentRouterTest, RemovedExamStopsRouting) {
+    Clock::time_point start = Clock::now();
+    auto cs = RosterBuilder().sitting("CS3307", "MC110").students(100, 1000).schedule(start, hours(3)).build();
+    auto afternoon = RosterBuilder().sitting("CS2212", "AH15")
+        .students(50, 1050).schedule(start + hours(5), hours(2)).build();
+
+    StudentRouter router;
+    router.addExam("CS3307-MC110", *cs);
+    router.addExam("CS2212-AH15", *afternoon);
+    ASSERT_TRUE(router.removeExam("CS3307-MC110"));
+    EXPECT_FALSE(router.removeExam("CS3307-MC110"));
+
+    StudentRoute found;
+    EXPECT_FALSE(router.route(1000, start, found));
+    ASSERT_TRUE(router.route(1060, start, found));
+    EXPECT_EQ(found.examKey, "CS2212-AH15");
+    EXPECT_EQ(router.getStudentCount(), 50u);
+
+    // Adding under a key already indexed replaces the old exam
+    router.addExam("CS2212-AH15", *cs);
+    EXPECT_EQ(router.getExamCount(), 1u);
+    EXPECT_EQ(router.getStudentCount(), 100u);
+}
+
+// Test case: A campus day of 50,000 registrations has no false negatives and few false positives
+TEST(StudentRouterTest, BloomFilterRejectsForeignIDs) {
+    Clock::time_point start = Clock::now();
+    std::vector<std::unique_ptr<Exam>> exams;
+    StudentRouter router;
+    for (int e = 0; e < 50; ++e) {
+        exams.push_back(RosterBuilder().sitting("C" + std::to_string(e), "R" + std::to_string(e))
+            .students(1000, 250000000 + e * 1000).schedule(start, hours(3)).build());
+        router.addExam("C" + std::to_string(e), *exams.back());
+    }
+    ASSERT_EQ(router.getStudentCount(), 50000u);
+
+    for (int id = 250000000; id < 250050000; ++id) {
+        ASSERT_TRUE(router.mightBeRegistered(id)) << id;
+    }
+
+    StudentRoute found;
+    int falsePositives = 0;
+    const int foreign = 50000;
+    for (int id = 1; id <= foreign; ++id) {
+        EXPECT_FALSE(router.route(id, start, found));
+        if (router.mightBeRegistered(id)) falsePositives++;
+    }
+    EXPECT_LT(falsePositives, foreign / 50) << "Under 2% of foreign IDs reach the hash index";
+    EXPECT_EQ(router.getFilterRejectCount(), static_cast<std::uint64_t>(foreign - falsePositives));
+}
@@ -0,0 +1,139 @@
+/**
+ * @file TimeFormatTest.cpp
+ * @brief Unit tests for the cached local time formatters in Utils.h.
+ *
+ * This file contains Google Test cases for the buffer-based time formatters,
+ * verifying that they agree with std::put_time for every time around the
+ * daylight saving changes of a zone that has them, that worker threads get
+ * the same text, that a change of time zone is picked up, and that lengths
+ * of time and the Break and Student getters keep their formats.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Break.h"
+#include "Student.h"
+#include "Utils.h"
+
+using std::chrono::system_clock;
+
+// Test fixture that switches to a zone with daylight saving time and back
+class TimeFormatTest : public ::testing::Test {
+protected:
+    std::string savedTZ;
+    bool hadTZ = false;
+
+    void SetUp() override {
+        if (const char *tz = std::getenv("TZ")) {
+            hadTZ = true;
+            savedTZ = tz;
+        }
+        setTimeZone("America/Toronto");
+    }
+
+    void TearDown() override {
+        if (hadTZ) {
+            setenv("TZ", savedTZ.c_str(), 1);
+        } else {
+            unsetenv("TZ");
+        }
+        refreshLocalTimeZone();
+    }
+
+    void setTimeZone(const char *tz) {
+        setenv("TZ", tz, 1);
+        refreshLocalTimeZone();
+    }
+
+    static std::string reference(system_clock::time_point tp, const char *format) {
+        std::tm tm = toLocalTm(system_clock::to_time_t(tp));
+        std::ostringstream oss;
+        oss << std::put_time(&tm, format);
+        return oss.str();
+    }
+
+    // Times every 7 minutes 13 seconds through the spring and fall changes of 2026, and across the years
+    static std::vector<system_clock::time_point> samples() {
+        std::vector<system_clock::time_point> times;
+        for (std::time_t start : {std::time_t(1772928000), std::time_t(1793491200)}) {   // 2026-03-08, 2026-11-01
+            for (std::time_t t = start - 2 * 86400; t < start + 2 * 86400; t += 433) {
+                times.push_back(system_clock::from_time_t(t));
+            }
+        }
+        for (std::time_t t = 0; t < std::time_t(4000000000); t += 9876543) {
+            times.push_back(system_clock::from_time_t(t) + std::chrono::milliseconds(999));
+        }
+        return times;
+    }
+};
+
+// Test case: Formatted times agree with put_time, daylight saving changes included
+TEST_F(TimeFormatTest, MatchesPutTime) {
+    char clock[CLOCK_TEXT_SIZE];
+    char stamp[TIMESTAMP_TEXT_SIZE];
+    for (system_clock::time_point tp : samples()) {
+        ASSERT_EQ(std::string(clock, formatClockTime(tp, clock)), reference(tp, "%H:%M:%S"));
+        ASSERT_EQ(std::string(stamp, formatTimestamp(tp, stamp)), reference(tp, "%Y-%m-%d %H:%M:%S"));
+        ASSERT_EQ(timePointToString(tp), reference(tp, "%Y-%m-%d %H:%M:%S"));
+    }
+    formatTimestamp(system_clock::from_time_t(1790000000), stamp, 'T');
+    EXPECT_EQ(std::string(stamp), reference(system_clock::from_time_t(1790000000), "%Y-%m-%dT%H:%M:%S"));
+}
+
+// Test case: Worker threads format the same text, and a new time zone is picked up
+TEST_F(TimeFormatTest, WorkerThreadsAndZoneChanges) {
+    std::vector<system_clock::time_point> times = samples();
+    std::vector<std::string> expected;
+    for (system_clock::time_point tp : times) expected.push_back(reference(tp, "%Y-%m-%d %H:%M:%S"));
+
+    std::vector<int> mismatches(8, 0);
+    std::vector<std::thread> workers;
+    for (int w = 0; w < 8; ++w) {
+        workers.emplace_back([&, w] {
+            char stamp[TIMESTAMP_TEXT_SIZE];
+            for (std::size_t i = w; i < times.size(); i += 3) {
+                formatTimestamp(times[i], stamp);
+                mismatches[w] += expected[i] != stamp;
+            }
+        });
+    }
+    for (std::thread &t : workers) t.join();
+    for (int m : mismatches) EXPECT_EQ(m, 0);
+
+    char clock[CLOCK_TEXT_SIZE];
+    system_clock::time_point morning = system_clock::from_time_t(1790000000);   // 2026-09-21 14:13:20 UTC
+    EXPECT_EQ(std::string(clock, formatClockTime(morning, clock)), "10:13:20");
+    setTimeZone("UTC0");
+    EXPECT_EQ(std::string(clock, formatClockTime(morning, clock)), "14:13:20");
+}
+
+// Test case: Lengths of time and the Break and Student getters keep their formats
+TEST_F(TimeFormatTest, ElapsedAndGetters) {
+    char text[ELAPSED_TEXT_SIZE];
+    EXPECT_EQ(std::string(text, formatElapsed(std::chrono::seconds(307), text)), "00:05:07");
+    EXPECT_EQ(std::string(text, formatElapsed(std::chrono::hours(100) + std::chrono::seconds(59), text)), "100:00:59");
+    EXPECT_EQ(std::string(text, formatElapsed(std::chrono::seconds(-5), text)), "00:00:00");
+
+    system_clock::time_point start = system_clock::from_time_t(1790000000);
+    Break b(start);
+    b.endBreak(start + std::chrono::minutes(12) + std::chrono::seconds(3));
+    EXPECT_EQ(b.getStartTime(), reference(start, "%H:%M:%S"));
+    EXPECT_EQ(b.getEndTime(), reference(b.getEndTimePoint(), "%H:%M:%S"));
+    EXPECT_EQ(b.getDuration(), "00:12:03");
+
+    Student s(1, "Student", "2002-01-01", "pic.jpg");
+    EXPECT_EQ(s.getSubmissionTime(), "Exam in progress");
+    s.submitExam(start);
+    EXPECT_EQ(s.getSubmissionTime(), reference(start, "%H:%M:%S"));
+}
@@ -0,0 +1,160 @@
+/**
+ * @file TimerWheelTest.cpp
+ * @brief Unit tests for the TimerWheel class and the exam deadlines it drives.
+ *
+ * This file contains Google Test cases for the hierarchical timer wheel,
+ * verifying that timers fire on time and never early across every level, that
+ * cancelled timers do not fire, that thousands of deadlines are handled
+ * cheaply, and that exams submit at their end time while students with extra
+ * time keep writing until their own deadline.
+ *
+ * @author Allen Pan
+ * @version 1.0
+ * @date 2026-10-17
+ */
+
+#include <gtest/gtest.h>
+#include <chrono>
+#include <vector>
+#include "Exam.h"
+#include "TimerWheel.h"
+
+using std::chrono::hours;
+using std::chrono::milliseconds;
+using std::chrono::minutes;
+using std::chrono::seconds;
+
+// Test case: Timers fire in deadline order, never before their deadline
+TEST(TimerWheelTest, FiresOnTimeAcrossLevels) {
+    TimerWheel::Clock::time_point origin = TimerWheel::Clock::now();
+    TimerWheel wheel(seconds(1), origin);
+    std::vector<int> fired;
+
+    // One timer per level of the wheel, plus one beyond its range
+    std::vector<TimerWheel::Clock::duration> delays = {seconds(5), minutes(30), hours(20), hours(24 * 30),
+                                                       hours(24 * 400)};
+    for (std::size_t i = 0; i < delays.size(); ++i) {
+        wheel.schedule(origin + delays[i], [&fired, i] { fired.push_back(static_cast<int>(i)); });
+    }
+    EXPECT_EQ(wheel.size(), delays.size());
+
+    for (std::size_t i = 0; i < delays.size(); ++i) {
+        EXPECT_EQ(wheel.advance(origin + delays[i] - milliseconds(1)), 0u) << "Timer " << i << " fired early";
+        EXPECT_EQ(wheel.advance(origin + delays[i]), 1u) << "Timer " << i << " is late";
+    }
+    EXPECT_EQ(fired, (std::vector<int>{0, 1, 2, 3, 4}));
+    EXPECT_EQ(wheel.size(), 0u);
+
+    // A deadline already past fires on the next tick
+    wheel.schedule(origin, [&fired] { fired.push_back(9); });
+    EXPECT_EQ(wheel.advance(origin + hours(24 * 400) + seconds(1)), 1u);
+}
+
+// Test case: Cancelled timers never fire, and stale IDs are ignored
+TEST(TimerWheelTest, CancelledTimersDoNotFire) {
+    TimerWheel::Clock::time_point origin = TimerWheel::Clock::now();
+    TimerWheel wheel(seconds(1), origin);
+    int fired = 0;
+    TimerWheel::TimerId first = wheel.schedule(origin + minutes(10), [&fired] { fired += 1; });
+    TimerWheel::TimerId second = wheel.schedule(origin + minutes(10), [&fired] { fired += 10; });
+    EXPECT_NE(first, TimerWheel::NO_TIMER);
+
+    EXPECT_TRUE(wheel.cancel(first));
+    EXPECT_FALSE(wheel.cancel(first));
+    EXPECT_EQ(wheel.advance(origin + hours(1)), 1u);
+    EXPECT_EQ(fired, 10);
+    EXPECT_FALSE(wheel.cancel(second)) << "A timer that fired cannot be cancelled";
+
+    // The freed storage is reused; the old ID must not cancel the new timer
+    TimerWheel::TimerId reused = wheel.schedule(origin + hours(2), [&fired] { fired += 100; });
+    EXPECT_FALSE(wheel.cancel(first));
+    EXPECT_EQ(wheel.advance(origin + hours(3)), 1u);
+    EXPECT_EQ(fired, 110);
+    EXPECT_FALSE(wheel.cancel(reused));
+}
+
+// Test case: Thousands of deadlines across a day, rescheduling from inside callbacks
+TEST(TimerWheelTest, ManyDeadlines) {
+    TimerWheel::Clock::time_point origin = TimerWheel::Clock::now();
+    TimerWheel wheel(seconds(1), origin);
+    const int count = 20000;
+    int fired = 0, late = 0;
+    TimerWheel::Clock::time_point now = origin;
+    for (int i = 0; i < count; ++i) {
+        TimerWheel::Clock::time_point deadline = origin + seconds((i * 7919) % (12 * 3600));
+        wheel.schedule(deadline, [&, deadline] {
+            fired++;
+            if (now - deadline >= seconds(1)) late++;
+        });
+    }
+    wheel.schedule(origin + hours(1), [&] { wheel.schedule(origin + hours(2), [&fired] { fired++; }); });
+
+    // Advance the way the desk does, once a second over twelve hours
+    for (int s = 0; s <= 12 * 3600; ++s) {
+        now = origin + seconds(s);
+        wheel.advance(now);
+    }
+    EXPECT_EQ(fired, count + 1);
+    EXPECT_EQ(late, 0);
+    EXPECT_EQ(wheel.size(), 0u);
+}
+
+// Test fixture for exam deadlines
+class ExamDeadlineTest : public ::testing::Test {
+protected:
+    Exam exam;
+    TimerWheel::Clock::time_point endTime;
+
+    void SetUp() override {
+        auto now = std::chrono::system_clock::now();
+        endTime = now + hours(1);
+        exam.setStartTime(now - hours(1));
+        exam.setEndTime(endTime);
+        exam.setMaxRow(5);
+        exam.setMaxCol(5);
+        exam.setNumVersions(2);
+        exam.setVersionsCode({11, 22});
+        exam.initializeSeatMap();
+        for (int id = 1; id <= 6; ++id) {
+            Student s(id, "Student", "2002-01-01", "pic.jpg");
+            if (id == 5) s.setExtraTime(minutes(30));
+            if (id == 6) s.setExtraTime(minutes(60));
+            exam.addStudent(s);
+        }
+        exam.checkInBatch({1, 2, 3, 5, 6}, now);
+        exam.earlySubmission(3);
+    }
+};
+
+// Test case: The end time submits everyone but students with extra time
+TEST_F(ExamDeadlineTest, ExtraTimeStudentsKeepWriting) {
+    EXPECT_EQ(exam.getDeadline(1), endTime);
+    EXPECT_EQ(exam.getDeadline(5), endTime + minutes(30));
+
+    TimerWheel wheel(seconds(1), endTime - hours(2));
+    wheel.schedule(endTime, [this] { exam.submitDue(endTime); });
+    for (int id : {5, 6}) {
+        wheel.schedule(exam.getDeadline(id), [this, id] { exam.submitAtDeadline(id); });
+    }
+
+    wheel.advance(endTime);
+    EXPECT_TRUE(exam.getStudentByID(1)->getSubmissionStatus());
+    EXPECT_TRUE(exam.getStudentByID(2)->getSubmissionStatus());
+    EXPECT_FALSE(exam.getStudentByID(4)->getSubmissionStatus()) << "Absent students are not submitted";
+    EXPECT_FALSE(exam.getStudentByID(5)->getSubmissionStatus());
+    EXPECT_FALSE(exam.getStudentByID(6)->getSubmissionStatus());
+    EXPECT_EQ(exam.getStats().earlySubmitted, 1);
+
+    wheel.advance(endTime + minutes(45));
+    EXPECT_TRUE(exam.getStudentByID(5)->getSubmissionStatus());
+    EXPECT_FALSE(exam.getStudentByID(6)->getSubmissionStatus());
+
+    // A desk that was down catches up and stamps the deadline, not the time it woke up
+    wheel.advance(endTime + hours(3));
+    ASSERT_TRUE(exam.getStudentByID(6)->getSubmissionStatus());
+    // Event times are kept to the microsecond
+    EXPECT_LT(std::chrono::abs(exam.getStudentByID(6)->getSubmissionTimePoint() - (endTime + minutes(60))),
+              std::chrono::microseconds(1));
+    EXPECT_EQ(exam.getStats().submitted, 5);
+    EXPECT_FALSE(exam.submitAtDeadline(6));
+}